@@ -132,6 +132,10 @@ public:
 
   std::shared_ptr<const tesseract::common::ContactAllowedValidator> getContactAllowedValidator() const override final;
 
+  const ContactManagerStatistics& getStatistics() const override final;
+
+  void resetStatistics() override final;
+
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
   /**
@@ -167,11 +171,23 @@ private:
    */
   ContactTestData contact_test_data_;
 
+  /** @brief The compiled collision margin table indexed by collision object id */
+  CollisionMarginTable collision_margin_table_;
+
+  /** @brief The statistics collected during contactTest */
+  ContactManagerStatistics statistics_;
+
+  /** @brief Indicate if the collision margin table must be rebuilt before the next contact test */
+  bool collision_margin_table_dirty_{ true };
+
   /** @brief Filter collision objects before broadphase check */
   bullet_internal::TesseractOverlapFilterCallback broadphase_overlap_cb_;
 
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief Reassign collision object ids after the list of collision objects changed */
+  void updateCollisionObjectIndices();
 };
 }  // namespace tesseract::collision
 
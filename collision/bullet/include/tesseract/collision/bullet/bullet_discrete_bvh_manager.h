@@ -41,6 +41,8 @@
 
 #include <tesseract/collision/bullet/bullet_utils.h>
 #include <tesseract/collision/discrete_contact_manager.h>
+#include <tesseract/collision/contact_result_cache.h>
+#include <tesseract/collision/parallel_narrowphase.h>
 #include <tesseract/collision/bullet/tesseract_collision_configuration.h>
 
 namespace tesseract::collision
@@ -121,6 +123,22 @@ public:
 
   std::shared_ptr<const tesseract::common::ContactAllowedValidator> getContactAllowedValidator() const override final;
 
+  void setContactApproximationType(ContactApproximationType type) override final;
+
+  ContactApproximationType getContactApproximationType() const override final;
+
+  void setContactResultCacheEnabled(bool enabled) override final;
+
+  bool isContactResultCacheEnabled() const override final;
+
+  void setNarrowphaseExecutor(std::shared_ptr<tesseract::common::TaskExecutor> executor) override final;
+
+  std::shared_ptr<tesseract::common::TaskExecutor> getNarrowphaseExecutor() const override final;
+
+  const ContactManagerStatistics& getStatistics() const override final;
+
+  void resetStatistics() override final;
+
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
   /**
@@ -129,6 +147,15 @@ public:
    */
   void addCollisionObject(const bullet_internal::COW::Ptr& cow);
 
+  /**
+   * @copydoc DiscreteContactManager::setCollisionObjectsTransform(const std::vector<std::size_t>&, const
+   * tesseract::common::VectorIsometry3d&)
+   * @details Objects whose transform did not change are skipped, so static objects are left in the broadphase fixed
+   * tree.
+   */
+  void setCollisionObjectsTransform(const std::vector<std::size_t>& indices,
+                                    const tesseract::common::VectorIsometry3d& poses) override final;
+
 private:
   std::string name_;
   /** @brief A list of the active collision objects */
@@ -148,17 +175,57 @@ private:
   /** @brief A map of all (static and active) collision objects being managed */
   bullet_internal::Link2Cow link2cow_;
 
+  /** @brief All collision objects ordered by their object index, this matches collision_objects_ */
+  std::vector<bullet_internal::COW::Ptr> cows_;
+
   /**
    * @brief This is used when contactTest is called. It is also added as a user point to the collsion objects
    * so it can be used to exit collision checking for compound shapes.
    */
   ContactTestData contact_test_data_;
 
+  /** @brief The compiled collision margin table indexed by collision object id */
+  CollisionMarginTable collision_margin_table_;
+
+  /** @brief The statistics collected during contactTest */
+  ContactManagerStatistics statistics_;
+
+  /** @brief The contact results of the pairs checked by previous contact tests */
+  ContactResultCache contact_result_cache_;
+
+  /** @brief Indicate if the collision margin table must be rebuilt before the next contact test */
+  bool collision_margin_table_dirty_{ true };
+
   /** @brief Filter collision objects before broadphase check */
   bullet_internal::TesseractOverlapFilterCallback broadphase_overlap_cb_;
 
+  /** @brief The overlapping pairs with the distance between their AABBs, used to order a global minimum search */
+  std::vector<std::pair<double, btBroadphasePair*>> ordered_pairs_;
+
+  /** @brief The executor used to check the narrowphase pairs in parallel, nullptr to check them serially */
+  std::shared_ptr<tesseract::common::TaskExecutor> narrowphase_executor_;
+
+  /** @brief The overlapping pairs which need the narrowphase check, gathered when checking in parallel */
+  std::vector<btBroadphasePair*> narrowphase_pairs_;
+
+  /** @brief The results and statistics of each block of narrowphase pairs checked in parallel */
+  std::vector<std::unique_ptr<NarrowphaseBlockData>> narrowphase_blocks_;
+
+  /** @brief The collision dispatcher of each block of narrowphase pairs checked in parallel */
+  std::vector<std::unique_ptr<NarrowphaseCollisionDispatcher>> narrowphase_dispatchers_;
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief Reassign collision object ids after the list of collision objects changed */
+  void updateCollisionObjectIndices();
+
+  /**
+   * @brief Set the world transform of a collision object and update its broadphase AABB if it changed
+   * @param cow The collision object
+   * @param pose The world transform
+   */
+  void updateCollisionObjectTransform(const bullet_internal::COW::Ptr& cow, const Eigen::Isometry3d& pose);
 };
 
 }  // namespace tesseract::collision
@@ -39,13 +39,26 @@
 #ifndef TESSERACT_COLLISION_BULLET_DISCRETE_SIMPLE_MANAGERS_H
 #define TESSERACT_COLLISION_BULLET_DISCRETE_SIMPLE_MANAGERS_H
 
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <utility>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract/collision/bullet/bullet_utils.h>
 #include <tesseract/collision/discrete_contact_manager.h>
+#include <tesseract/collision/contact_result_cache.h>
+#include <tesseract/collision/parallel_narrowphase.h>
 #include <tesseract/collision/bullet/tesseract_collision_configuration.h>
 
 namespace tesseract::collision
 {
-/** @brief A simple implementation of a bullet manager which does not use BHV */
+/**
+ * @brief A simple implementation of a bullet manager which does not use BHV
+ * @details The broadphase is a sweep and prune which is rebuilt on every contact test, so there is no cost to
+ * moving collision objects.
+ */
 class BulletDiscreteSimpleManager : public DiscreteContactManager
 {
 public:
@@ -87,6 +100,8 @@ public:
 
   bool isCollisionObjectEnabled(const std::string& name) const override final;
 
+  using DiscreteContactManager::setCollisionObjectsTransform;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
 
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -121,6 +136,22 @@ public:
 
   std::shared_ptr<const tesseract::common::ContactAllowedValidator> getContactAllowedValidator() const override final;
 
+  void setContactApproximationType(ContactApproximationType type) override final;
+
+  ContactApproximationType getContactApproximationType() const override final;
+
+  void setContactResultCacheEnabled(bool enabled) override final;
+
+  bool isContactResultCacheEnabled() const override final;
+
+  void setNarrowphaseExecutor(std::shared_ptr<tesseract::common::TaskExecutor> executor) override final;
+
+  std::shared_ptr<tesseract::common::TaskExecutor> getNarrowphaseExecutor() const override final;
+
+  const ContactManagerStatistics& getStatistics() const override final;
+
+  void resetStatistics() override final;
+
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
   /**
@@ -154,8 +185,74 @@ private:
    */
   ContactTestData contact_test_data_;
 
+  /** @brief The compiled collision margin table indexed by collision object id */
+  CollisionMarginTable collision_margin_table_;
+
+  /** @brief The statistics collected during contactTest */
+  ContactManagerStatistics statistics_;
+
+  /** @brief The contact results of the pairs checked by previous contact tests */
+  ContactResultCache contact_result_cache_;
+
+  /** @brief Indicate if the collision margin table must be rebuilt before the next contact test */
+  bool collision_margin_table_dirty_{ true };
+
+  /** @brief The executor used to check the narrowphase pairs in parallel, nullptr to check them serially */
+  std::shared_ptr<tesseract::common::TaskExecutor> narrowphase_executor_;
+
+  /** @brief The pairs of indices into cows_ which need the narrowphase check, gathered when checking in parallel */
+  std::vector<std::pair<std::size_t, std::size_t>> narrowphase_pairs_;
+
+  /** @brief The results and statistics of each block of narrowphase pairs checked in parallel */
+  std::vector<std::unique_ptr<NarrowphaseBlockData>> narrowphase_blocks_;
+
+  /** @brief The collision dispatcher of each block of narrowphase pairs checked in parallel */
+  std::vector<std::unique_ptr<NarrowphaseCollisionDispatcher>> narrowphase_dispatchers_;
+
+  /**
+   * @brief The broadphase data gathered by contactTest
+   * @details The AABBs of the enabled collision objects are stored as structure of arrays sorted by their minimum x
+   * value. The buffers are kept between calls to avoid allocations.
+   */
+  struct BroadphaseData
+  {
+    struct Entry
+    {
+      btScalar min[3];  // NOLINT
+      btScalar max[3];  // NOLINT
+      std::size_t cow_index;
+    };
+
+    /** @brief The AABBs of the enabled collision objects, sorted by their minimum x value before they are copied */
+    std::vector<Entry> entries;
+    std::vector<btScalar> min_x;
+    std::vector<btScalar> max_x;
+    std::vector<btScalar> min_y;
+    std::vector<btScalar> max_y;
+    std::vector<btScalar> min_z;
+    std::vector<btScalar> max_z;
+    /** @brief The index of the collision object in cows_ */
+    std::vector<std::size_t> cow_indices;
+    /** @brief The overlap result of the candidates of a single collision object */
+    std::vector<std::uint8_t> overlap;
+    /** @brief The pairs of indices into cows_ which overlap, the first index is always the smallest */
+    std::vector<std::pair<std::size_t, std::size_t>> pairs;
+    /** @brief The pairs with the distance between their AABBs, used to order a global minimum search */
+    std::vector<std::pair<double, std::pair<std::size_t, std::size_t>>> pair_distances;
+  };
+  BroadphaseData broadphase_;
+
+  /** @brief Find the pairs of collision objects with overlapping AABBs using sweep and prune along the x axis */
+  void updateBroadphasePairs();
+
+  /** @brief Order the broadphase pairs by the distance between their AABBs, closest first */
+  void sortBroadphasePairsByAABBDistance();
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief Reassign collision object ids after the list of collision objects changed */
+  void updateCollisionObjectIndices();
 };
 
 }  // namespace tesseract::collision
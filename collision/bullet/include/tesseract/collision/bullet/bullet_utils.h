@@ -43,6 +43,7 @@
 
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
 #include <BulletCollision/CollisionShapes/btCollisionShape.h>
 #include <BulletCollision/CollisionDispatch/btManifoldResult.h>
 #include <btBulletCollisionCommon.h>
@@ -51,6 +52,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/collision/types.h>
 #include <tesseract/collision/common.h>
+#include <tesseract/collision/bounding_spheres.h>
 #include <tesseract/collision/bullet/bullet_collision_shape_cache.h>
 
 namespace tesseract::collision::bullet_internal
@@ -108,6 +110,10 @@ public:
   const std::string& getName() const;
   /** @brief Get a user defined type */
   const int& getTypeID() const;
+  /** @brief Get the collision object id assigned by the contact manager, -1 if not assigned */
+  int getObjectIndex() const;
+  /** @brief Set the collision object id, this is used to index the contact managers collision margin table */
+  void setObjectIndex(int index);
   /** \brief Check if two CollisionObjectWrapper objects point to the same source object */
   bool sameObject(const CollisionObjectWrapper& other) const;
 
@@ -115,6 +121,9 @@ public:
 
   const tesseract::common::VectorIsometry3d& getCollisionGeometriesTransforms() const;
 
+  /** @brief Get the conservative bounding spheres of the collision geometries relative to the object frame */
+  const BoundingSpheres& getBoundingSpheres() const;
+
   /**
    * @brief Get the collision object's axis aligned bounding box
    * This AABB is extended by half of the contact processing threshold, so the broadphase takes
@@ -139,10 +148,14 @@ protected:
   std::string m_name;
   /** @brief A user defined type id */
   int m_type_id{ -1 };
+  /** @brief The collision object id assigned by the contact manager */
+  int m_object_index{ -1 };
   /* @brief The shapes that define the collision object */
   CollisionShapesConst m_shapes;
   /**< @brief The shapes poses information */
   tesseract::common::VectorIsometry3d m_shape_poses;
+  /** @brief The conservative bounding spheres of the shapes relative to the object frame */
+  BoundingSpheres m_bounding_spheres;
   /** @brief This manages the collision shape pointer so they get destroyed */
   std::vector<std::shared_ptr<BulletCollisionShape>> m_data;
 };
@@ -219,6 +232,36 @@ bool needsCollisionCheck(const COW& cow1,
                          const std::shared_ptr<const tesseract::common::ContactAllowedValidator>& validator,
                          bool verbose = false);
 
+/**
+ * @brief Check if two collision objects could be within their pair collision margin using the contact approximation
+ * @param cow1 The first collision object
+ * @param cow2 The second collision object
+ * @param cdata The contact test data containing the approximation type and collision margins
+ * @return False if the approximation guarantees the objects are further apart than the margin, otherwise true
+ */
+bool isApproximationWithinMargin(const COW& cow1, const COW& cow2, const ContactTestData& cdata);
+
+/**
+ * @brief Get the distance between the axis aligned bounding boxes of two collision objects
+ * @details The bounding boxes do not include the contact processing threshold, so this is a lower bound of the distance
+ * between the objects when it is greater than zero.
+ * @param cow1 The first collision object
+ * @param cow2 The second collision object
+ * @return The distance between the bounding boxes, zero if they overlap
+ */
+double getAABBDistance(const COW& cow1, const COW& cow2);
+
+/**
+ * @brief Check if two collision objects could be closer than the global minimum found so far
+ * @details This is always true unless the request type is ContactTestType::GLOBAL_MINIMUM. Overlapping bounding boxes
+ * do not bound the penetration depth so those pairs are never rejected.
+ * @param cow1 The first collision object
+ * @param cow2 The second collision object
+ * @param cdata The contact test data containing the request and the global minimum found so far
+ * @return False if the bounding boxes guarantee the objects are further apart than the global minimum, otherwise true
+ */
+bool isAABBWithinGlobalMinimum(const COW& cow1, const COW& cow2, const ContactTestData& cdata);
+
 /**
  * @brief Calculate the continuous contact data for casted collision shape
  * @param col Contact results
@@ -277,6 +320,8 @@ struct DiscreteBroadphaseContactResultCallback : public BroadphaseContactResultC
 {
   DiscreteBroadphaseContactResultCallback(ContactTestData& collisions, bool verbose = false);
 
+  bool needsCollision(const CollisionObjectWrapper* cow0, const CollisionObjectWrapper* cow1) const override;
+
   btScalar addSingleResult(btManifoldPoint& cp,
                            const btCollisionObjectWrapper* colObj0Wrap,
                            int partId0,
@@ -321,6 +366,7 @@ class TesseractCollisionPairCallback : public btOverlapCallback
   const btDispatcherInfo& dispatch_info_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
   btCollisionDispatcher* dispatcher_;
   BroadphaseContactResultCallback& results_callback_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+  std::vector<btBroadphasePair*>* narrowphase_pairs_{ nullptr };
 
 public:
   TesseractCollisionPairCallback(const btDispatcherInfo& dispatchInfo,
@@ -334,6 +380,20 @@ public:
   TesseractCollisionPairCallback& operator=(TesseractCollisionPairCallback&&) = delete;
 
   bool processOverlap(btBroadphasePair& pair) override;
+
+  /**
+   * @brief Gather the pairs which need the narrowphase check instead of checking them in processOverlap
+   * @param pairs The gathered pairs, nullptr to check the pairs in processOverlap
+   */
+  void setNarrowphasePairs(std::vector<btBroadphasePair*>* pairs);
+
+  /**
+   * @brief Run the narrowphase check of a pair which passed the broadphase and allowed collision checks
+   * @details The collision algorithm is created with the dispatcher if the pair does not have one and is kept in the
+   * pair
+   * @param pair The broadphase pair
+   */
+  void processNarrowphase(btBroadphasePair& pair);
 };
 
 /** @brief This class is used to filter broadphase */
@@ -45,6 +45,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <BulletCollision/CollisionDispatch/btDefaultCollisionConfiguration.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+class btCollisionDispatcher;
+
 namespace tesseract::collision
 {
 struct TesseractCollisionConfigurationInfo : public btDefaultCollisionConstructionInfo
@@ -75,12 +77,70 @@ protected:
  *     - Compound to Collision
  *     - Compound to Compound
  *     - Convex to Convex
+ *
+ * It also adds the algorithm for the octree shape (TesseractOctreeShape) to any shape which is not a compound, the
+ * compound algorithms dispatch their children which are octrees to it.
  */
 class TesseractCollisionConfiguration : public btDefaultCollisionConfiguration
 {
 public:
   TesseractCollisionConfiguration(
       const TesseractCollisionConfigurationInfo& config_info = TesseractCollisionConfigurationInfo());
+  ~TesseractCollisionConfiguration() override;
+  TesseractCollisionConfiguration(const TesseractCollisionConfiguration&) = delete;
+  TesseractCollisionConfiguration& operator=(const TesseractCollisionConfiguration&) = delete;
+  TesseractCollisionConfiguration(TesseractCollisionConfiguration&&) = delete;
+  TesseractCollisionConfiguration& operator=(TesseractCollisionConfiguration&&) = delete;
+
+  btCollisionAlgorithmCreateFunc* getCollisionAlgorithmCreateFunc(int proxyType0, int proxyType1) override;
+
+  btCollisionAlgorithmCreateFunc* getClosestPointsAlgorithmCreateFunc(int proxyType0, int proxyType1) override;
+
+protected:
+  std::unique_ptr<btCollisionAlgorithmCreateFunc> octree_create_func_;
+  std::unique_ptr<btCollisionAlgorithmCreateFunc> swapped_octree_create_func_;
+
+  /**
+   * @brief Get the create function of the octree algorithm
+   * @return The create function, nullptr if the pair is not handled by the octree algorithm
+   */
+  btCollisionAlgorithmCreateFunc* getOctreeAlgorithmCreateFunc(int proxyType0, int proxyType1) const;
+};
+
+/**
+ * @brief A collision dispatcher with its own collision configuration and pool allocators
+ * @details The collision dispatcher allocates collision algorithms and manifolds from the pools of its configuration,
+ * which are not thread safe, so every block of narrowphase pairs checked in parallel uses its own dispatcher.
+ *
+ * Checking the pairs this way has two limits compared to the serial contactTest:
+ *  - The algorithm of a pair is created and freed by the dispatcher for every pair of every contact test. The BVH
+ *    manager otherwise keeps the algorithms in its pair cache between contact tests, so compare both paths with the
+ *    large dataset benchmarks before enabling the executor.
+ *  - The compound and octree algorithms read the ContactTestData from the user pointer of the collision objects,
+ *    which is the contact test data of the manager rather than that of the block. For ContactTestType::FIRST a block
+ *    which is done therefore stops before its next pair, but not within the children of a compound or octree pair.
+ */
+class NarrowphaseCollisionDispatcher
+{
+public:
+  /**
+   * @brief NarrowphaseCollisionDispatcher
+   * @param config_info The collision configuration information, new pool allocators are always created
+   */
+  explicit NarrowphaseCollisionDispatcher(const TesseractCollisionConfigurationInfo& config_info);
+  ~NarrowphaseCollisionDispatcher();
+  NarrowphaseCollisionDispatcher(const NarrowphaseCollisionDispatcher&) = delete;
+  NarrowphaseCollisionDispatcher& operator=(const NarrowphaseCollisionDispatcher&) = delete;
+  NarrowphaseCollisionDispatcher(NarrowphaseCollisionDispatcher&&) = delete;
+  NarrowphaseCollisionDispatcher& operator=(NarrowphaseCollisionDispatcher&&) = delete;
+
+  /** @brief Get the collision dispatcher */
+  btCollisionDispatcher* getDispatcher() const;
+
+private:
+  TesseractCollisionConfigurationInfo config_info_;
+  std::unique_ptr<TesseractCollisionConfiguration> coll_config_;
+  std::unique_ptr<btCollisionDispatcher> dispatcher_;
 };
 }  // namespace tesseract::collision
 #endif  // TESSERACT_COLLISION_TESSERACT_COLLISION_CONFIGURATION_H
@@ -0,0 +1,92 @@
+/**
+ * @file tesseract_octree_collision_algorithm.h
+ * @brief Collision algorithm between a TesseractOctreeShape and other collision shapes
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_TESSERACT_OCTREE_COLLISION_ALGORITHM_H
+#define TESSERACT_COLLISION_TESSERACT_OCTREE_COLLISION_ALGORITHM_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/BroadphaseCollision/btDispatcher.h>
+#include <BulletCollision/CollisionDispatch/btActivatingCollisionAlgorithm.h>
+#include <BulletCollision/CollisionDispatch/btCollisionCreateFunc.h>
+#include <BulletCollision/NarrowPhaseCollision/btPersistentManifold.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract::collision::bullet_internal
+{
+/**
+ * @brief Supports collision between a TesseractOctreeShape and other collision shapes
+ *
+ * The other shape is checked against the occupied leaves of the octree which overlap its bounds, extended by the
+ * contact distance. A child algorithm is created for every overlapping leaf and released after it is processed, so no
+ * state is kept between queries. The traversal exits early when the contact test is done.
+ *
+ * The leaves report the shape and sub shape index of the octree itself, because the leaves of an octree are not
+ * indexed.
+ */
+class TesseractOctreeCollisionAlgorithm : public btActivatingCollisionAlgorithm  // NOLINT
+{
+public:
+  TesseractOctreeCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
+                                    const btCollisionObjectWrapper* body0Wrap,
+                                    const btCollisionObjectWrapper* body1Wrap,
+                                    bool isSwapped);
+
+  void processCollision(const btCollisionObjectWrapper* body0Wrap,
+                        const btCollisionObjectWrapper* body1Wrap,
+                        const btDispatcherInfo& dispatchInfo,
+                        btManifoldResult* resultOut) override;
+
+  btScalar calculateTimeOfImpact(btCollisionObject* body0,
+                                 btCollisionObject* body1,
+                                 const btDispatcherInfo& dispatchInfo,
+                                 btManifoldResult* resultOut) override;
+
+  void getAllContactManifolds(btManifoldArray& /*manifoldArray*/) override {}
+
+  struct CreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractOctreeCollisionAlgorithm));
+      return new (mem) TesseractOctreeCollisionAlgorithm(ci, body0Wrap, body1Wrap, false);  // NOLINT
+    }
+  };
+
+  struct SwappedCreateFunc : public btCollisionAlgorithmCreateFunc
+  {
+    btCollisionAlgorithm* CreateCollisionAlgorithm(btCollisionAlgorithmConstructionInfo& ci,
+                                                   const btCollisionObjectWrapper* body0Wrap,
+                                                   const btCollisionObjectWrapper* body1Wrap) override
+    {
+      void* mem = ci.m_dispatcher1->allocateCollisionAlgorithm(sizeof(TesseractOctreeCollisionAlgorithm));
+      return new (mem) TesseractOctreeCollisionAlgorithm(ci, body0Wrap, body1Wrap, true);  // NOLINT
+    }
+  };
+
+private:
+  bool m_isSwapped;
+};
+}  // namespace tesseract::collision::bullet_internal
+#endif  // TESSERACT_COLLISION_TESSERACT_OCTREE_COLLISION_ALGORITHM_H
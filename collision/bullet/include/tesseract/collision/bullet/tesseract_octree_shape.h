@@ -0,0 +1,174 @@
+/**
+ * @file tesseract_octree_shape.h
+ * @brief A Bullet collision shape which traverses an octree instead of flattening it into a compound shape
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_TESSERACT_OCTREE_SHAPE_H
+#define TESSERACT_COLLISION_TESSERACT_OCTREE_SHAPE_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <unordered_set>
+#include <vector>
+#include <octomap/OcTree.h>
+#include <BulletCollision/CollisionShapes/btConcaveShape.h>
+#include <BulletCollision/CollisionShapes/btConvexShape.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/geometry/impl/octree.h>
+
+namespace tesseract::collision::bullet_internal
+{
+/** @brief The callback called for every occupied leaf of a TesseractOctreeShape overlapping the query bounds */
+struct TesseractOctreeLeafCallback
+{
+  virtual ~TesseractOctreeLeafCallback() = default;
+
+  /**
+   * @brief Process an occupied leaf
+   * @param shape The shape of the leaf, shared by every leaf of the same depth
+   * @param local_tf The transform of the leaf relative to the octree
+   * @return False to stop the traversal, otherwise true
+   */
+  virtual bool processLeaf(btConvexShape* shape, const btTransform& local_tf) = 0;
+};
+
+/**
+ * @brief A concave shape which keeps the octree instead of creating a child shape for every occupied leaf
+ *
+ * The octree is traversed from the root for every query and a subtree is skipped when the bounds of its node do not
+ * overlap the query bounds or it has no occupied leaf. The inner nodes with an occupied leaf are found from the leaves
+ * when the shape is created, because the occupancy of the inner nodes is not updated when the octree is built with
+ * lazy_eval. Only one leaf shape is created per octree depth, so the memory used is independent of the number of
+ * occupied leaves.
+ *
+ * The shape is used for continuous collision checking by creating a cast copy with createCastShape(), then every leaf
+ * is swept by the cast transform.
+ */
+class TesseractOctreeShape : public btConcaveShape
+{
+public:
+  using Ptr = std::shared_ptr<TesseractOctreeShape>;
+  using ConstPtr = std::shared_ptr<const TesseractOctreeShape>;
+
+  /**
+   * @brief TesseractOctreeShape
+   * @param octree The octree
+   * @param sub_type The shape used for the occupied leaves
+   */
+  TesseractOctreeShape(std::shared_ptr<const octomap::OcTree> octree, tesseract::geometry::OctreeSubType sub_type);
+
+  /**
+   * @brief Create a copy used for continuous collision checking
+   * @details The copy shares the octree and the leaf shapes, and starts with an identity cast transform
+   * @return The cast copy
+   */
+  Ptr createCastShape() const;
+
+  /** @brief Check if this is a cast shape created by createCastShape() */
+  bool isCast() const;
+
+  /**
+   * @brief Update the cast transform of a cast shape
+   * @param t01 The transform from the start to the end of the cast, relative to the octree
+   */
+  void updateCastTransform(const btTransform& t01);
+
+  /** @brief Get the cast transform */
+  const btTransform& getCastTransform() const;
+
+  /** @brief Get the octree */
+  const std::shared_ptr<const octomap::OcTree>& getOctree() const;
+
+  /** @brief Get the shape used for the occupied leaves */
+  tesseract::geometry::OctreeSubType getSubType() const;
+
+  /**
+   * @brief Check if the subtree of a node of the octree has an occupied leaf
+   * @param node The node
+   * @return True if the node is an occupied leaf or an inner node with an occupied leaf, otherwise false
+   */
+  bool isSubtreeOccupied(const octomap::OcTreeNode* node) const;
+
+  /**
+   * @brief Call the callback for every occupied leaf whose bounds overlap the provided bounds
+   * @details For a cast shape the bounds of a leaf include its position at the end of the cast
+   * @param aabb_min The minimum of the bounds relative to the octree
+   * @param aabb_max The maximum of the bounds relative to the octree
+   * @param callback The callback
+   */
+  void processOccupiedLeaves(const btVector3& aabb_min,
+                             const btVector3& aabb_max,
+                             TesseractOctreeLeafCallback& callback) const;
+
+  void getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const override;
+
+  void processAllTriangles(btTriangleCallback* callback,
+                           const btVector3& aabbMin,
+                           const btVector3& aabbMax) const override;
+
+  void setLocalScaling(const btVector3& scaling) override;
+
+  const btVector3& getLocalScaling() const override;
+
+  void calculateLocalInertia(btScalar mass, btVector3& inertia) const override;
+
+  const char* getName() const override;
+
+private:
+  std::shared_ptr<const octomap::OcTree> octree_;
+  tesseract::geometry::OctreeSubType sub_type_;
+  double occupancy_threshold_;
+
+  /** @brief The shape of the occupied leaves indexed by depth */
+  std::vector<std::shared_ptr<btConvexShape>> leaf_shapes_;
+
+  /** @brief The half extent of the bounds of a node, including the leaf shapes of its subtree, indexed by depth */
+  std::vector<btScalar> node_extents_;
+
+  /** @brief The inner nodes with an occupied leaf in their subtree, shared with the cast copies */
+  std::shared_ptr<const std::unordered_set<const octomap::OcTreeNode*>> occupied_nodes_;
+
+  btVector3 local_aabb_min_;
+  btVector3 local_aabb_max_;
+
+  bool cast_{ false };
+  btTransform cast_tf_;
+
+  /**
+   * @brief Add the inner nodes of the subtree of a node which have an occupied leaf
+   * @return True if the subtree has an occupied leaf, otherwise false
+   */
+  bool findOccupiedNodes(const octomap::OcTreeNode* node, std::unordered_set<const octomap::OcTreeNode*>& nodes) const;
+
+  /**
+   * @brief Process the subtree of a node
+   * @return False if the callback stopped the traversal, otherwise true
+   */
+  bool processNode(const octomap::OcTreeNode* node,
+                   const octomap::OcTreeKey& key,
+                   unsigned depth,
+                   const btVector3& aabb_min,
+                   const btVector3& aabb_max,
+                   TesseractOctreeLeafCallback& callback) const;
+};
+}  // namespace tesseract::collision::bullet_internal
+#endif  // TESSERACT_COLLISION_TESSERACT_OCTREE_SHAPE_H
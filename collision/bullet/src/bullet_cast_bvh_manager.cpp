@@ -38,6 +38,7 @@
  */
 
 #include <tesseract/collision/bullet/bullet_cast_bvh_manager.h>
+#include <tesseract/collision/bullet/tesseract_octree_shape.h>
 #include <tesseract/common/contact_allowed_validator.h>
 
 #include <cassert>
@@ -71,6 +72,8 @@ BulletCastBVHManager::BulletCastBVHManager(std::string name, TesseractCollisionC
   broadphase_->getOverlappingPairCache()->setOverlapFilterCallback(&broadphase_overlap_cb_);
 
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  contact_test_data_.collision_margin_table = &collision_margin_table_;
+  contact_test_data_.statistics = &statistics_;
 }
 
 BulletCastBVHManager::~BulletCastBVHManager()
@@ -166,6 +169,8 @@ bool BulletCastBVHManager::removeCollisionObject(const std::string& name)
     removeCollisionObjectFromBroadphase(cow2, broadphase_, dispatcher_);
     link2castcow_.erase(name);
 
+    updateCollisionObjectIndices();
+
     return true;
   }
 
@@ -295,6 +300,11 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name,
         assert(dynamic_cast<CastHullShape*>(cow->getCollisionShape()) != nullptr);
         static_cast<CastHullShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
       }
+      else if (cow->getCollisionShape()->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+      {
+        assert(dynamic_cast<TesseractOctreeShape*>(cow->getCollisionShape()) != nullptr);
+        static_cast<TesseractOctreeShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
+      }
       else if (btBroadphaseProxy::isCompound(cow->getCollisionShape()->getShapeType()))
       {
         assert(dynamic_cast<btCompoundShape*>(cow->getCollisionShape()) != nullptr);
@@ -310,6 +320,15 @@ void BulletCastBVHManager::setCollisionObjectsTransform(const std::string& name,
             static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
             compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
           }
+          else if (compound->getChildShape(i)->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+          {
+            assert(dynamic_cast<TesseractOctreeShape*>(compound->getChildShape(i)) != nullptr);
+            const btTransform& local_tf = compound->getChildTransform(i);
+
+            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+            static_cast<TesseractOctreeShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
+            compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
+          }
           else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
           {
             assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
@@ -474,11 +493,28 @@ BulletCastBVHManager::getContactAllowedValidator() const
   return contact_test_data_.validator;
 }
 
+const ContactManagerStatistics& BulletCastBVHManager::getStatistics() const { return statistics_; }
+
+void BulletCastBVHManager::resetStatistics() { statistics_.reset(); }
+
 void BulletCastBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ++statistics_.contact_tests;
+  ContactStatisticsScopedTimer total_timer(&statistics_.total_time);
+#endif
+
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
+  contact_test_data_.global_minimum_distance = std::numeric_limits<double>::max();
+  contact_test_data_.global_minimum_key = ContactResultMap::KeyType();
+
+  if (collision_margin_table_dirty_)
+  {
+    collision_margin_table_.build(contact_test_data_.collision_margin_data, collision_objects_);
+    collision_margin_table_dirty_ = false;
+  }
 
   broadphase_->calculateOverlappingPairs(dispatcher_.get());
 
@@ -494,8 +530,10 @@ void BulletCastBVHManager::contactTest(ContactResultMap& collisions, const Conta
 void BulletCastBVHManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->setObjectIndex(static_cast<int>(collision_objects_.size()));
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
+  collision_margin_table_dirty_ = true;
 
   // Create cast collision object
   COW::Ptr cast_cow = makeCastCollisionObject(cow);
@@ -521,10 +559,14 @@ void BulletCastBVHManager::addCollisionObject(const COW::Ptr& cow)
 
 void BulletCastBVHManager::onCollisionMarginDataChanged()
 {
+  collision_margin_table_.build(contact_test_data_.collision_margin_data, collision_objects_);
+  collision_margin_table_dirty_ = false;
+
   for (auto& co : link2cow_)
   {
     COW::Ptr& cow = co.second;
-    auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin(cow->getName()));
+    auto margin = static_cast<btScalar>(
+        collision_margin_table_.getMaxCollisionMargin(static_cast<std::size_t>(cow->getObjectIndex())));
     cow->setContactProcessingThreshold(margin);
     if (cow->getBroadphaseHandle() != nullptr)
       updateBroadphaseAABB(cow, broadphase_, dispatcher_);
@@ -533,11 +575,24 @@ void BulletCastBVHManager::onCollisionMarginDataChanged()
   for (auto& co : link2castcow_)
   {
     COW::Ptr& cow = co.second;
-    auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin(cow->getName()));
+    auto margin = static_cast<btScalar>(
+        collision_margin_table_.getMaxCollisionMargin(static_cast<std::size_t>(cow->getObjectIndex())));
     cow->setContactProcessingThreshold(margin);
     if (cow->getBroadphaseHandle() != nullptr)
       updateBroadphaseAABB(cow, broadphase_, dispatcher_);
   }
 }
 
+void BulletCastBVHManager::updateCollisionObjectIndices()
+{
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+  {
+    const std::string& name = collision_objects_[i];
+    link2cow_[name]->setObjectIndex(static_cast<int>(i));
+    link2castcow_[name]->setObjectIndex(static_cast<int>(i));
+  }
+
+  collision_margin_table_dirty_ = true;
+}
+
 }  // namespace tesseract::collision
@@ -38,6 +38,7 @@
  */
 
 #include <tesseract/collision/bullet/bullet_cast_simple_manager.h>
+#include <tesseract/collision/bullet/tesseract_octree_shape.h>
 #include <tesseract/common/contact_allowed_validator.h>
 
 #include <cassert>
@@ -62,6 +63,8 @@ BulletCastSimpleManager::BulletCastSimpleManager(std::string name, TesseractColl
   dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
                                   ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  contact_test_data_.collision_margin_table = &collision_margin_table_;
+  contact_test_data_.statistics = &statistics_;
 }
 
 std::string BulletCastSimpleManager::getName() const { return name_; }
@@ -141,6 +144,7 @@ bool BulletCastSimpleManager::removeCollisionObject(const std::string& name)
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     link2cow_.erase(name);
     link2castcow_.erase(name);
+    updateCollisionObjectIndices();
     return true;
   }
 
@@ -235,6 +239,11 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& na
         assert(dynamic_cast<CastHullShape*>(cow->getCollisionShape()) != nullptr);
         static_cast<CastHullShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
       }
+      else if (cow->getCollisionShape()->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+      {
+        assert(dynamic_cast<TesseractOctreeShape*>(cow->getCollisionShape()) != nullptr);
+        static_cast<TesseractOctreeShape*>(cow->getCollisionShape())->updateCastTransform(tf1.inverseTimes(tf2));
+      }
       else if (btBroadphaseProxy::isCompound(cow->getCollisionShape()->getShapeType()))
       {
         assert(dynamic_cast<btCompoundShape*>(cow->getCollisionShape()) != nullptr);
@@ -250,6 +259,15 @@ void BulletCastSimpleManager::setCollisionObjectsTransform(const std::string& na
             static_cast<CastHullShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
             compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
           }
+          else if (compound->getChildShape(i)->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+          {
+            assert(dynamic_cast<TesseractOctreeShape*>(compound->getChildShape(i)) != nullptr);
+            const btTransform& local_tf = compound->getChildTransform(i);
+
+            btTransform delta_tf = (tf1 * local_tf).inverseTimes(tf2 * local_tf);
+            static_cast<TesseractOctreeShape*>(compound->getChildShape(i))->updateCastTransform(delta_tf);
+            compound->updateChildTransform(i, local_tf, false);  // This is required to update the BVH tree
+          }
           else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
           {
             assert(dynamic_cast<btCompoundShape*>(compound->getChildShape(i)) != nullptr);
@@ -385,11 +403,28 @@ BulletCastSimpleManager::getContactAllowedValidator() const
 {
   return contact_test_data_.validator;
 }
+
+const ContactManagerStatistics& BulletCastSimpleManager::getStatistics() const { return statistics_; }
+
+void BulletCastSimpleManager::resetStatistics() { statistics_.reset(); }
 void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ++statistics_.contact_tests;
+  ContactStatisticsScopedTimer total_timer(&statistics_.total_time);
+#endif
+
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
+  contact_test_data_.global_minimum_distance = std::numeric_limits<double>::max();
+  contact_test_data_.global_minimum_key = ContactResultMap::KeyType();
+
+  if (collision_margin_table_dirty_)
+  {
+    collision_margin_table_.build(contact_test_data_.collision_margin_data, collision_objects_);
+    collision_margin_table_dirty_ = false;
+  }
 
   for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
   {
@@ -420,10 +455,23 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
 
       if (aabb_check)
       {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+        ++statistics_.broadphase_pairs;
+#endif
+
         bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.validator, false);
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+        if (!needs_collision)
+          ++statistics_.filtered_pairs;
+#endif
 
         if (needs_collision)
         {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+          ++statistics_.narrowphase_pairs;
+          statistics_.addNarrowphaseShapePairs(cow1->getCollisionGeometries(), cow2->getCollisionGeometries());
+#endif
+
           btCollisionObjectWrapper obB(
               nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
 
@@ -433,10 +481,15 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
           if (algorithm != nullptr)
           {
             // Update the contact threshold to be pair specific
-            cc.m_closestDistanceThreshold =
-                contact_test_data_.collision_margin_data.getCollisionMargin(cow1->getName(), cow2->getName());
+            cc.m_closestDistanceThreshold = contact_test_data_.getEffectiveCollisionMargin(
+                collision_margin_table_.getCollisionMargin(static_cast<std::size_t>(cow1->getObjectIndex()),
+                                                           static_cast<std::size_t>(cow2->getObjectIndex())));
             TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
 
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+            ContactStatisticsScopedTimer narrowphase_timer(&statistics_.narrowphase_time);
+#endif
+
             // discrete collision detection query
             algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
 
@@ -458,8 +511,10 @@ void BulletCastSimpleManager::contactTest(ContactResultMap& collisions, const Co
 void BulletCastSimpleManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->setObjectIndex(static_cast<int>(collision_objects_.size()));
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
+  collision_margin_table_dirty_ = true;
 
   // Create cast collision object
   COW::Ptr cast_cow = makeCastCollisionObject(cow);
@@ -476,19 +531,34 @@ void BulletCastSimpleManager::addCollisionObject(const COW::Ptr& cow)
 
 void BulletCastSimpleManager::onCollisionMarginDataChanged()
 {
+  collision_margin_table_.build(contact_test_data_.collision_margin_data, collision_objects_);
+  collision_margin_table_dirty_ = false;
+
   for (auto& co : link2cow_)
   {
-    auto margin =
-        static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin(co.second->getName()));
+    auto margin = static_cast<btScalar>(
+        collision_margin_table_.getMaxCollisionMargin(static_cast<std::size_t>(co.second->getObjectIndex())));
     co.second->setContactProcessingThreshold(margin);
   }
 
   for (auto& co : link2castcow_)
   {
-    auto margin =
-        static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin(co.second->getName()));
+    auto margin = static_cast<btScalar>(
+        collision_margin_table_.getMaxCollisionMargin(static_cast<std::size_t>(co.second->getObjectIndex())));
     co.second->setContactProcessingThreshold(margin);
   }
 }
 
+void BulletCastSimpleManager::updateCollisionObjectIndices()
+{
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+  {
+    const std::string& name = collision_objects_[i];
+    link2cow_[name]->setObjectIndex(static_cast<int>(i));
+    link2castcow_[name]->setObjectIndex(static_cast<int>(i));
+  }
+
+  collision_margin_table_dirty_ = true;
+}
+
 }  // namespace tesseract::collision
@@ -40,6 +40,7 @@
 #include <tesseract/collision/bullet/bullet_discrete_bvh_manager.h>
 #include <tesseract/common/contact_allowed_validator.h>
 
+#include <algorithm>
 #include <cassert>
 
 extern btScalar gDbvtMargin;  // NOLINT
@@ -67,10 +68,16 @@ BulletDiscreteBVHManager::BulletDiscreteBVHManager(std::string name, TesseractCo
   dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
                                   ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
 
-  broadphase_ = std::make_unique<btDbvtBroadphase>();
+  // Defer the overlap search of moved objects to calculateOverlappingPairs, so a batch of transform updates is
+  // followed by a single traversal of the dynamic tree instead of a tree query per moved object.
+  auto broadphase = std::make_unique<btDbvtBroadphase>();
+  broadphase->m_deferedcollide = true;
+  broadphase_ = std::move(broadphase);
   broadphase_->getOverlappingPairCache()->setOverlapFilterCallback(&broadphase_overlap_cb_);
 
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  contact_test_data_.collision_margin_table = &collision_margin_table_;
+  contact_test_data_.statistics = &statistics_;
 }
 
 BulletDiscreteBVHManager::~BulletDiscreteBVHManager()
@@ -104,6 +111,9 @@ DiscreteContactManager::UPtr BulletDiscreteBVHManager::clone() const
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setContactAllowedValidator(contact_test_data_.validator);
+  manager->setContactApproximationType(contact_test_data_.approximation_type);
+  manager->setContactResultCacheEnabled(contact_result_cache_.isEnabled());
+  manager->setNarrowphaseExecutor(narrowphase_executor_);
 
   return manager;
 }
@@ -154,8 +164,11 @@ bool BulletDiscreteBVHManager::removeCollisionObject(const std::string& name)
   if (it != link2cow_.end())
   {
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
+    cows_.erase(std::next(cows_.begin(), it->second->getObjectIndex()));
     removeCollisionObjectFromBroadphase(it->second, broadphase_, dispatcher_);
     link2cow_.erase(name);
+    updateCollisionObjectIndices();
+    contact_result_cache_.invalidate(name);
     return true;
   }
 
@@ -168,6 +181,7 @@ bool BulletDiscreteBVHManager::enableCollisionObject(const std::string& name)
   if (it != link2cow_.end())
   {
     it->second->m_enabled = true;
+    contact_result_cache_.invalidate(name);
 
     // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
     // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like filters
@@ -184,6 +198,7 @@ bool BulletDiscreteBVHManager::disableCollisionObject(const std::string& name)
   if (it != link2cow_.end())
   {
     it->second->m_enabled = false;
+    contact_result_cache_.invalidate(name);
 
     // Need to clean the proxy from broadphase cache so BroadPhaseFilter gets called again.
     // The BroadPhaseFilter only gets called once, so if you change when two objects can be in collision, like filters
@@ -209,13 +224,7 @@ void BulletDiscreteBVHManager::setCollisionObjectsTransform(const std::string& n
   // geometry
   auto it = link2cow_.find(name);
   if (it != link2cow_.end())
-  {
-    COW::Ptr& cow = it->second;
-    cow->setWorldTransform(convertEigenToBt(pose));
-
-    // Update Collision Object Broadphase AABB
-    updateBroadphaseAABB(cow, broadphase_, dispatcher_);
-  }
+    updateCollisionObjectTransform(it->second, pose);
 }
 
 void BulletDiscreteBVHManager::setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -232,11 +241,23 @@ void BulletDiscreteBVHManager::setCollisionObjectsTransform(const tesseract::com
     setCollisionObjectsTransform(transform.first, transform.second);
 }
 
+void BulletDiscreteBVHManager::setCollisionObjectsTransform(const std::vector<std::size_t>& indices,
+                                                            const tesseract::common::VectorIsometry3d& poses)
+{
+  assert(indices.size() == poses.size());
+  for (std::size_t i = 0; i < indices.size(); ++i)
+  {
+    assert(indices[i] < cows_.size());
+    updateCollisionObjectTransform(cows_[indices[i]], poses[i]);
+  }
+}
+
 const std::vector<std::string>& BulletDiscreteBVHManager::getCollisionObjects() const { return collision_objects_; }
 
 void BulletDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
 {
   active_ = names;
+  contact_result_cache_.clear();
 
   // Now need to update the broadphase with correct aabb
   for (auto& co : link2cow_)
@@ -291,17 +312,65 @@ void BulletDiscreteBVHManager::setContactAllowedValidator(
     std::shared_ptr<const tesseract::common::ContactAllowedValidator> validator)
 {
   contact_test_data_.validator = std::move(validator);
+  contact_result_cache_.clear();
 }
 std::shared_ptr<const tesseract::common::ContactAllowedValidator>
 BulletDiscreteBVHManager::getContactAllowedValidator() const
 {
   return contact_test_data_.validator;
 }
+
+const ContactManagerStatistics& BulletDiscreteBVHManager::getStatistics() const { return statistics_; }
+
+void BulletDiscreteBVHManager::resetStatistics() { statistics_.reset(); }
+
+void BulletDiscreteBVHManager::setContactApproximationType(ContactApproximationType type)
+{
+  contact_test_data_.approximation_type = type;
+}
+
+ContactApproximationType BulletDiscreteBVHManager::getContactApproximationType() const
+{
+  return contact_test_data_.approximation_type;
+}
+
+void BulletDiscreteBVHManager::setContactResultCacheEnabled(bool enabled)
+{
+  contact_result_cache_.setEnabled(enabled);
+}
+
+bool BulletDiscreteBVHManager::isContactResultCacheEnabled() const { return contact_result_cache_.isEnabled(); }
+
+void BulletDiscreteBVHManager::setNarrowphaseExecutor(std::shared_ptr<tesseract::common::TaskExecutor> executor)
+{
+  narrowphase_executor_ = std::move(executor);
+}
+
+std::shared_ptr<tesseract::common::TaskExecutor> BulletDiscreteBVHManager::getNarrowphaseExecutor() const
+{
+  return narrowphase_executor_;
+}
+
 void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ++statistics_.contact_tests;
+  ContactStatisticsScopedTimer total_timer(&statistics_.total_time);
+#endif
+
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
+  contact_test_data_.global_minimum_distance = std::numeric_limits<double>::max();
+  contact_test_data_.global_minimum_key = ContactResultMap::KeyType();
+  contact_test_data_.contact_result_cache =
+      contact_result_cache_.beginContactTest(request) ? &contact_result_cache_ : nullptr;
+
+  if (collision_margin_table_dirty_)
+  {
+    collision_margin_table_.build(contact_test_data_.collision_margin_data, collision_objects_);
+    collision_margin_table_dirty_ = false;
+  }
 
   btOverlappingPairCache* pairCache = broadphase_->getOverlappingPairCache();
 
@@ -311,14 +380,87 @@ void BulletDiscreteBVHManager::contactTest(ContactResultMap& collisions, const C
 
   TesseractCollisionPairCallback collisionCallback(dispatch_info_, dispatcher_.get(), cc);
 
-  pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+  if (request.type != ContactTestType::GLOBAL_MINIMUM && narrowphase_executor_ != nullptr)
+  {
+    // Gather the pairs which pass the broadphase and allowed collision checks, then check them in parallel
+    narrowphase_pairs_.clear();
+    collisionCallback.setNarrowphasePairs(&narrowphase_pairs_);
+    pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+
+    const std::size_t block_count = getNarrowphaseBlockCount(*narrowphase_executor_, narrowphase_pairs_.size());
+    while (narrowphase_dispatchers_.size() < block_count)
+      narrowphase_dispatchers_.push_back(std::make_unique<NarrowphaseCollisionDispatcher>(config_info_));
+
+    // The pair algorithms of the manager dispatcher are not thread safe, so every pair is checked with a copy of the
+    // pair whose algorithm is created and released by the dispatcher of its block. Unlike the serial path the algorithm
+    // is not kept in the pair cache, see NarrowphaseCollisionDispatcher.
+    checkNarrowphasePairs(*narrowphase_executor_,
+                          contact_test_data_,
+                          narrowphase_pairs_.size(),
+                          narrowphase_blocks_,
+                          [this](std::size_t block, ContactTestData& block_cdata, std::size_t pair_index) {
+                            btCollisionDispatcher* dispatcher = narrowphase_dispatchers_[block]->getDispatcher();
+                            DiscreteBroadphaseContactResultCallback block_cc(block_cdata);
+                            TesseractCollisionPairCallback block_callback(dispatch_info_, dispatcher, block_cc);
+
+                            btBroadphasePair pair(*narrowphase_pairs_[pair_index]);
+                            pair.m_algorithm = nullptr;
+                            block_callback.processNarrowphase(pair);
+                            if (pair.m_algorithm != nullptr)
+                            {
+                              pair.m_algorithm->~btCollisionAlgorithm();
+                              dispatcher->freeCollisionAlgorithm(pair.m_algorithm);
+                            }
+                          });
+
+    if (contact_test_data_.contact_result_cache != nullptr)
+      contact_result_cache_.endContactTest(collisions);
+
+    return;
+  }
+
+  if (request.type != ContactTestType::GLOBAL_MINIMUM)
+  {
+    pairCache->processAllOverlappingPairs(&collisionCallback, dispatcher_.get());
+    if (contact_test_data_.contact_result_cache != nullptr)
+      contact_result_cache_.endContactTest(collisions);
+
+    return;
+  }
+
+  // Check the closest pairs first so the global minimum shrinks quickly and prunes the remaining pairs
+  btBroadphasePairArray& pairs = pairCache->getOverlappingPairArray();
+  ordered_pairs_.clear();
+  ordered_pairs_.reserve(static_cast<std::size_t>(pairs.size()));
+  for (int i = 0; i < pairs.size(); ++i)
+  {
+    const auto* cow0 = static_cast<const CollisionObjectWrapper*>(pairs[i].m_pProxy0->m_clientObject);
+    const auto* cow1 = static_cast<const CollisionObjectWrapper*>(pairs[i].m_pProxy1->m_clientObject);
+    ordered_pairs_.emplace_back(getAABBDistance(*cow0, *cow1), &pairs[i]);
+  }
+
+  std::stable_sort(ordered_pairs_.begin(), ordered_pairs_.end(), [](const auto& a, const auto& b) {
+    return a.first < b.first;
+  });
+
+  for (const auto& pair : ordered_pairs_)
+  {
+    if (contact_test_data_.done)
+      break;
+
+    collisionCallback.processOverlap(*pair.second);
+  }
 }
 
 void BulletDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->setObjectIndex(static_cast<int>(collision_objects_.size()));
   link2cow_[cow->getName()] = cow;
+  cows_.push_back(cow);
   collision_objects_.push_back(cow->getName());
+  collision_margin_table_dirty_ = true;
+  contact_result_cache_.invalidate(cow->getName());
 
   // Add collision object to broadphase
   addCollisionObjectToBroadphase(cow, broadphase_, dispatcher_);
@@ -326,13 +468,40 @@ void BulletDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
 
 void BulletDiscreteBVHManager::onCollisionMarginDataChanged()
 {
+  collision_margin_table_.build(contact_test_data_.collision_margin_data, collision_objects_);
+  collision_margin_table_dirty_ = false;
+  contact_result_cache_.clear();
+
   for (auto& co : link2cow_)
   {
     COW::Ptr& cow = co.second;
-    auto margin = static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin(cow->getName()));
+    auto margin = static_cast<btScalar>(
+        collision_margin_table_.getMaxCollisionMargin(static_cast<std::size_t>(cow->getObjectIndex())));
     cow->setContactProcessingThreshold(margin);
     assert(cow->getBroadphaseHandle() != nullptr);
     updateBroadphaseAABB(cow, broadphase_, dispatcher_);
   }
 }
+
+void BulletDiscreteBVHManager::updateCollisionObjectIndices()
+{
+  for (std::size_t i = 0; i < cows_.size(); ++i)
+    cows_[i]->setObjectIndex(static_cast<int>(i));
+
+  collision_margin_table_dirty_ = true;
+}
+
+void BulletDiscreteBVHManager::updateCollisionObjectTransform(const COW::Ptr& cow, const Eigen::Isometry3d& pose)
+{
+  const btTransform tf = convertEigenToBt(pose);
+
+  // Calling setAabb moves a proxy back into the dynamic tree of the broadphase, so skip objects which did not move
+  if (tf == cow->getWorldTransform())
+    return;
+
+  cow->setWorldTransform(tf);
+
+  // Update Collision Object Broadphase AABB
+  updateBroadphaseAABB(cow, broadphase_, dispatcher_);
+}
 }  // namespace tesseract::collision
@@ -40,7 +40,9 @@
 #include <tesseract/collision/bullet/bullet_discrete_simple_manager.h>
 #include <tesseract/common/contact_allowed_validator.h>
 
+#include <algorithm>
 #include <cassert>
+#include <optional>
 
 using namespace tesseract::collision::bullet_internal;
 
@@ -64,6 +66,8 @@ BulletDiscreteSimpleManager::BulletDiscreteSimpleManager(std::string name,
                                   ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
 
   contact_test_data_.collision_margin_data = CollisionMarginData(0);
+  contact_test_data_.collision_margin_table = &collision_margin_table_;
+  contact_test_data_.statistics = &statistics_;
 }
 
 std::string BulletDiscreteSimpleManager::getName() const { return name_; }
@@ -90,6 +94,9 @@ DiscreteContactManager::UPtr BulletDiscreteSimpleManager::clone() const
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(contact_test_data_.collision_margin_data);
   manager->setContactAllowedValidator(contact_test_data_.validator);
+  manager->setContactApproximationType(contact_test_data_.approximation_type);
+  manager->setContactResultCacheEnabled(contact_result_cache_.isEnabled());
+  manager->setNarrowphaseExecutor(narrowphase_executor_);
 
   return manager;
 }
@@ -142,6 +149,8 @@ bool BulletDiscreteSimpleManager::removeCollisionObject(const std::string& name)
     cows_.erase(std::find(cows_.begin(), cows_.end(), it->second));
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     link2cow_.erase(name);
+    updateCollisionObjectIndices();
+    contact_result_cache_.invalidate(name);
     return true;
   }
 
@@ -154,6 +163,7 @@ bool BulletDiscreteSimpleManager::enableCollisionObject(const std::string& name)
   if (it != link2cow_.end())
   {
     it->second->m_enabled = true;
+    contact_result_cache_.invalidate(name);
     return true;
   }
   return false;
@@ -165,6 +175,7 @@ bool BulletDiscreteSimpleManager::disableCollisionObject(const std::string& name
   if (it != link2cow_.end())
   {
     it->second->m_enabled = false;
+    contact_result_cache_.invalidate(name);
     return true;
   }
   return false;
@@ -207,6 +218,7 @@ const std::vector<std::string>& BulletDiscreteSimpleManager::getCollisionObjects
 void BulletDiscreteSimpleManager::setActiveCollisionObjects(const std::vector<std::string>& names)
 {
   active_ = names;
+  contact_result_cache_.clear();
 
   cows_.clear();
   cows_.reserve(link2cow_.size());
@@ -269,87 +281,334 @@ void BulletDiscreteSimpleManager::setContactAllowedValidator(
     std::shared_ptr<const tesseract::common::ContactAllowedValidator> validator)
 {
   contact_test_data_.validator = std::move(validator);
+  contact_result_cache_.clear();
 }
 std::shared_ptr<const tesseract::common::ContactAllowedValidator>
 BulletDiscreteSimpleManager::getContactAllowedValidator() const
 {
   return contact_test_data_.validator;
 }
+
+const ContactManagerStatistics& BulletDiscreteSimpleManager::getStatistics() const { return statistics_; }
+
+void BulletDiscreteSimpleManager::resetStatistics() { statistics_.reset(); }
+
+void BulletDiscreteSimpleManager::setContactApproximationType(ContactApproximationType type)
+{
+  contact_test_data_.approximation_type = type;
+}
+
+ContactApproximationType BulletDiscreteSimpleManager::getContactApproximationType() const
+{
+  return contact_test_data_.approximation_type;
+}
+
+void BulletDiscreteSimpleManager::setContactResultCacheEnabled(bool enabled)
+{
+  contact_result_cache_.setEnabled(enabled);
+}
+
+bool BulletDiscreteSimpleManager::isContactResultCacheEnabled() const { return contact_result_cache_.isEnabled(); }
+
+void BulletDiscreteSimpleManager::setNarrowphaseExecutor(std::shared_ptr<tesseract::common::TaskExecutor> executor)
+{
+  narrowphase_executor_ = std::move(executor);
+}
+
+std::shared_ptr<tesseract::common::TaskExecutor> BulletDiscreteSimpleManager::getNarrowphaseExecutor() const
+{
+  return narrowphase_executor_;
+}
+
 void BulletDiscreteSimpleManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ++statistics_.contact_tests;
+  ContactStatisticsScopedTimer total_timer(&statistics_.total_time);
+#endif
+
   contact_test_data_.res = &collisions;
   contact_test_data_.req = request;
   contact_test_data_.done = false;
+  contact_test_data_.global_minimum_distance = std::numeric_limits<double>::max();
+  contact_test_data_.global_minimum_key = ContactResultMap::KeyType();
+  contact_test_data_.contact_result_cache =
+      contact_result_cache_.beginContactTest(request) ? &contact_result_cache_ : nullptr;
 
-  for (auto cow1_iter = cows_.begin(); cow1_iter != (cows_.end() - 1); cow1_iter++)
+  if (collision_margin_table_dirty_)
   {
-    const COW::Ptr& cow1 = *cow1_iter;
+    collision_margin_table_.build(contact_test_data_.collision_margin_data, collision_objects_);
+    collision_margin_table_dirty_ = false;
+  }
 
-    if (cow1->m_collisionFilterGroup != btBroadphaseProxy::KinematicFilter)
-      break;
+  updateBroadphasePairs();
 
-    if (!cow1->m_enabled)
-      continue;
+  // Check the closest pairs first so the global minimum shrinks quickly and prunes the remaining pairs
+  if (request.type == ContactTestType::GLOBAL_MINIMUM)
+    sortBroadphasePairsByAABBDistance();
 
-    btVector3 min_aabb[2], max_aabb[2];  // NOLINT
-    cow1->getAABB(min_aabb[0], max_aabb[0]);
+  // Gather the pairs which need the narrowphase check, then check them in parallel
+  const bool parallel = (narrowphase_executor_ != nullptr && request.type != ContactTestType::GLOBAL_MINIMUM);
+  narrowphase_pairs_.clear();
 
-    btCollisionObjectWrapper obA(nullptr, cow1->getCollisionShape(), cow1.get(), cow1->getWorldTransform(), -1, -1);
+  // The pairs are sorted, so each active collision object is processed in turn like a nested loop over cows_
+  std::size_t cow1_index = cows_.size();
+  std::optional<btCollisionObjectWrapper> obA;
+  std::optional<DiscreteCollisionCollector> cc;
+  for (const auto& pair : broadphase_.pairs)
+  {
+    assert(!contact_test_data_.done);
 
-    DiscreteCollisionCollector cc(contact_test_data_, cow1);
-    for (auto cow2_iter = cow1_iter + 1; cow2_iter != cows_.end(); cow2_iter++)
+    const COW::Ptr& cow1 = cows_[pair.first];
+    const COW::Ptr& cow2 = cows_[pair.second];
+    if (pair.first != cow1_index)
     {
-      assert(!contact_test_data_.done);
+      cow1_index = pair.first;
+      obA.emplace(nullptr, cow1->getCollisionShape(), cow1.get(), cow1->getWorldTransform(), -1, -1);
+      cc.emplace(contact_test_data_, cow1);
+    }
 
-      const COW::Ptr& cow2 = *cow2_iter;
-      cow2->getAABB(min_aabb[1], max_aabb[1]);
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    ++statistics_.broadphase_pairs;
+#endif
 
-      bool aabb_check = (min_aabb[0][0] <= max_aabb[1][0] && max_aabb[0][0] >= min_aabb[1][0]) &&
-                        (min_aabb[0][1] <= max_aabb[1][1] && max_aabb[0][1] >= min_aabb[1][1]) &&
-                        (min_aabb[0][2] <= max_aabb[1][2] && max_aabb[0][2] >= min_aabb[1][2]);
+    bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.validator, false);
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    if (!needs_collision)
+      ++statistics_.filtered_pairs;
+#endif
 
-      if (aabb_check)
+    if (needs_collision && (!isAABBWithinGlobalMinimum(*cow1, *cow2, contact_test_data_) ||
+                            !isApproximationWithinMargin(*cow1, *cow2, contact_test_data_)))
+    {
+      needs_collision = false;
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+      ++statistics_.approximation_filtered_pairs;
+#endif
+    }
+
+    if (needs_collision && contact_test_data_.contact_result_cache != nullptr &&
+        contact_test_data_.contact_result_cache->reuseContactResults(cow1->getName(),
+                                                                     convertBtToEigen(cow1->getWorldTransform()),
+                                                                     cow2->getName(),
+                                                                     convertBtToEigen(cow2->getWorldTransform()),
+                                                                     collisions))
+      needs_collision = false;
+
+    if (needs_collision && parallel)
+    {
+      narrowphase_pairs_.push_back(pair);
+      continue;
+    }
+
+    if (needs_collision)
+    {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+      ++statistics_.narrowphase_pairs;
+      statistics_.addNarrowphaseShapePairs(cow1->getCollisionGeometries(), cow2->getCollisionGeometries());
+#endif
+
+      btCollisionObjectWrapper obB(nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
+
+      btCollisionAlgorithm* algorithm =
+          dispatcher_->findAlgorithm(&(*obA), &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+      assert(algorithm != nullptr);
+      if (algorithm != nullptr)
       {
-        bool needs_collision = needsCollisionCheck(*cow1, *cow2, contact_test_data_.validator, false);
+        // Update the contact threshold to be pair specific
+        cc->m_closestDistanceThreshold = contact_test_data_.getEffectiveCollisionMargin(
+            collision_margin_table_.getCollisionMargin(static_cast<std::size_t>(cow1->getObjectIndex()),
+                                                       static_cast<std::size_t>(cow2->getObjectIndex())));
+        TesseractBridgedManifoldResult contactPointResult(&(*obA), &obB, *cc);
+
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+        ContactStatisticsScopedTimer narrowphase_timer(&statistics_.narrowphase_time);
+#endif
+
+        // discrete collision detection query
+        algorithm->processCollision(&(*obA), &obB, dispatch_info_, &contactPointResult);
+
+        algorithm->~btCollisionAlgorithm();
+        dispatcher_->freeCollisionAlgorithm(algorithm);
+      }
+    }
+
+    if (contact_test_data_.done)
+      break;
+  }
 
-        if (needs_collision)
-        {
+  if (parallel)
+  {
+    const std::size_t block_count = getNarrowphaseBlockCount(*narrowphase_executor_, narrowphase_pairs_.size());
+    while (narrowphase_dispatchers_.size() < block_count)
+      narrowphase_dispatchers_.push_back(std::make_unique<NarrowphaseCollisionDispatcher>(config_info_));
+
+    checkNarrowphasePairs(
+        *narrowphase_executor_,
+        contact_test_data_,
+        narrowphase_pairs_.size(),
+        narrowphase_blocks_,
+        [this](std::size_t block, ContactTestData& block_cdata, std::size_t pair_index) {
+          const COW::Ptr& cow1 = cows_[narrowphase_pairs_[pair_index].first];
+          const COW::Ptr& cow2 = cows_[narrowphase_pairs_[pair_index].second];
+
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+          ++block_cdata.statistics->narrowphase_pairs;
+          block_cdata.statistics->addNarrowphaseShapePairs(cow1->getCollisionGeometries(),
+                                                           cow2->getCollisionGeometries());
+#endif
+
+          btCollisionObjectWrapper obA(
+              nullptr, cow1->getCollisionShape(), cow1.get(), cow1->getWorldTransform(), -1, -1);
           btCollisionObjectWrapper obB(
               nullptr, cow2->getCollisionShape(), cow2.get(), cow2->getWorldTransform(), -1, -1);
 
-          btCollisionAlgorithm* algorithm =
-              dispatcher_->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+          btCollisionDispatcher* dispatcher = narrowphase_dispatchers_[block]->getDispatcher();
+          btCollisionAlgorithm* algorithm = dispatcher->findAlgorithm(&obA, &obB, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
           assert(algorithm != nullptr);
           if (algorithm != nullptr)
           {
-            // Update the contact threshold to be pair specific
-            cc.m_closestDistanceThreshold =
-                contact_test_data_.collision_margin_data.getCollisionMargin(cow1->getName(), cow2->getName());
+            DiscreteCollisionCollector cc(block_cdata, cow1);
+            cc.m_closestDistanceThreshold = block_cdata.getEffectiveCollisionMargin(
+                collision_margin_table_.getCollisionMargin(static_cast<std::size_t>(cow1->getObjectIndex()),
+                                                           static_cast<std::size_t>(cow2->getObjectIndex())));
             TesseractBridgedManifoldResult contactPointResult(&obA, &obB, cc);
 
             // discrete collision detection query
             algorithm->processCollision(&obA, &obB, dispatch_info_, &contactPointResult);
 
             algorithm->~btCollisionAlgorithm();
-            dispatcher_->freeCollisionAlgorithm(algorithm);
+            dispatcher->freeCollisionAlgorithm(algorithm);
           }
-        }
-      }
+        });
+  }
+
+  if (contact_test_data_.contact_result_cache != nullptr)
+    contact_result_cache_.endContactTest(collisions);
+}
+
+void BulletDiscreteSimpleManager::sortBroadphasePairsByAABBDistance()
+{
+  BroadphaseData& data = broadphase_;
+  data.pair_distances.clear();
+  data.pair_distances.reserve(data.pairs.size());
+  for (const auto& pair : data.pairs)
+    data.pair_distances.emplace_back(getAABBDistance(*cows_[pair.first], *cows_[pair.second]), pair);
+
+  std::stable_sort(data.pair_distances.begin(),
+                   data.pair_distances.end(),
+                   [](const auto& a, const auto& b) { return a.first < b.first; });
+
+  for (std::size_t i = 0; i < data.pairs.size(); ++i)
+    data.pairs[i] = data.pair_distances[i].second;
+}
+
+void BulletDiscreteSimpleManager::updateBroadphasePairs()
+{
+  BroadphaseData& data = broadphase_;
+  data.pairs.clear();
+
+  // Gather the AABB of every enabled collision object once
+  std::vector<BroadphaseData::Entry>& entries = data.entries;
+  entries.clear();
+  bool has_active{ false };
+  for (std::size_t i = 0; i < cows_.size(); ++i)
+  {
+    const COW::Ptr& cow = cows_[i];
+    if (!cow->m_enabled)
+      continue;
+
+    btVector3 aabb_min, aabb_max;
+    cow->getAABB(aabb_min, aabb_max);
+    entries.push_back({ { aabb_min[0], aabb_min[1], aabb_min[2] }, { aabb_max[0], aabb_max[1], aabb_max[2] }, i });
+    has_active |= (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter);
+  }
 
-      if (contact_test_data_.done)
-        break;
+  if (!has_active || entries.size() < 2)
+    return;
+
+  std::sort(entries.begin(), entries.end(), [](const BroadphaseData::Entry& a, const BroadphaseData::Entry& b) {
+    return a.min[0] < b.min[0];
+  });
+
+  const std::size_t n = entries.size();
+  data.min_x.resize(n);
+  data.max_x.resize(n);
+  data.min_y.resize(n);
+  data.max_y.resize(n);
+  data.min_z.resize(n);
+  data.max_z.resize(n);
+  data.cow_indices.resize(n);
+  data.overlap.resize(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const BroadphaseData::Entry& entry = entries[i];
+    data.min_x[i] = entry.min[0];
+    data.max_x[i] = entry.max[0];
+    data.min_y[i] = entry.min[1];
+    data.max_y[i] = entry.max[1];
+    data.min_z[i] = entry.min[2];
+    data.max_z[i] = entry.max[2];
+    data.cow_indices[i] = entry.cow_index;
+  }
+
+  // Active collision objects are stored first in cows_, so a pair where the first is static has no active object
+  std::size_t active_end = 0;
+  while (active_end < cows_.size() && cows_[active_end]->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
+    ++active_end;
+
+  for (std::size_t i = 0; i + 1 < n; ++i)
+  {
+    // Since the objects are sorted by minimum x, only the following objects starting before this one ends overlap in x
+    const btScalar max_x = data.max_x[i];
+    std::size_t end = i + 1;
+    while (end < n && data.min_x[end] <= max_x)
+      ++end;
+
+    // Branch free so the compiler can vectorize the overlap test of the candidates
+    const btScalar min_y = data.min_y[i];
+    const btScalar max_y = data.max_y[i];
+    const btScalar min_z = data.min_z[i];
+    const btScalar max_z = data.max_z[i];
+    const btScalar* c_min_y = data.min_y.data();
+    const btScalar* c_max_y = data.max_y.data();
+    const btScalar* c_min_z = data.min_z.data();
+    const btScalar* c_max_z = data.max_z.data();
+    std::uint8_t* overlap = data.overlap.data();
+    for (std::size_t j = i + 1; j < end; ++j)
+    {
+      overlap[j] = static_cast<std::uint8_t>(static_cast<unsigned>(min_y <= c_max_y[j]) &
+                                             static_cast<unsigned>(max_y >= c_min_y[j]) &
+                                             static_cast<unsigned>(min_z <= c_max_z[j]) &
+                                             static_cast<unsigned>(max_z >= c_min_z[j]));
     }
 
-    if (contact_test_data_.done)
-      break;
+    const std::size_t cow_index = data.cow_indices[i];
+    for (std::size_t j = i + 1; j < end; ++j)
+    {
+      if (overlap[j] == 0)
+        continue;
+
+      const std::size_t other_cow_index = data.cow_indices[j];
+      if (std::min(cow_index, other_cow_index) >= active_end)
+        continue;
+
+      data.pairs.emplace_back(std::min(cow_index, other_cow_index), std::max(cow_index, other_cow_index));
+    }
   }
+
+  // Process the pairs in the same order as a nested loop over cows_ so the results do not depend on the AABBs
+  std::sort(data.pairs.begin(), data.pairs.end());
 }
 
 void BulletDiscreteSimpleManager::addCollisionObject(const COW::Ptr& cow)
 {
   cow->setUserPointer(&contact_test_data_);
+  cow->setObjectIndex(static_cast<int>(collision_objects_.size()));
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
+  collision_margin_table_dirty_ = true;
+  contact_result_cache_.invalidate(cow->getName());
 
   if (cow->m_collisionFilterGroup == btBroadphaseProxy::KinematicFilter)
     cows_.insert(cows_.begin(), cow);
@@ -359,12 +618,24 @@ void BulletDiscreteSimpleManager::addCollisionObject(const COW::Ptr& cow)
 
 void BulletDiscreteSimpleManager::onCollisionMarginDataChanged()
 {
+  collision_margin_table_.build(contact_test_data_.collision_margin_data, collision_objects_);
+  collision_margin_table_dirty_ = false;
+  contact_result_cache_.clear();
+
   for (auto& co : link2cow_)
   {
-    auto margin =
-        static_cast<btScalar>(contact_test_data_.collision_margin_data.getMaxCollisionMargin(co.second->getName()));
+    auto margin = static_cast<btScalar>(
+        collision_margin_table_.getMaxCollisionMargin(static_cast<std::size_t>(co.second->getObjectIndex())));
     co.second->setContactProcessingThreshold(margin);
   }
 }
 
+void BulletDiscreteSimpleManager::updateCollisionObjectIndices()
+{
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+    link2cow_[collision_objects_[i]]->setObjectIndex(static_cast<int>(i));
+
+  collision_margin_table_dirty_ = true;
+}
+
 }  // namespace tesseract::collision
@@ -41,6 +41,7 @@
 
 #include <tesseract/collision/bullet/bullet_utils.h>
 #include <tesseract/collision/bullet/bullet_collision_shape_cache.h>
+#include <tesseract/collision/bullet/tesseract_octree_shape.h>
 
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <LinearMath/btConvexHullComputer.h>
@@ -50,11 +51,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/thread/mutex.hpp>
 #include <memory>
 #include <stdexcept>
-#include <octomap/octomap.h>
 #include <cassert>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/geometry/geometries.h>
+#include <tesseract/collision/contact_result_cache.h>
 
 namespace tesseract::collision::bullet_internal
 {
@@ -211,124 +212,13 @@ std::shared_ptr<BulletCollisionShape> createShapePrimitive(const tesseract::geom
 
 std::shared_ptr<BulletCollisionShape> createShapePrimitive(const tesseract::geometry::Octree::ConstPtr& geom)
 {
-  const octomap::OcTree& octree = *(geom->getOctree());
-  double occupancy_threshold = octree.getOccupancyThres();
-  auto subshape = std::make_shared<btCompoundShape>(BULLET_COMPOUND_USE_DYNAMIC_AABB, static_cast<int>(octree.size()));
-
-  std::vector<std::shared_ptr<btCollisionShape>> managed_shapes;
-  managed_shapes.resize(octree.getTreeDepth() + 1);
   switch (geom->getSubType())
   {
     case tesseract::geometry::OctreeSubType::BOX:
-    {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-          auto length = static_cast<btScalar>(size / 2.0);
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape = std::make_shared<btBoxShape>(btVector3(length, length, length));
-            childshape->setMargin(BULLET_MARGIN);
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      auto collision_shape = std::make_shared<BulletCollisionShape>();
-      collision_shape->top_level = subshape;
-      collision_shape->children.reserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          collision_shape->children.push_back(managed_shape);
-      }
-
-      return collision_shape;
-    }
     case tesseract::geometry::OctreeSubType::SPHERE_INSIDE:
-    {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape = std::make_shared<btSphereShape>(static_cast<btScalar>((size / 2)));
-            // Sphere is a special case where you do not modify the margin which is internally set to the radius
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      auto collision_shape = std::make_shared<BulletCollisionShape>();
-      collision_shape->top_level = subshape;
-      collision_shape->children.reserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          collision_shape->children.push_back(managed_shape);
-      }
-
-      return collision_shape;
-    }
     case tesseract::geometry::OctreeSubType::SPHERE_OUTSIDE:
-    {
-      for (auto it = octree.begin(static_cast<unsigned char>(octree.getTreeDepth())), end = octree.end(); it != end;
-           ++it)
-      {
-        if (it->getOccupancy() >= occupancy_threshold)
-        {
-          double size = it.getSize();
-          btTransform geomTrans;
-          geomTrans.setIdentity();
-          geomTrans.setOrigin(btVector3(
-              static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ())));
-
-          std::shared_ptr<btCollisionShape> childshape = managed_shapes.at(it.getDepth());
-          if (childshape == nullptr)
-          {
-            childshape =
-                std::make_shared<btSphereShape>(static_cast<btScalar>(std::sqrt(2 * ((size / 2) * (size / 2)))));
-            // Sphere is a special case where you do not modify the margin which is internally set to the radius
-            managed_shapes.at(it.getDepth()) = childshape;
-          }
-
-          subshape->addChildShape(geomTrans, childshape.get());
-        }
-      }
-
-      auto collision_shape = std::make_shared<BulletCollisionShape>();
-      collision_shape->top_level = subshape;
-      collision_shape->children.reserve(managed_shapes.size());
-      for (const auto& managed_shape : managed_shapes)
-      {
-        if (managed_shape != nullptr)
-          collision_shape->children.push_back(managed_shape);
-      }
-
-      return collision_shape;
-    }
+      return std::make_shared<BulletCollisionShape>(
+          std::make_shared<TesseractOctreeShape>(geom->getOctree(), geom->getSubType()));
   }
 
   CONSOLE_BRIDGE_logError("This bullet shape type (%d) is not supported for geometry octree",
@@ -499,6 +389,8 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
     }
   }
 
+  m_bounding_spheres = computeBoundingSpheres(m_shapes, m_shape_poses);
+
   btTransform trans;
   trans.setIdentity();
   setWorldTransform(trans);
@@ -508,6 +400,10 @@ const std::string& CollisionObjectWrapper::getName() const { return m_name; }
 
 const int& CollisionObjectWrapper::getTypeID() const { return m_type_id; }
 
+int CollisionObjectWrapper::getObjectIndex() const { return m_object_index; }
+
+void CollisionObjectWrapper::setObjectIndex(int index) { m_object_index = index; }
+
 bool CollisionObjectWrapper::sameObject(const CollisionObjectWrapper& other) const
 {
   return m_name == other.m_name && m_type_id == other.m_type_id && m_shapes.size() == other.m_shapes.size() &&
@@ -526,6 +422,8 @@ const tesseract::common::VectorIsometry3d& CollisionObjectWrapper::getCollisionG
   return m_shape_poses;
 }
 
+const BoundingSpheres& CollisionObjectWrapper::getBoundingSpheres() const { return m_bounding_spheres; }
+
 void CollisionObjectWrapper::getAABB(btVector3& aabb_min, btVector3& aabb_max) const
 {
   getCollisionShape()->getAabb(getWorldTransform(), aabb_min, aabb_max);
@@ -540,8 +438,10 @@ std::shared_ptr<CollisionObjectWrapper> CollisionObjectWrapper::clone()
   auto clone_cow = std::make_shared<CollisionObjectWrapper>();
   clone_cow->m_name = m_name;
   clone_cow->m_type_id = m_type_id;
+  clone_cow->m_object_index = m_object_index;
   clone_cow->m_shapes = m_shapes;
   clone_cow->m_shape_poses = m_shape_poses;
+  clone_cow->m_bounding_spheres = m_bounding_spheres;
   clone_cow->m_data = m_data;
   clone_cow->setCollisionShape(getCollisionShape());
   clone_cow->setWorldTransform(getWorldTransform());
@@ -706,6 +606,42 @@ bool needsCollisionCheck(const COW& cow1,
          !isContactAllowed(cow1.getName(), cow2.getName(), validator, verbose);
 }
 
+bool isApproximationWithinMargin(const COW& cow1, const COW& cow2, const ContactTestData& cdata)
+{
+  if (cdata.approximation_type == ContactApproximationType::NONE)
+    return true;
+
+  const double margin = cdata.getEffectiveCollisionMargin(
+      cdata.getCollisionMargin(cow1.getObjectIndex(), cow1.getName(), cow2.getObjectIndex(), cow2.getName()));
+  return isBoundingSpheresWithinMargin(cow1.getBoundingSpheres(),
+                                       convertBtToEigen(cow1.getWorldTransform()),
+                                       cow2.getBoundingSpheres(),
+                                       convertBtToEigen(cow2.getWorldTransform()),
+                                       margin);
+}
+
+double getAABBDistance(const COW& cow1, const COW& cow2)
+{
+  btVector3 aabb_min1, aabb_max1, aabb_min2, aabb_max2;
+  cow1.getCollisionShape()->getAabb(cow1.getWorldTransform(), aabb_min1, aabb_max1);
+  cow2.getCollisionShape()->getAabb(cow2.getWorldTransform(), aabb_min2, aabb_max2);
+
+  // The gap along each axis, negative if the boxes overlap along that axis
+  btVector3 gap = aabb_min2 - aabb_max1;
+  gap.setMax(aabb_min1 - aabb_max2);
+  gap.setMax(btVector3(0, 0, 0));
+  return static_cast<double>(gap.length());
+}
+
+bool isAABBWithinGlobalMinimum(const COW& cow1, const COW& cow2, const ContactTestData& cdata)
+{
+  if (cdata.req.type != ContactTestType::GLOBAL_MINIMUM)
+    return true;
+
+  const double distance = getAABBDistance(cow1, cow2);
+  return (distance <= 0 || distance < cdata.global_minimum_distance);
+}
+
 btScalar addDiscreteSingleResult(btManifoldPoint& cp,
                                  const btCollisionObjectWrapper* colObj0Wrap,
                                  int index0,
@@ -765,7 +701,9 @@ btScalar addDiscreteSingleResult(btManifoldPoint& cp,
   contact.distance = static_cast<double>(cp.m_distance1);
   contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
 
-  if (processResult(collisions, contact, key, found) == nullptr)
+  const double margin =
+      collisions.getCollisionMargin(cd0->getObjectIndex(), cd0->getName(), cd1->getObjectIndex(), cd1->getName());
+  if (processResult(collisions, contact, key, found, margin) == nullptr)
     return 0;
 
   return 1;
@@ -905,7 +843,9 @@ btScalar addCastSingleResult(btManifoldPoint& cp,
   contact.distance = static_cast<double>(cp.m_distance1);
   contact.normal = convertBtToEigen(-1 * cp.m_normalWorldOnB);
 
-  ContactResult* col = processResult(collisions, contact, key, found);
+  const double margin =
+      collisions.getCollisionMargin(cd0->getObjectIndex(), cd0->getName(), cd1->getObjectIndex(), cd1->getName());
+  ContactResult* col = processResult(collisions, contact, key, found, margin);
   if (col == nullptr)
     return 0;
 
@@ -1006,7 +946,19 @@ BroadphaseContactResultCallback::BroadphaseContactResultCallback(ContactTestData
 bool BroadphaseContactResultCallback::needsCollision(const CollisionObjectWrapper* cow0,
                                                      const CollisionObjectWrapper* cow1) const
 {
-  return !collisions_.done && needsCollisionCheck(*cow0, *cow1, collisions_.validator, verbose_);
+  if (collisions_.done)
+    return false;
+
+  if (!needsCollisionCheck(*cow0, *cow1, collisions_.validator, verbose_))
+  {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    if (collisions_.statistics != nullptr)
+      ++collisions_.statistics->filtered_pairs;
+#endif
+    return false;
+  }
+
+  return true;
 }
 
 DiscreteBroadphaseContactResultCallback::DiscreteBroadphaseContactResultCallback(ContactTestData& collisions,
@@ -1015,6 +967,24 @@ DiscreteBroadphaseContactResultCallback::DiscreteBroadphaseContactResultCallback
 {
 }
 
+bool DiscreteBroadphaseContactResultCallback::needsCollision(const CollisionObjectWrapper* cow0,
+                                                             const CollisionObjectWrapper* cow1) const
+{
+  if (!BroadphaseContactResultCallback::needsCollision(cow0, cow1))
+    return false;
+
+  if (!isAABBWithinGlobalMinimum(*cow0, *cow1, collisions_) || !isApproximationWithinMargin(*cow0, *cow1, collisions_))
+  {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    if (collisions_.statistics != nullptr)
+      ++collisions_.statistics->approximation_filtered_pairs;
+#endif
+    return false;
+  }
+
+  return true;
+}
+
 btScalar DiscreteBroadphaseContactResultCallback::addSingleResult(btManifoldPoint& cp,
                                                                   const btCollisionObjectWrapper* colObj0Wrap,
                                                                   int /*partId0*/,
@@ -1062,8 +1032,9 @@ TesseractBroadphaseBridgedManifoldResult::TesseractBroadphaseBridgedManifoldResu
   assert(dynamic_cast<const CollisionObjectWrapper*>(m_body1Wrap->getCollisionObject()) != nullptr);  // NOLINT
   const auto* cd0 = static_cast<const CollisionObjectWrapper*>(m_body0Wrap->getCollisionObject());    // NOLINT
   const auto* cd1 = static_cast<const CollisionObjectWrapper*>(m_body1Wrap->getCollisionObject());    // NOLINT
-  m_closestPointDistanceThreshold =
-      result_callback_.collisions_.collision_margin_data.getCollisionMargin(cd0->getName(), cd1->getName());
+  m_closestPointDistanceThreshold = result_callback_.collisions_.getEffectiveCollisionMargin(
+      result_callback_.collisions_.getCollisionMargin(
+          cd0->getObjectIndex(), cd0->getName(), cd1->getObjectIndex(), cd1->getName()));
 }
 
 void TesseractBroadphaseBridgedManifoldResult::addContactPoint(const btVector3& normalOnBInWorld,
@@ -1130,28 +1101,71 @@ bool TesseractCollisionPairCallback::processOverlap(btBroadphasePair& pair)
   const auto* cow0 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy0->m_clientObject);
   const auto* cow1 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy1->m_clientObject);
 
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ContactManagerStatistics* stats = results_callback_.collisions_.statistics;
+  if (stats != nullptr)
+    ++stats->broadphase_pairs;
+#endif
+
   if (results_callback_.needsCollision(cow0, cow1))
   {
-    btCollisionObjectWrapper obj0Wrap(nullptr, cow0->getCollisionShape(), cow0, cow0->getWorldTransform(), -1, -1);
-    btCollisionObjectWrapper obj1Wrap(nullptr, cow1->getCollisionShape(), cow1, cow1->getWorldTransform(), -1, -1);
+    ContactTestData& cdata = results_callback_.collisions_;
+    if (cdata.contact_result_cache != nullptr &&
+        cdata.contact_result_cache->reuseContactResults(cow0->getName(),
+                                                        convertBtToEigen(cow0->getWorldTransform()),
+                                                        cow1->getName(),
+                                                        convertBtToEigen(cow1->getWorldTransform()),
+                                                        *cdata.res))
+      return false;
+
+    if (narrowphase_pairs_ != nullptr)
+      narrowphase_pairs_->push_back(&pair);
+    else
+      processNarrowphase(pair);
+  }
+  return false;
+}
 
-    // dispatcher will keep algorithms persistent in the collision pair
-    if (pair.m_algorithm == nullptr)
-    {
-      pair.m_algorithm = dispatcher_->findAlgorithm(&obj0Wrap, &obj1Wrap, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
-    }
+void TesseractCollisionPairCallback::setNarrowphasePairs(std::vector<btBroadphasePair*>* pairs)
+{
+  narrowphase_pairs_ = pairs;
+}
 
-    if (pair.m_algorithm != nullptr)
-    {
-      TesseractBroadphaseBridgedManifoldResult contactPointResult(&obj0Wrap, &obj1Wrap, results_callback_);
-      contactPointResult.m_closestPointDistanceThreshold =
-          results_callback_.collisions_.collision_margin_data.getCollisionMargin(cow0->getName(), cow1->getName());
+void TesseractCollisionPairCallback::processNarrowphase(btBroadphasePair& pair)
+{
+  const auto* cow0 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy0->m_clientObject);
+  const auto* cow1 = static_cast<const CollisionObjectWrapper*>(pair.m_pProxy1->m_clientObject);
 
-      // discrete collision detection query
-      pair.m_algorithm->processCollision(&obj0Wrap, &obj1Wrap, dispatch_info_, &contactPointResult);
-    }
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ContactManagerStatistics* stats = results_callback_.collisions_.statistics;
+  if (stats != nullptr)
+  {
+    ++stats->narrowphase_pairs;
+    stats->addNarrowphaseShapePairs(cow0->getCollisionGeometries(), cow1->getCollisionGeometries());
+  }
+#endif
+
+  btCollisionObjectWrapper obj0Wrap(nullptr, cow0->getCollisionShape(), cow0, cow0->getWorldTransform(), -1, -1);
+  btCollisionObjectWrapper obj1Wrap(nullptr, cow1->getCollisionShape(), cow1, cow1->getWorldTransform(), -1, -1);
+
+  // dispatcher will keep algorithms persistent in the collision pair
+  if (pair.m_algorithm == nullptr)
+  {
+    pair.m_algorithm = dispatcher_->findAlgorithm(&obj0Wrap, &obj1Wrap, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+  }
+
+  if (pair.m_algorithm != nullptr)
+  {
+    // The pair specific contact threshold is assigned in the constructor
+    TesseractBroadphaseBridgedManifoldResult contactPointResult(&obj0Wrap, &obj1Wrap, results_callback_);
+
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    ContactStatisticsScopedTimer narrowphase_timer((stats != nullptr) ? &stats->narrowphase_time : nullptr);
+#endif
+
+    // discrete collision detection query
+    pair.m_algorithm->processCollision(&obj0Wrap, &obj1Wrap, dispatch_info_, &contactPointResult);
   }
-  return false;
 }
 
 TesseractOverlapFilterCallback::TesseractOverlapFilterCallback(bool verbose) : verbose_(verbose) {}
@@ -1274,6 +1288,16 @@ COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
     new_cow->manage(std::make_shared<BulletCollisionShape>(shape));
     new_cow->setCollisionShape(shape.get());
   }
+  else if (new_cow->getCollisionShape()->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+  {
+    assert(dynamic_cast<TesseractOctreeShape*>(new_cow->getCollisionShape()) != nullptr);
+    auto* octree = static_cast<TesseractOctreeShape*>(new_cow->getCollisionShape());  // NOLINT
+    assert(!octree->isCast());  // This checks if the collision object is already a cast collision object
+
+    std::shared_ptr<TesseractOctreeShape> shape = octree->createCastShape();
+    new_cow->manage(std::make_shared<BulletCollisionShape>(shape));
+    new_cow->setCollisionShape(shape.get());
+  }
   else if (btBroadphaseProxy::isCompound(new_cow->getCollisionShape()->getShapeType()))
   {
     assert(dynamic_cast<btCompoundShape*>(new_cow->getCollisionShape()) != nullptr);
@@ -1300,6 +1324,17 @@ COW::Ptr makeCastCollisionObject(const COW::Ptr& cow)
         subshape->setMargin(BULLET_MARGIN);
         new_compound->addChildShape(geomTrans, subshape.get());
       }
+      else if (compound->getChildShape(i)->getShapeType() == CUSTOM_CONCAVE_SHAPE_TYPE)
+      {
+        auto* octree = static_cast<TesseractOctreeShape*>(compound->getChildShape(i));  // NOLINT
+        assert(!octree->isCast());  // This checks if already a cast collision object
+
+        btTransform geomTrans = compound->getChildTransform(i);
+
+        std::shared_ptr<TesseractOctreeShape> subshape = octree->createCastShape();
+        collision_shape->children.push_back(subshape);
+        new_compound->addChildShape(geomTrans, subshape.get());
+      }
       else if (btBroadphaseProxy::isCompound(compound->getChildShape(i)->getShapeType()))
       {
         auto* second_compound = static_cast<btCompoundShape*>(compound->getChildShape(i));  // NOLINT
@@ -39,6 +39,8 @@
 
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <BulletCollision/BroadphaseCollision/btBroadphaseProxy.h>
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcher.h>
 #include <BulletCollision/CollisionDispatch/btConvexConcaveCollisionAlgorithm.h>
 #include <LinearMath/btPoolAllocator.h>
 #include <cassert>
@@ -48,6 +50,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract/collision/bullet/tesseract_compound_collision_algorithm.h>
 #include <tesseract/collision/bullet/tesseract_compound_compound_collision_algorithm.h>
 #include <tesseract/collision/bullet/tesseract_convex_convex_algorithm.h>
+#include <tesseract/collision/bullet/tesseract_octree_collision_algorithm.h>
 
 using namespace tesseract::collision::bullet_internal;
 
@@ -90,11 +93,13 @@ void TesseractCollisionConfigurationInfo::createPoolAllocators()
   int maxSize2 = sizeof(btConvexConcaveCollisionAlgorithm);
   int maxSize3 = sizeof(TesseractCompoundCollisionAlgorithm);
   int maxSize4 = sizeof(TesseractCompoundCompoundCollisionAlgorithm);
+  int maxSize5 = sizeof(TesseractOctreeCollisionAlgorithm);
 
   int collisionAlgorithmMaxElementSize = btMax(maxSize, m_customCollisionAlgorithmMaxElementSize);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize2);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize3);
   collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize4);
+  collisionAlgorithmMaxElementSize = btMax(collisionAlgorithmMaxElementSize, maxSize5);
 
   TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
   collisionAlgorithmMaxElementSize = (collisionAlgorithmMaxElementSize + 16) & 0xffffffffffff0;  // NOLINT
@@ -107,6 +112,8 @@ void TesseractCollisionConfigurationInfo::createPoolAllocators()
 
 TesseractCollisionConfiguration::TesseractCollisionConfiguration(const TesseractCollisionConfigurationInfo& config_info)
   : btDefaultCollisionConfiguration(config_info)
+  , octree_create_func_(std::make_unique<TesseractOctreeCollisionAlgorithm::CreateFunc>())
+  , swapped_octree_create_func_(std::make_unique<TesseractOctreeCollisionAlgorithm::SwappedCreateFunc>())
 {
   assert(config_info.m_collisionAlgorithmPool != nullptr);
   assert(config_info.m_persistentManifoldPool != nullptr);
@@ -151,4 +158,63 @@ TesseractCollisionConfiguration::TesseractCollisionConfiguration(const Tesseract
   m_swappedCompoundCreateFunc = new (mem) TesseractCompoundCollisionAlgorithm::SwappedCreateFunc;  // NOLINT
 }
 
+TesseractCollisionConfiguration::~TesseractCollisionConfiguration() = default;
+
+btCollisionAlgorithmCreateFunc* TesseractCollisionConfiguration::getCollisionAlgorithmCreateFunc(int proxyType0,
+                                                                                                 int proxyType1)
+{
+  btCollisionAlgorithmCreateFunc* create_func = getOctreeAlgorithmCreateFunc(proxyType0, proxyType1);
+  if (create_func != nullptr)
+    return create_func;
+
+  return btDefaultCollisionConfiguration::getCollisionAlgorithmCreateFunc(proxyType0, proxyType1);
+}
+
+btCollisionAlgorithmCreateFunc* TesseractCollisionConfiguration::getClosestPointsAlgorithmCreateFunc(int proxyType0,
+                                                                                                     int proxyType1)
+{
+  btCollisionAlgorithmCreateFunc* create_func = getOctreeAlgorithmCreateFunc(proxyType0, proxyType1);
+  if (create_func != nullptr)
+    return create_func;
+
+  return btDefaultCollisionConfiguration::getClosestPointsAlgorithmCreateFunc(proxyType0, proxyType1);
+}
+
+btCollisionAlgorithmCreateFunc* TesseractCollisionConfiguration::getOctreeAlgorithmCreateFunc(int proxyType0,
+                                                                                              int proxyType1) const
+{
+  // The compound algorithms take precedence so octrees which are children of a compound are dispatched per child
+  if (btBroadphaseProxy::isCompound(proxyType0) || btBroadphaseProxy::isCompound(proxyType1))
+    return nullptr;
+
+  if (proxyType0 == CUSTOM_CONCAVE_SHAPE_TYPE)
+    return octree_create_func_.get();
+
+  if (proxyType1 == CUSTOM_CONCAVE_SHAPE_TYPE)
+    return swapped_octree_create_func_.get();
+
+  return nullptr;
+}
+
+NarrowphaseCollisionDispatcher::NarrowphaseCollisionDispatcher(const TesseractCollisionConfigurationInfo& config_info)
+  : config_info_(config_info)
+{
+  // The pool allocators may be shared with the contact manager, so always create new ones
+  config_info_.createPoolAllocators();
+  coll_config_ = std::make_unique<TesseractCollisionConfiguration>(config_info_);
+  dispatcher_ = std::make_unique<btCollisionDispatcher>(coll_config_.get());
+
+  dispatcher_->registerCollisionCreateFunc(
+      BOX_SHAPE_PROXYTYPE,
+      BOX_SHAPE_PROXYTYPE,
+      coll_config_->getCollisionAlgorithmCreateFunc(CONVEX_SHAPE_PROXYTYPE, CONVEX_SHAPE_PROXYTYPE));
+
+  dispatcher_->setDispatcherFlags(dispatcher_->getDispatcherFlags() &
+                                  ~btCollisionDispatcher::CD_USE_RELATIVE_CONTACT_BREAKING_THRESHOLD);
+}
+
+NarrowphaseCollisionDispatcher::~NarrowphaseCollisionDispatcher() = default;
+
+btCollisionDispatcher* NarrowphaseCollisionDispatcher::getDispatcher() const { return dispatcher_.get(); }
+
 }  // namespace tesseract::collision
@@ -0,0 +1,174 @@
+/**
+ * @file tesseract_octree_collision_algorithm.cpp
+ * @brief Collision algorithm between a TesseractOctreeShape and other collision shapes
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cassert>
+#include <BulletCollision/CollisionDispatch/btCollisionObject.h>
+#include <BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/collision/bullet/tesseract_octree_collision_algorithm.h>
+#include <tesseract/collision/bullet/tesseract_octree_shape.h>
+#include <tesseract/collision/bullet/bullet_utils.h>
+#include <tesseract/collision/types.h>
+
+namespace tesseract::collision::bullet_internal
+{
+namespace
+{
+/** @brief Checks the other shape against every occupied leaf of the octree */
+struct OctreeCollisionLeafCallback : public TesseractOctreeLeafCallback
+{
+  OctreeCollisionLeafCallback(const btCollisionObjectWrapper* octree_wrap,
+                              const btCollisionObjectWrapper* other_wrap,
+                              btDispatcher* dispatcher,
+                              const btDispatcherInfo& dispatch_info,
+                              btManifoldResult* result_out)
+    : octree_wrap_(octree_wrap)
+    , other_wrap_(other_wrap)
+    , octree_shape_(static_cast<const TesseractOctreeShape*>(octree_wrap->getCollisionShape()))
+    , dispatcher_(dispatcher)
+    , dispatch_info_(dispatch_info)
+    , result_out_(result_out)
+    , contact_test_data_(static_cast<ContactTestData*>(octree_wrap->getCollisionObject()->getUserPointer()))
+  {
+  }
+
+  bool processLeaf(btConvexShape* shape, const btTransform& local_tf) override
+  {
+    if (contact_test_data_->done)
+      return false;
+
+    const btTransform leaf_world_tf = octree_wrap_->getWorldTransform() * local_tf;
+
+    // The cast shape of the leaf is only needed while the leaf is processed
+    CastHullShape cast_shape(shape, btTransform::getIdentity());
+    const btCollisionShape* leaf_shape = shape;
+    if (octree_shape_->isCast())
+    {
+      cast_shape.updateCastTransform(local_tf.inverseTimes(octree_shape_->getCastTransform() * local_tf));
+      leaf_shape = &cast_shape;
+    }
+
+#if BT_BULLET_VERSION >= 300
+    btTransform pre_transform = local_tf;
+    if (octree_wrap_->m_preTransform != nullptr)
+      pre_transform = pre_transform * (*(octree_wrap_->m_preTransform));
+
+    btCollisionObjectWrapper leaf_wrap(octree_wrap_,
+                                       leaf_shape,
+                                       octree_wrap_->getCollisionObject(),
+                                       leaf_world_tf,
+                                       pre_transform,
+                                       octree_wrap_->m_partId,
+                                       octree_wrap_->m_index);
+#else
+    btCollisionObjectWrapper leaf_wrap(octree_wrap_,
+                                       leaf_shape,
+                                       octree_wrap_->getCollisionObject(),
+                                       leaf_world_tf,
+                                       octree_wrap_->m_partId,
+                                       octree_wrap_->m_index);
+#endif
+
+    btCollisionAlgorithm* algo =
+        dispatcher_->findAlgorithm(&leaf_wrap, other_wrap_, nullptr, BT_CLOSEST_POINT_ALGORITHMS);
+
+    const btCollisionObjectWrapper* tmp_wrap = nullptr;
+    const bool is_body0 = (result_out_->getBody0Internal() == octree_wrap_->getCollisionObject());
+    if (is_body0)
+    {
+      tmp_wrap = result_out_->getBody0Wrap();
+      result_out_->setBody0Wrap(&leaf_wrap);
+    }
+    else
+    {
+      tmp_wrap = result_out_->getBody1Wrap();
+      result_out_->setBody1Wrap(&leaf_wrap);
+    }
+
+    algo->processCollision(&leaf_wrap, other_wrap_, dispatch_info_, result_out_);
+
+    if (is_body0)
+      result_out_->setBody0Wrap(tmp_wrap);
+    else
+      result_out_->setBody1Wrap(tmp_wrap);
+
+    algo->~btCollisionAlgorithm();
+    dispatcher_->freeCollisionAlgorithm(algo);
+
+    return !contact_test_data_->done;
+  }
+
+  const btCollisionObjectWrapper* octree_wrap_;
+  const btCollisionObjectWrapper* other_wrap_;
+  const TesseractOctreeShape* octree_shape_;
+  btDispatcher* dispatcher_;
+  const btDispatcherInfo& dispatch_info_;  // NOLINT
+  btManifoldResult* result_out_;
+  ContactTestData* contact_test_data_;
+};
+}  // namespace
+
+TesseractOctreeCollisionAlgorithm::TesseractOctreeCollisionAlgorithm(const btCollisionAlgorithmConstructionInfo& ci,
+                                                                     const btCollisionObjectWrapper* body0Wrap,
+                                                                     const btCollisionObjectWrapper* body1Wrap,
+                                                                     bool isSwapped)
+  : btActivatingCollisionAlgorithm(ci, body0Wrap, body1Wrap), m_isSwapped(isSwapped)
+{
+}
+
+void TesseractOctreeCollisionAlgorithm::processCollision(const btCollisionObjectWrapper* body0Wrap,
+                                                         const btCollisionObjectWrapper* body1Wrap,
+                                                         const btDispatcherInfo& dispatchInfo,
+                                                         btManifoldResult* resultOut)
+{
+  const btCollisionObjectWrapper* octree_wrap = m_isSwapped ? body1Wrap : body0Wrap;
+  const btCollisionObjectWrapper* other_wrap = m_isSwapped ? body0Wrap : body1Wrap;
+
+  assert(dynamic_cast<const TesseractOctreeShape*>(octree_wrap->getCollisionShape()) != nullptr);
+  const auto* octree_shape = static_cast<const TesseractOctreeShape*>(octree_wrap->getCollisionShape());
+
+  // Only the leaves overlapping the bounds of the other shape in the octree frame are checked
+  btVector3 aabb_min, aabb_max;
+  const btTransform other_in_octree = octree_wrap->getWorldTransform().inverse() * other_wrap->getWorldTransform();
+  other_wrap->getCollisionShape()->getAabb(other_in_octree, aabb_min, aabb_max);
+  const btVector3 extra_extends(resultOut->m_closestPointDistanceThreshold,
+                                resultOut->m_closestPointDistanceThreshold,
+                                resultOut->m_closestPointDistanceThreshold);
+  aabb_min -= extra_extends;
+  aabb_max += extra_extends;
+
+  OctreeCollisionLeafCallback callback(octree_wrap, other_wrap, m_dispatcher, dispatchInfo, resultOut);
+  octree_shape->processOccupiedLeaves(aabb_min, aabb_max, callback);
+}
+
+btScalar TesseractOctreeCollisionAlgorithm::calculateTimeOfImpact(btCollisionObject* /*body0*/,
+                                                                  btCollisionObject* /*body1*/,
+                                                                  const btDispatcherInfo& /*dispatchInfo*/,
+                                                                  btManifoldResult* /*resultOut*/)
+{
+  return btScalar(1.);
+}
+}  // namespace tesseract::collision::bullet_internal
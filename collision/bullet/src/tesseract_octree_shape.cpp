@@ -0,0 +1,302 @@
+/**
+ * @file tesseract_octree_shape.cpp
+ * @brief A Bullet collision shape which traverses an octree instead of flattening it into a compound shape
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+#include <BulletCollision/CollisionShapes/btBoxShape.h>
+#include <BulletCollision/CollisionShapes/btSphereShape.h>
+#include <BulletCollision/CollisionShapes/btTriangleCallback.h>
+#include <LinearMath/btAabbUtil2.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/collision/bullet/tesseract_octree_shape.h>
+#include <tesseract/collision/bullet/bullet_utils.h>
+
+namespace tesseract::collision::bullet_internal
+{
+namespace
+{
+/** @brief Emits the triangles of the bounding box of every leaf */
+struct TriangleLeafCallback : public TesseractOctreeLeafCallback
+{
+  TriangleLeafCallback(btTriangleCallback* callback) : callback_(callback) {}
+
+  bool processLeaf(btConvexShape* shape, const btTransform& local_tf) override
+  {
+    btVector3 aabb_min, aabb_max;
+    shape->getAabb(local_tf, aabb_min, aabb_max);
+
+    btVector3 corners[8];  // NOLINT
+    for (int i = 0; i < 8; ++i)
+    {
+      corners[i] = btVector3(((i & 1) != 0) ? aabb_max.x() : aabb_min.x(),
+                             ((i & 2) != 0) ? aabb_max.y() : aabb_min.y(),
+                             ((i & 4) != 0) ? aabb_max.z() : aabb_min.z());
+    }
+
+    static const int faces[12][3] = { { 0, 1, 3 }, { 0, 3, 2 }, { 4, 6, 7 }, { 4, 7, 5 },  // NOLINT
+                                      { 0, 4, 5 }, { 0, 5, 1 }, { 2, 3, 7 }, { 2, 7, 6 },
+                                      { 0, 2, 6 }, { 0, 6, 4 }, { 1, 5, 7 }, { 1, 7, 3 } };
+    for (int i = 0; i < 12; ++i)
+    {
+      btVector3 triangle[3] = { corners[faces[i][0]], corners[faces[i][1]], corners[faces[i][2]] };  // NOLINT
+      callback_->processTriangle(triangle, 0, i);
+    }
+
+    return true;
+  }
+
+  btTriangleCallback* callback_;
+};
+}  // namespace
+
+TesseractOctreeShape::TesseractOctreeShape(std::shared_ptr<const octomap::OcTree> octree,
+                                           tesseract::geometry::OctreeSubType sub_type)
+  : octree_(std::move(octree)), sub_type_(sub_type), occupancy_threshold_(octree_->getOccupancyThres())
+{
+  m_shapeType = CUSTOM_CONCAVE_SHAPE_TYPE;
+  cast_tf_.setIdentity();
+
+  const unsigned tree_depth = octree_->getTreeDepth();
+  leaf_shapes_.reserve(tree_depth + 1);
+  node_extents_.reserve(tree_depth + 1);
+  for (unsigned depth = 0; depth <= tree_depth; ++depth)
+  {
+    const double half_size = octree_->getNodeSize(depth) / 2.0;
+    switch (sub_type_)
+    {
+      case tesseract::geometry::OctreeSubType::BOX:
+      {
+        auto length = static_cast<btScalar>(half_size);
+        auto shape = std::make_shared<btBoxShape>(btVector3(length, length, length));
+        shape->setMargin(BULLET_MARGIN);
+        leaf_shapes_.push_back(shape);
+        node_extents_.push_back(length);
+        break;
+      }
+      case tesseract::geometry::OctreeSubType::SPHERE_INSIDE:
+      {
+        // Sphere is a special case where you do not modify the margin which is internally set to the radius
+        leaf_shapes_.push_back(std::make_shared<btSphereShape>(static_cast<btScalar>(half_size)));
+        node_extents_.push_back(static_cast<btScalar>(half_size));
+        break;
+      }
+      case tesseract::geometry::OctreeSubType::SPHERE_OUTSIDE:
+      {
+        // The sphere circumscribes the face of the leaf box. A node uses the radius as half extent of its bounds, which
+        // also contains the spheres of the smaller leaves in its subtree. A leaf k levels deeper is at most h - h / 2^k
+        // from the node center along an axis and adds sqrt(2) * h / 2^k, which is never more than sqrt(2) * h.
+        auto radius = static_cast<btScalar>(std::sqrt(2 * (half_size * half_size)));
+        leaf_shapes_.push_back(std::make_shared<btSphereShape>(radius));
+        node_extents_.push_back(radius);
+        break;
+      }
+      default:
+        throw std::runtime_error("TesseractOctreeShape, this octree sub type is not supported!");
+    }
+  }
+
+  auto occupied_nodes = std::make_shared<std::unordered_set<const octomap::OcTreeNode*>>();
+  if (octree_->getRoot() != nullptr)
+    findOccupiedNodes(octree_->getRoot(), *occupied_nodes);
+  occupied_nodes_ = std::move(occupied_nodes);
+
+  local_aabb_min_.setValue(0, 0, 0);
+  local_aabb_max_.setValue(0, 0, 0);
+  bool empty = true;
+  for (auto it = octree_->begin_leafs(), end = octree_->end_leafs(); it != end; ++it)
+  {
+    if (it->getOccupancy() < occupancy_threshold_)
+      continue;
+
+    const btVector3 center(
+        static_cast<btScalar>(it.getX()), static_cast<btScalar>(it.getY()), static_cast<btScalar>(it.getZ()));
+    const btScalar extent = node_extents_[it.getDepth()];
+    const btVector3 extents(extent, extent, extent);
+    if (empty)
+    {
+      local_aabb_min_ = center - extents;
+      local_aabb_max_ = center + extents;
+      empty = false;
+    }
+    else
+    {
+      local_aabb_min_.setMin(center - extents);
+      local_aabb_max_.setMax(center + extents);
+    }
+  }
+}
+
+TesseractOctreeShape::Ptr TesseractOctreeShape::createCastShape() const
+{
+  auto shape = std::make_shared<TesseractOctreeShape>(*this);
+  shape->cast_ = true;
+  shape->cast_tf_.setIdentity();
+  return shape;
+}
+
+bool TesseractOctreeShape::isCast() const { return cast_; }
+
+void TesseractOctreeShape::updateCastTransform(const btTransform& t01)
+{
+  assert(cast_);
+  cast_tf_ = t01;
+}
+
+const btTransform& TesseractOctreeShape::getCastTransform() const { return cast_tf_; }
+
+const std::shared_ptr<const octomap::OcTree>& TesseractOctreeShape::getOctree() const { return octree_; }
+
+tesseract::geometry::OctreeSubType TesseractOctreeShape::getSubType() const { return sub_type_; }
+
+bool TesseractOctreeShape::isSubtreeOccupied(const octomap::OcTreeNode* node) const
+{
+  if (!octree_->nodeHasChildren(node))
+    return (node->getOccupancy() >= occupancy_threshold_);
+
+  return (occupied_nodes_->find(node) != occupied_nodes_->end());
+}
+
+bool TesseractOctreeShape::findOccupiedNodes(const octomap::OcTreeNode* node,
+                                             std::unordered_set<const octomap::OcTreeNode*>& nodes) const
+{
+  if (!octree_->nodeHasChildren(node))
+    return (node->getOccupancy() >= occupancy_threshold_);
+
+  bool occupied = false;
+  for (unsigned i = 0; i < 8; ++i)
+  {
+    if (octree_->nodeChildExists(node, i) && findOccupiedNodes(octree_->getNodeChild(node, i), nodes))
+      occupied = true;
+  }
+
+  if (occupied)
+    nodes.insert(node);
+
+  return occupied;
+}
+
+void TesseractOctreeShape::processOccupiedLeaves(const btVector3& aabb_min,
+                                                 const btVector3& aabb_max,
+                                                 TesseractOctreeLeafCallback& callback) const
+{
+  const octomap::OcTreeNode* root = octree_->getRoot();
+  if (root == nullptr)
+    return;
+
+  const auto tree_max_val = static_cast<octomap::key_type>(1U << (octree_->getTreeDepth() - 1));
+  const octomap::OcTreeKey root_key(tree_max_val, tree_max_val, tree_max_val);
+  processNode(root, root_key, 0, aabb_min, aabb_max, callback);
+}
+
+bool TesseractOctreeShape::processNode(const octomap::OcTreeNode* node,
+                                       const octomap::OcTreeKey& key,
+                                       unsigned depth,
+                                       const btVector3& aabb_min,
+                                       const btVector3& aabb_max,
+                                       TesseractOctreeLeafCallback& callback) const
+{
+  // Free leaves and inner nodes without an occupied leaf are skipped
+  if (!isSubtreeOccupied(node))
+    return true;
+
+  const octomap::point3d coord = octree_->keyToCoord(key, depth);
+  const btVector3 center(
+      static_cast<btScalar>(coord.x()), static_cast<btScalar>(coord.y()), static_cast<btScalar>(coord.z()));
+  const btScalar extent = node_extents_[depth];
+  const btVector3 extents(extent, extent, extent);
+  btVector3 node_min = center - extents;
+  btVector3 node_max = center + extents;
+  if (cast_)
+  {
+    btTransform node_tf(btMatrix3x3::getIdentity(), center);
+    btVector3 cast_min, cast_max;
+    btTransformAabb(extents, 0, cast_tf_ * node_tf, cast_min, cast_max);
+    node_min.setMin(cast_min);
+    node_max.setMax(cast_max);
+  }
+
+  if (!TestAabbAgainstAabb2(node_min, node_max, aabb_min, aabb_max))
+    return true;
+
+  if (!octree_->nodeHasChildren(node))
+    return callback.processLeaf(leaf_shapes_[depth].get(), btTransform(btMatrix3x3::getIdentity(), center));
+
+  const auto tree_max_val = static_cast<octomap::key_type>(1U << (octree_->getTreeDepth() - 1));
+  const octomap::key_type center_offset_key = tree_max_val >> (depth + 1);
+  octomap::OcTreeKey child_key;
+  for (unsigned i = 0; i < 8; ++i)
+  {
+    if (!octree_->nodeChildExists(node, i))
+      continue;
+
+    octomap::computeChildKey(i, center_offset_key, key, child_key);
+    if (!processNode(octree_->getNodeChild(node, i), child_key, depth + 1, aabb_min, aabb_max, callback))
+      return false;
+  }
+
+  return true;
+}
+
+void TesseractOctreeShape::getAabb(const btTransform& t, btVector3& aabbMin, btVector3& aabbMax) const
+{
+  btTransformAabb(local_aabb_min_, local_aabb_max_, 0, t, aabbMin, aabbMax);
+  if (cast_)
+  {
+    btVector3 min1, max1;
+    btTransformAabb(local_aabb_min_, local_aabb_max_, 0, t * cast_tf_, min1, max1);
+    aabbMin.setMin(min1);
+    aabbMax.setMax(max1);
+  }
+}
+
+void TesseractOctreeShape::processAllTriangles(btTriangleCallback* callback,
+                                               const btVector3& aabbMin,
+                                               const btVector3& aabbMax) const
+{
+  TriangleLeafCallback leaf_callback(callback);
+  processOccupiedLeaves(aabbMin, aabbMax, leaf_callback);
+}
+
+void TesseractOctreeShape::setLocalScaling(const btVector3& /*scaling*/)
+{
+  throw std::runtime_error("TesseractOctreeShape, scaling is not supported!");
+}
+
+const btVector3& TesseractOctreeShape::getLocalScaling() const
+{
+  static btVector3 out(1, 1, 1);
+  return out;
+}
+
+void TesseractOctreeShape::calculateLocalInertia(btScalar /*mass*/, btVector3& inertia) const
+{
+  inertia.setValue(0, 0, 0);
+}
+
+const char* TesseractOctreeShape::getName() const { return "TesseractOctree"; }
+}  // namespace tesseract::collision::bullet_internal
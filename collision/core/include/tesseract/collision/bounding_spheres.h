@@ -0,0 +1,101 @@
+/**
+ * @file bounding_spheres.h
+ * @brief Conservative bounding sphere approximation of collision geometry
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_BOUNDING_SPHERES_H
+#define TESSERACT_COLLISION_BOUNDING_SPHERES_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/collision/types.h>
+
+namespace tesseract::collision
+{
+/** @brief A sphere which fully contains a collision geometry */
+struct BoundingSphere
+{
+  /** @brief The center of the sphere */
+  Eigen::Vector3d center{ Eigen::Vector3d::Zero() };
+
+  /** @brief The radius of the sphere, infinite if the geometry is unbounded */
+  double radius{ 0 };
+};
+
+using BoundingSpheres = std::vector<BoundingSphere>;
+
+/**
+ * @brief Compute a sphere which fully contains the geometry
+ * @details Unbounded or unsupported geometry (ex. planes) returns a sphere with an infinite radius so it never
+ * rejects a contact pair.
+ * @param geom The geometry
+ * @return The bounding sphere relative to the geometry frame
+ */
+BoundingSphere computeBoundingSphere(const tesseract::geometry::Geometry& geom);
+
+/**
+ * @brief Compute a bounding sphere for each collision shape of a collision object
+ * @param shapes The collision shapes
+ * @param shape_poses The collision shape poses relative to the collision object frame
+ * @return The bounding spheres relative to the collision object frame, one per shape
+ */
+BoundingSpheres computeBoundingSpheres(const CollisionShapesConst& shapes,
+                                       const tesseract::common::VectorIsometry3d& shape_poses);
+
+/**
+ * @brief Compute a lower bound on the distance between two sets of bounding spheres
+ * @details This is the minimum signed distance between any pair of spheres. Since each sphere contains its geometry
+ * the true distance between the collision objects is greater than or equal to the returned value.
+ * @param spheres1 The first objects bounding spheres relative to its frame
+ * @param tf1 The first objects world transform
+ * @param spheres2 The second objects bounding spheres relative to its frame
+ * @param tf2 The second objects world transform
+ * @return The lower bound on the distance, negative infinity if either set of spheres is empty
+ */
+double computeBoundingSpheresDistance(const BoundingSpheres& spheres1,
+                                      const Eigen::Isometry3d& tf1,
+                                      const BoundingSpheres& spheres2,
+                                      const Eigen::Isometry3d& tf2);
+
+/**
+ * @brief Check if two collision objects could be within the collision margin using their bounding spheres
+ * @param spheres1 The first objects bounding spheres relative to its frame
+ * @param tf1 The first objects world transform
+ * @param spheres2 The second objects bounding spheres relative to its frame
+ * @param tf2 The second objects world transform
+ * @param collision_margin The collision margin for the pair
+ * @return False if the objects are guaranteed to be further apart than the collision margin, otherwise true
+ */
+inline bool isBoundingSpheresWithinMargin(const BoundingSpheres& spheres1,
+                                          const Eigen::Isometry3d& tf1,
+                                          const BoundingSpheres& spheres2,
+                                          const Eigen::Isometry3d& tf2,
+                                          double collision_margin)
+{
+  return computeBoundingSpheresDistance(spheres1, tf1, spheres2, tf2) <= collision_margin;
+}
+
+}  // namespace tesseract::collision
+
+#endif  // TESSERACT_COLLISION_BOUNDING_SPHERES_H
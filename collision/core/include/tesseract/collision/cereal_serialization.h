@@ -101,6 +101,9 @@ void serialize(Archive& ar, tesseract::collision::ContactManagerConfig& g)
   ar(cereal::make_nvp("acm", g.acm));
   ar(cereal::make_nvp("acm_override_type", g.acm_override_type));
   ar(cereal::make_nvp("modify_object_enabled", g.modify_object_enabled));
+  ar(cereal::make_nvp("approximation_type", g.approximation_type));
+  ar(cereal::make_nvp("contact_result_cache_enabled", g.contact_result_cache_enabled));
+  ar(cereal::make_nvp("parallel_narrowphase", g.parallel_narrowphase));
 }
 
 template <class Archive>
@@ -0,0 +1,130 @@
+/**
+ * @file collision_margin_table.h
+ * @brief A compiled collision margin lookup table indexed by collision object id
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_COLLISION_MARGIN_TABLE_H
+#define TESSERACT_COLLISION_COLLISION_MARGIN_TABLE_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cassert>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/common/collision_margin_data.h>
+
+namespace tesseract::collision
+{
+/**
+ * @brief A compiled version of CollisionMarginData indexed by the integer ids assigned by a contact manager
+ * @details The contact managers assign each collision object an index equal to its position in the managers list of
+ * collision objects. This table resolves the pair margin for two indices with a single array load instead of building
+ * and hashing an ordered pair of link names.
+ *
+ * If no pair margins are defined only the default margin is stored. Otherwise a dense symmetric matrix of size N x N
+ * is stored, where N is the number of collision objects.
+ *
+ * @note The table must be rebuilt by the contact manager when the collision margin data or the set of collision
+ * objects changes.
+ */
+class CollisionMarginTable
+{
+public:
+  CollisionMarginTable() = default;
+  CollisionMarginTable(const tesseract::common::CollisionMarginData& collision_margin_data,
+                       const std::vector<std::string>& object_names);
+
+  /**
+   * @brief Rebuild the table
+   * @param collision_margin_data The collision margin data to compile
+   * @param object_names The collision object names, where the index in the vector is the object id
+   */
+  void build(const tesseract::common::CollisionMarginData& collision_margin_data,
+             const std::vector<std::string>& object_names);
+
+  /** @brief Clear the table */
+  void clear();
+
+  /**
+   * @brief Get the number of collision objects in the table
+   * @return The number of collision objects
+   */
+  std::size_t size() const { return size_; }
+
+  /**
+   * @brief Check if the table contains pair specific margins
+   * @return True if pair specific margins are stored, otherwise false
+   */
+  bool hasPairMargins() const { return !pair_margins_.empty(); }
+
+  /**
+   * @brief Get the collision margin for a pair of objects
+   * @param index1 The first object id
+   * @param index2 The second object id
+   * @return The collision margin
+   */
+  double getCollisionMargin(std::size_t index1, std::size_t index2) const
+  {
+    if (pair_margins_.empty())
+      return default_collision_margin_;
+
+    assert(index1 < size_ && index2 < size_);
+    return pair_margins_[(index1 * size_) + index2];
+  }
+
+  /**
+   * @brief Get the largest collision margin for the given object
+   * @param index The object id
+   * @return The max collision margin
+   */
+  double getMaxCollisionMargin(std::size_t index) const
+  {
+    assert(index < size_);
+    return object_max_margins_[index];
+  }
+
+  /**
+   * @brief Get the largest collision margin
+   * @return The max collision margin
+   */
+  double getMaxCollisionMargin() const { return max_collision_margin_; }
+
+private:
+  /** @brief The number of collision objects */
+  std::size_t size_{ 0 };
+
+  /** @brief The default collision margin */
+  double default_collision_margin_{ 0 };
+
+  /** @brief The largest collision margin */
+  double max_collision_margin_{ 0 };
+
+  /** @brief Dense row-major symmetric matrix of pair margins, empty if no pair margins are defined */
+  std::vector<double> pair_margins_;
+
+  /** @brief The largest collision margin for each object */
+  std::vector<double> object_max_margins_;
+};
+
+}  // namespace tesseract::collision
+
+#endif  // TESSERACT_COLLISION_COLLISION_MARGIN_TABLE_H
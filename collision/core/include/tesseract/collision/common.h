@@ -83,6 +83,23 @@ ContactResult* processResult(ContactTestData& cdata,
                              const std::pair<std::string, std::string>& key,
                              bool found);
 
+/**
+ * @brief processResult Processes the ContactResult based on the information in the ContactTestData
+ * @details This is the same as above but the pair collision margin is provided by the caller, typically from the
+ * contact managers compiled CollisionMarginTable, so it does not need to be looked up by name.
+ * @param cdata Information used to process the results
+ * @param contact Contacts from the collision checkers that will be processed
+ * @param key Link pair used as a key to look up pair specific settings
+ * @param found Specifies whether or not a collision has already been found
+ * @param collision_margin The collision margin for the link pair
+ * @return Pointer to the ContactResult.
+ */
+ContactResult* processResult(ContactTestData& cdata,
+                             ContactResult& contact,
+                             const std::pair<std::string, std::string>& key,
+                             bool found,
+                             double collision_margin);
+
 /**
  * @brief Apply scaling to the geometry coordinates.
  * @details Given a scaling factor s, and center c, a given vertice v is transformed according to s (v - c) + c.
@@ -0,0 +1,171 @@
+/**
+ * @file contact_manager_statistics.h
+ * @brief Low overhead statistics collected by the contact managers during contactTest
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CONTACT_MANAGER_STATISTICS_H
+#define TESSERACT_COLLISION_CONTACT_MANAGER_STATISTICS_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/geometry/geometry.h>
+
+namespace tesseract::collision
+{
+/**
+ * @brief Statistics collected by a contact manager during contactTest
+ * @details The statistics are only updated when the TESSERACT_ENABLE_CONTACT_STATISTICS CMake option is ON, which
+ * defines TESSERACT_CONTACT_STATISTICS_ENABLED. Otherwise the updates are compiled out of the hot path.
+ *
+ * Each contact manager owns its own statistics. Since a contact manager is cloned for each thread the
+ * counters are per-thread and are updated without synchronization. Use operator+= to aggregate the statistics from
+ * several managers.
+ *
+ * Use ContactManagerStatistics::isEnabled() to check if the statistics are populated.
+ */
+struct ContactManagerStatistics
+{
+  /** @brief The number of geometry types */
+  static constexpr std::size_t GEOMETRY_TYPE_COUNT =
+      static_cast<std::size_t>(tesseract::geometry::GeometryType::COMPOUND_MESH) + 1;
+
+  /** @brief The number of calls to contactTest */
+  std::size_t contact_tests{ 0 };
+
+  /** @brief The number of pairs produced by the broadphase */
+  std::size_t broadphase_pairs{ 0 };
+
+  /** @brief The number of broadphase pairs rejected because they are disabled, filtered or allowed by the ACM */
+  std::size_t filtered_pairs{ 0 };
+
+  /** @brief The number of broadphase pairs rejected by the contact approximation */
+  std::size_t approximation_filtered_pairs{ 0 };
+
+  /** @brief The number of pairs passed to the exact narrowphase check */
+  std::size_t narrowphase_pairs{ 0 };
+
+  /** @brief The number of narrowphase contacts within the collision margin which were passed to the results */
+  std::size_t contacts{ 0 };
+
+  /** @brief The total time spent in contactTest in seconds */
+  double total_time{ 0 };
+
+  /** @brief The time spent in the exact narrowphase check in seconds */
+  double narrowphase_time{ 0 };
+
+  /**
+   * @brief The number of narrowphase checks per geometry type pair, indexed by [type1 * GEOMETRY_TYPE_COUNT + type2]
+   * @details This is symmetric. For backends which check all shapes of a link at once (Bullet), every combination of
+   * shape types of the two links is counted once per link pair.
+   */
+  std::array<std::size_t, GEOMETRY_TYPE_COUNT * GEOMETRY_TYPE_COUNT> narrowphase_shape_pairs{};
+
+  /**
+   * @brief Check if statistics collection was compiled in
+   * @return True if the contact managers populate the statistics, otherwise false
+   */
+  static constexpr bool isEnabled()
+  {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  /** @brief The time spent outside the narrowphase (broadphase, filtering and result processing) in seconds */
+  double getBroadphaseTime() const { return total_time - narrowphase_time; }
+
+  /**
+   * @brief Get the number of narrowphase checks for a geometry type pair
+   * @param type1 The first geometry type
+   * @param type2 The second geometry type
+   * @return The number of narrowphase checks, the order of the types does not matter
+   */
+  std::size_t getNarrowphaseShapePairs(tesseract::geometry::GeometryType type1,
+                                       tesseract::geometry::GeometryType type2) const;
+
+  /**
+   * @brief Record a narrowphase check for a geometry type pair
+   * @param type1 The first geometry type
+   * @param type2 The second geometry type
+   */
+  void addNarrowphaseShapePair(tesseract::geometry::GeometryType type1, tesseract::geometry::GeometryType type2);
+
+  /**
+   * @brief Record a narrowphase check between two collision objects made up of several shapes
+   * @details Every combination of shape types of the two objects is recorded once
+   * @param shapes1 The first collision objects shapes
+   * @param shapes2 The second collision objects shapes
+   */
+  void addNarrowphaseShapePairs(const std::vector<std::shared_ptr<const tesseract::geometry::Geometry>>& shapes1,
+                                const std::vector<std::shared_ptr<const tesseract::geometry::Geometry>>& shapes2);
+
+  /** @brief Reset all counters and timers to zero */
+  void reset();
+
+  /**
+   * @brief Get a human readable summary of the statistics
+   * @return The summary
+   */
+  std::string toString() const;
+
+  ContactManagerStatistics& operator+=(const ContactManagerStatistics& rhs);
+  bool operator==(const ContactManagerStatistics& rhs) const;
+  bool operator!=(const ContactManagerStatistics& rhs) const;
+};
+
+/** @brief Adds the elapsed time to the provided value when destroyed, does nothing if the value is nullptr */
+class ContactStatisticsScopedTimer
+{
+  using Clock = std::chrono::steady_clock;
+
+public:
+  explicit ContactStatisticsScopedTimer(double* elapsed) : elapsed_(elapsed)
+  {
+    if (elapsed_ != nullptr)
+      start_time_ = Clock::now();
+  }
+  ~ContactStatisticsScopedTimer()
+  {
+    if (elapsed_ != nullptr)
+      *elapsed_ += std::chrono::duration<double>(Clock::now() - start_time_).count();
+  }
+  ContactStatisticsScopedTimer(const ContactStatisticsScopedTimer&) = delete;
+  ContactStatisticsScopedTimer& operator=(const ContactStatisticsScopedTimer&) = delete;
+  ContactStatisticsScopedTimer(ContactStatisticsScopedTimer&&) = delete;
+  ContactStatisticsScopedTimer& operator=(ContactStatisticsScopedTimer&&) = delete;
+
+private:
+  double* elapsed_;
+  std::chrono::time_point<Clock> start_time_;
+};
+
+}  // namespace tesseract::collision
+
+#endif  // TESSERACT_COLLISION_CONTACT_MANAGER_STATISTICS_H
@@ -0,0 +1,167 @@
+/**
+ * @file contact_result_cache.h
+ * @brief A cache of the contact results of each object pair between contact tests
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_CONTACT_RESULT_CACHE_H
+#define TESSERACT_COLLISION_CONTACT_RESULT_CACHE_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/common/types.h>
+#include <tesseract/common/eigen_types.h>
+#include <tesseract/collision/types.h>
+
+namespace tesseract::collision
+{
+/**
+ * @brief Stores the contact results of each object pair so they can be reused by the next contact test
+ * @details The contact results of a pair only depend on the relative transform of the two objects, so when it is
+ * unchanged the stored results are moved with the objects and added to the results instead of running the
+ * narrowphase check. The contact managers call beginContactTest() and endContactTest() around every contact test and
+ * reuseContactResults() for every pair which passes the broadphase and allowed collision checks.
+ *
+ * Only ContactTestType::ALL and ContactTestType::CLOSEST requests are cached, because the results of a pair for the
+ * other types depend on the pairs checked before it. The cache is cleared when the contact request changes and it must
+ * be cleared by the contact manager when the collision margins or the contact allowed validator change.
+ *
+ * Only the results added to the result map during the contact test are stored for a pair, so a result map which is
+ * not cleared between contact tests does not store or reuse the results of earlier contact tests. For
+ * ContactTestType::CLOSEST a pair which already has a result in the map is not stored.
+ */
+class ContactResultCache
+{
+public:
+  /**
+   * @brief ContactResultCache
+   * @param tolerance The largest change of any element of the relative transform of a pair for which the stored results
+   * are reused
+   */
+  ContactResultCache(double tolerance = 1e-9);
+
+  /**
+   * @brief Enable or disable the cache, disabling it clears the stored results
+   * @param enabled Indicate if the cache is enabled
+   */
+  void setEnabled(bool enabled);
+
+  /** @brief Check if the cache is enabled */
+  bool isEnabled() const;
+
+  /**
+   * @brief Set the largest change of any element of the relative transform of a pair for which the results are reused
+   * @param tolerance The tolerance
+   */
+  void setTolerance(double tolerance);
+
+  /** @brief Get the largest change of any element of the relative transform for which the results are reused */
+  double getTolerance() const;
+
+  /**
+   * @brief Start a contact test
+   * @param request The contact request
+   * @return True if the cache is used for this contact test, otherwise false
+   */
+  bool beginContactTest(const ContactRequest& request);
+
+  /**
+   * @brief Reuse the stored results of a pair if the relative transform of the objects is unchanged
+   * @details If the results are not reused the pair is recorded, so its results are stored by endContactTest(). The
+   * pair is only looked up once per contact test, later calls return the same decision.
+   * @param name1 The name of the first object
+   * @param tf1 The world transform of the first object
+   * @param name2 The name of the second object
+   * @param tf2 The world transform of the second object
+   * @param results The results the stored results are added to
+   * @return True if the stored results were reused and the narrowphase check can be skipped, otherwise false
+   */
+  bool reuseContactResults(const std::string& name1,
+                           const Eigen::Isometry3d& tf1,
+                           const std::string& name2,
+                           const Eigen::Isometry3d& tf2,
+                           ContactResultMap& results);
+
+  /**
+   * @brief Store the results of the pairs checked during the contact test
+   * @param results The results of the contact test
+   */
+  void endContactTest(const ContactResultMap& results);
+
+  /**
+   * @brief Remove the stored results of every pair containing the object
+   * @param name The name of the object
+   */
+  void invalidate(const std::string& name);
+
+  /** @brief Remove all stored results */
+  void clear();
+
+  /** @brief Get the number of pairs with stored results */
+  std::size_t size() const;
+
+private:
+  struct Entry
+  {
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    /** @brief The world transform of the first object of the key when the results were computed */
+    Eigen::Isometry3d tf1{ Eigen::Isometry3d::Identity() };
+
+    /** @brief The transform of the second object of the key relative to the first */
+    Eigen::Isometry3d relative_tf{ Eigen::Isometry3d::Identity() };
+
+    /** @brief The contact results of the pair */
+    ContactResultVector results;
+
+    /** @brief The contact test the pair was last looked up in */
+    std::size_t contact_test{ 0 };
+
+    /** @brief Indicate if the results were reused in the contact test the pair was last looked up in */
+    bool reused{ false };
+  };
+
+  bool enabled_{ false };
+  double tolerance_;
+  tesseract::common::AlignedUnorderedMap<tesseract::common::LinkNamesPair, Entry> entries_;
+
+  /** @brief The request of the last cached contact test */
+  ContactRequest request_;
+
+  /** @brief Incremented for every cached contact test */
+  std::size_t contact_test_{ 0 };
+
+  /**
+   * @brief The pairs checked by the narrowphase during the current contact test and the number of results the result
+   * map held for each pair before it was checked
+   */
+  std::vector<std::pair<tesseract::common::LinkNamesPair, std::size_t>> pending_;
+};
+
+}  // namespace tesseract::collision
+
+#endif  // TESSERACT_COLLISION_CONTACT_RESULT_CACHE_H
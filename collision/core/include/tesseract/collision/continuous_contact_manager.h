@@ -269,6 +269,17 @@ public:
   /** @brief Get the active function for determining if two links are allowed to be in collision */
   virtual std::shared_ptr<const tesseract::common::ContactAllowedValidator> getContactAllowedValidator() const = 0;
 
+  /**
+   * @brief Get the statistics collected during contactTest
+   * @details The statistics are only populated if built with TESSERACT_ENABLE_CONTACT_STATISTICS. A clone starts with
+   * empty statistics, so each thread collects its own.
+   * @return The statistics
+   */
+  virtual const ContactManagerStatistics& getStatistics() const = 0;
+
+  /** @brief Reset the statistics collected during contactTest */
+  virtual void resetStatistics() = 0;
+
   /**
    * @brief Perform a contact test for all objects based
    * @param collisions The Contact results data
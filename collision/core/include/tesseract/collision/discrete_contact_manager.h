@@ -152,6 +152,17 @@ public:
    */
   virtual void setCollisionObjectsTransform(const tesseract::common::TransformMap& transforms) = 0;
 
+  /**
+   * @brief Set a series of collision object's transforms by index
+   * @details The index of a collision object is its position in getCollisionObjects(). Managers which store their
+   * objects by index override this to avoid the name lookup of the other overloads, the default implementation looks
+   * up the names.
+   * @param indices The collision object indices
+   * @param poses The transformation in world, must be the same size as indices
+   */
+  virtual void setCollisionObjectsTransform(const std::vector<std::size_t>& indices,
+                                            const tesseract::common::VectorIsometry3d& poses);
+
   /**
    * @brief Get all collision objects
    * @return A list of collision object names
@@ -222,6 +233,67 @@ public:
   /** @brief Get the active function for determining if two links are allowed to be in collision */
   virtual std::shared_ptr<const tesseract::common::ContactAllowedValidator> getContactAllowedValidator() const = 0;
 
+  /**
+   * @brief Set the geometry approximation used to reject pairs before the exact narrowphase check
+   * @details When enabled contactTest runs in two phases. Pairs which pass the broadphase and allowed collision checks
+   * are first tested using the cheap conservative approximation computed when the collision object was added, and only
+   * pairs whose approximate distance is within the pair collision margin are passed to the exact narrowphase check.
+   * @param type The approximation type
+   */
+  virtual void setContactApproximationType(ContactApproximationType type) = 0;
+
+  /**
+   * @brief Get the geometry approximation used to reject pairs before the exact narrowphase check
+   * @return The approximation type
+   */
+  virtual ContactApproximationType getContactApproximationType() const = 0;
+
+  /**
+   * @brief Enable or disable reusing the contact results of pairs whose relative transform is unchanged
+   * @details When enabled the results of every pair checked by a ContactTestType::ALL or ContactTestType::CLOSEST
+   * contactTest are stored, and the next contactTest with the same request moves the stored results with the objects
+   * instead of running the narrowphase check if the relative transform of the pair is unchanged. The stored results are
+   * removed when an object is added, removed, enabled or disabled, and cleared when the margins, the active objects or
+   * the contact allowed validator change. This is disabled by default and a clone starts with an empty cache.
+   * @note The contact results map should be cleared before every contactTest while the cache is enabled
+   * @param enabled Indicate if the cache is enabled
+   */
+  virtual void setContactResultCacheEnabled(bool enabled) = 0;
+
+  /**
+   * @brief Check if reusing the contact results of pairs whose relative transform is unchanged is enabled
+   * @return True if enabled, otherwise false
+   */
+  virtual bool isContactResultCacheEnabled() const = 0;
+
+  /**
+   * @brief Set the executor used to check the narrowphase pairs of a contactTest in parallel
+   * @details When set, contactTest first gathers the pairs which pass the broadphase and allowed collision checks and
+   * then checks them in contiguous blocks on the executor, each block with its own collision algorithm state and
+   * results. The results of the blocks are merged in order, so they match a serial contactTest except that
+   * ContactTestType::FIRST may return a different contact. ContactTestType::GLOBAL_MINIMUM requests are always checked
+   * serially. This is nullptr by default and a clone uses the same executor.
+   * @param executor The executor, nullptr to check the pairs serially
+   */
+  virtual void setNarrowphaseExecutor(std::shared_ptr<tesseract::common::TaskExecutor> executor) = 0;
+
+  /**
+   * @brief Get the executor used to check the narrowphase pairs of a contactTest in parallel
+   * @return The executor, nullptr if the pairs are checked serially
+   */
+  virtual std::shared_ptr<tesseract::common::TaskExecutor> getNarrowphaseExecutor() const = 0;
+
+  /**
+   * @brief Get the statistics collected during contactTest
+   * @details The statistics are only populated if built with TESSERACT_ENABLE_CONTACT_STATISTICS. A clone starts with
+   * empty statistics, so each thread collects its own.
+   * @return The statistics
+   */
+  virtual const ContactManagerStatistics& getStatistics() const = 0;
+
+  /** @brief Reset the statistics collected during contactTest */
+  virtual void resetStatistics() = 0;
+
   /**
    * @brief Perform a contact test for all objects based
    * @param collisions The contact results data
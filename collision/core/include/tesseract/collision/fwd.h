@@ -38,6 +38,7 @@ struct ContactTestData;
 enum class CollisionEvaluatorType : std::uint8_t;
 enum class CollisionCheckProgramType : std::uint8_t;
 enum class ACMOverrideType : std::uint8_t;
+enum class ContactApproximationType : std::uint8_t;
 struct ContactManagerConfig;
 struct CollisionCheckConfig;
 struct ContactTrajectorySubstepResults;
@@ -45,6 +46,15 @@ struct ContactTrajectoryStepResults;
 struct ContactTrajectoryResults;
 class ContactResultValidator;
 
+// collision_margin_table.h
+class CollisionMarginTable;
+
+// contact_manager_statistics.h
+struct ContactManagerStatistics;
+
+// contact_result_cache.h
+class ContactResultCache;
+
 // contact_managers_plugin_factory.h
 class DiscreteContactManagerFactory;
 class ContinuousContactManagerFactory;
@@ -58,6 +68,9 @@ class DiscreteContactManager;
 
 // continuous_contact_manager.h
 class ContinuousContactManager;
+
+// parallel_narrowphase.h
+struct NarrowphaseBlockData;
 }  // namespace tesseract::collision
 
 #endif  // TESSERACT_COLLISION_FWD_H
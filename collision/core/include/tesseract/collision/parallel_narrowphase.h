@@ -0,0 +1,93 @@
+/**
+ * @file parallel_narrowphase.h
+ * @brief Utilities for checking the narrowphase pairs of a contact test in parallel
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COLLISION_PARALLEL_NARROWPHASE_H
+#define TESSERACT_COLLISION_PARALLEL_NARROWPHASE_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/common/task_pool.h>
+#include <tesseract/collision/types.h>
+#include <tesseract/collision/contact_manager_statistics.h>
+
+namespace tesseract::collision
+{
+/** @brief The results and statistics of a block of narrowphase pairs checked in parallel */
+struct NarrowphaseBlockData
+{
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+  /** @brief A copy of the contact test data which stores the contacts in the results of the block */
+  ContactTestData cdata;
+
+  /** @brief The contacts found by the block */
+  ContactResultMap results;
+
+  /** @brief The statistics collected by the block */
+  ContactManagerStatistics statistics;
+
+  /**
+   * @brief Prepare the block for a contact test
+   * @param contact_test_data The contact test data of the contact test
+   */
+  void reset(const ContactTestData& contact_test_data);
+};
+
+/**
+ * @brief Get the number of blocks the narrowphase pairs are split into
+ * @param executor The executor
+ * @param size The number of narrowphase pairs
+ * @return One block per worker thread and one for the calling thread, but not more than the number of pairs
+ */
+std::size_t getNarrowphaseBlockCount(const tesseract::common::TaskExecutor& executor, std::size_t size);
+
+/**
+ * @brief Check the narrowphase pairs of a contact test in parallel
+ * @details The pairs are split into getNarrowphaseBlockCount() contiguous blocks which are checked on the executor,
+ * the calling thread checks the first block. Every block stores its contacts in its own results, and when a block is
+ * done, which only happens for ContactTestType::FIRST, the other blocks stop before their next pair. The contacts of
+ * the blocks are then passed to processResult in block order, so the results match checking the pairs serially,
+ * except that ContactTestType::FIRST may find a different contact. The statistics of the blocks are added to the
+ * contact test statistics, with the narrowphase time measured once for all blocks.
+ * @param executor The executor
+ * @param cdata The contact test data of the contact test
+ * @param size The number of narrowphase pairs
+ * @param blocks The block data, extended to the number of blocks. It is owned by the contact manager so the memory of
+ * the results is reused between contact tests.
+ * @param fn The function called with the block index, the contact test data of the block and the pair index to check
+ * a pair. It is called concurrently for different blocks.
+ */
+void checkNarrowphasePairs(tesseract::common::TaskExecutor& executor,
+                           ContactTestData& cdata,
+                           std::size_t size,
+                           std::vector<std::unique_ptr<NarrowphaseBlockData>>& blocks,
+                           const std::function<void(std::size_t, ContactTestData&, std::size_t)>& fn);
+
+}  // namespace tesseract::collision
+
+#endif  // TESSERACT_COLLISION_PARALLEL_NARROWPHASE_H
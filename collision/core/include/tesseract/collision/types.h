@@ -34,6 +34,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <array>
 #include <unordered_map>
 #include <functional>
+#include <limits>
+#include <algorithm>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/common/fwd.h>
@@ -41,6 +43,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract/common/eigen_types.h>
 #include <tesseract/common/collision_margin_data.h>
 #include <tesseract/geometry/fwd.h>
+#include <tesseract/collision/collision_margin_table.h>
+#include <tesseract/collision/contact_manager_statistics.h>
 
 namespace tesseract::collision
 {
@@ -52,6 +56,7 @@ using CollisionMarginPairData = tesseract::common::CollisionMarginPairData;
 using CollisionMarginPairOverrideType = tesseract::common::CollisionMarginPairOverrideType;
 
 class ContactResultValidator;
+class ContactResultCache;
 
 enum class ContinuousCollisionType : std::uint8_t
 {
@@ -65,8 +70,9 @@ enum class ContactTestType : std::uint8_t
 {
   FIRST = 0,   /**< Return at first contact for any pair of objects */
   CLOSEST = 1, /**< Return the global minimum for a pair of objects */
-  ALL = 2,     /**< Return all contacts for a pair of objects */
-  LIMITED = 3  /**< Return limited set of contacts for a pair of objects */
+  ALL = 2,            /**< Return all contacts for a pair of objects */
+  LIMITED = 3,        /**< Return limited set of contacts for a pair of objects */
+  GLOBAL_MINIMUM = 4  /**< Return only the contact with the smallest distance over all pairs of objects */
 };
 
 static const std::vector<std::string> ContactTestTypeStrings = {
@@ -74,6 +80,7 @@ static const std::vector<std::string> ContactTestTypeStrings = {
   "CLOSEST",
   "ALL",
   "LIMITED",
+  "GLOBAL_MINIMUM",
 };
 
 struct ContactResult
@@ -190,6 +197,13 @@ public:
    */
   ContactResult& setContactResult(const KeyType& key, const MappedType& results);
 
+  /**
+   * @brief Clear the contact results for the provided key
+   * @details Like clear, this keeps the entry and the capacity of its vector
+   * @param key The key to clear the results of
+   */
+  void clearContactResult(const KeyType& key);
+
   /**
    * @brief This processes interpolated contact results by updating the cc_time and cc_type and then adds the result
    * @details This is copied from the trajopt utility processInterpolatedCollisionResults
@@ -319,6 +333,18 @@ struct ContactRequest
   bool operator!=(const ContactRequest& rhs) const;
 };
 
+/** @brief Identifies the geometry approximation used to reject contact pairs before the exact narrowphase check */
+enum class ContactApproximationType : std::uint8_t
+{
+  /** @brief Every broadphase pair is passed to the exact narrowphase check */
+  NONE,
+  /**
+   * @brief Each collision shape is approximated by a conservative bounding sphere. Pairs whose spheres are further
+   * apart than the pair collision margin are rejected before the exact narrowphase check.
+   */
+  BOUNDING_SPHERES
+};
+
 /**
  * @brief This data is intended only to be used internal to the collision checkers as a container and should not
  *        be externally used by other libraries or packages.
@@ -336,9 +362,30 @@ struct ContactTestData
   /** @brief The current contact_distance threshold */
   CollisionMarginData collision_margin_data{ 0 };
 
+  /**
+   * @brief The compiled collision margin table indexed by the contact managers collision object ids
+   * @details This is owned by the contact manager and may be nullptr, in which case collision_margin_data is used.
+   */
+  const CollisionMarginTable* collision_margin_table{ nullptr };
+
   /** @brief The allowed collision function used to check if two links should be excluded from collision checking */
   std::shared_ptr<const tesseract::common::ContactAllowedValidator> validator;
 
+  /** @brief The geometry approximation used to reject pairs before the exact narrowphase check */
+  ContactApproximationType approximation_type{ ContactApproximationType::NONE };
+
+  /**
+   * @brief The statistics to update, owned by the contact manager and may be nullptr
+   * @note This is only used when built with TESSERACT_ENABLE_CONTACT_STATISTICS
+   */
+  ContactManagerStatistics* statistics{ nullptr };
+
+  /**
+   * @brief The cache used to skip the narrowphase check of pairs whose relative transform is unchanged
+   * @details This is owned by the contact manager and is nullptr when the cache is disabled or not used by the request
+   */
+  ContactResultCache* contact_result_cache{ nullptr };
+
   /** @brief The type of contact request data */
   ContactRequest req;
 
@@ -347,6 +394,51 @@ struct ContactTestData
 
   /** @brief Indicate if search is finished */
   bool done = false;
+
+  /**
+   * @brief The smallest distance found so far by a ContactTestType::GLOBAL_MINIMUM request
+   * @details The contact managers must reset this to the maximum double at the start of every contact test
+   */
+  double global_minimum_distance{ std::numeric_limits<double>::max() };
+
+  /** @brief The key of the contact result with the smallest distance found so far, empty if none */
+  ContactResultMap::KeyType global_minimum_key;
+
+  /**
+   * @brief Get the collision margin for a pair of objects
+   * @details If the compiled margin table is available and both ids are valid this is an array load, otherwise it
+   * falls back to the name based lookup in collision_margin_data.
+   * @param index1 The first objects id assigned by the contact manager, -1 if unknown
+   * @param name1 The first objects name
+   * @param index2 The second objects id assigned by the contact manager, -1 if unknown
+   * @param name2 The second objects name
+   * @return The collision margin
+   */
+  double getCollisionMargin(int index1, const std::string& name1, int index2, const std::string& name2) const
+  {
+    if (collision_margin_table != nullptr && index1 >= 0 && index2 >= 0 &&
+        static_cast<std::size_t>(index1) < collision_margin_table->size() &&
+        static_cast<std::size_t>(index2) < collision_margin_table->size())
+      return collision_margin_table->getCollisionMargin(static_cast<std::size_t>(index1),
+                                                        static_cast<std::size_t>(index2));
+
+    return collision_margin_data.getCollisionMargin(name1, name2);
+  }
+
+  /**
+   * @brief Get the collision margin used to check a pair of objects
+   * @details For a ContactTestType::GLOBAL_MINIMUM request a pair only has to be checked up to the smallest distance
+   * found so far, so the margin shrinks as the search progresses.
+   * @param collision_margin The collision margin of the pair
+   * @return The collision margin to use for the narrowphase check
+   */
+  double getEffectiveCollisionMargin(double collision_margin) const
+  {
+    if (req.type == ContactTestType::GLOBAL_MINIMUM)
+      return std::min(collision_margin, global_minimum_distance);
+
+    return collision_margin;
+  }
 };
 
 /**
@@ -356,6 +448,8 @@ struct ContactTestData
  * LVS_DISCRETE - Discrete contact manager interpolating using longest valid segment
  * CONTINUOUS - Continuous contact manager using only steps specified
  * LVS_CONTINUOUS - Continuous contact manager interpolating using longest valid segment
+ * ADAPTIVE_LVS_DISCRETE - Discrete contact manager interpolating using longest valid segment, skipping substeps which
+ *                         are proven collision free by the clearance at the previous checked state
  */
 enum class CollisionEvaluatorType : std::uint8_t
 {
@@ -368,7 +462,13 @@ enum class CollisionEvaluatorType : std::uint8_t
   /** @brief Continuous contact manager using only steps specified */
   CONTINUOUS,
   /** @brief Continuous contact manager interpolating using longest valid segment */
-  LVS_CONTINUOUS
+  LVS_CONTINUOUS,
+  /**
+   * @brief Discrete contact manager interpolating using longest valid segment with conservative advancement
+   * @details The distance at each checked state and the motion bounds of the links are used to skip substeps which
+   * cannot be in collision, so it provides the same result as LVS_DISCRETE while checking fewer states in free space.
+   */
+  ADAPTIVE_LVS_DISCRETE
 };
 
 /** @brief The mode used to check program */
@@ -444,6 +544,24 @@ struct ContactManagerConfig
    * map are unmodified from the defaults*/
   std::unordered_map<std::string, bool> modify_object_enabled;
 
+  /**
+   * @brief Override the geometry approximation used to reject pairs before the exact narrowphase check
+   * @note This is only applied to discrete contact managers
+   */
+  std::optional<ContactApproximationType> approximation_type;
+
+  /**
+   * @brief Enable or disable reusing the contact results of pairs whose relative transform is unchanged
+   * @note This is only applied to discrete contact managers
+   */
+  std::optional<bool> contact_result_cache_enabled;
+
+  /**
+   * @brief Enable or disable checking the narrowphase pairs of a contact test in parallel on the global task executor
+   * @note This is only applied to discrete contact managers
+   */
+  std::optional<bool> parallel_narrowphase;
+
   /**
    * @brief Increment all margins by input amount. Useful for inflating or reducing margins
    * @param increment Amount to increment margins
@@ -74,6 +74,42 @@ struct convert<tesseract::collision::ACMOverrideType>
   }
 };
 
+//=========================== ContactApproximationType Enum ===========================
+template <>
+struct convert<tesseract::collision::ContactApproximationType>
+{
+  static Node encode(const tesseract::collision::ContactApproximationType& rhs)
+  {
+    // LCOV_EXCL_START
+    static const std::map<tesseract::collision::ContactApproximationType, std::string> m = {
+      { tesseract::collision::ContactApproximationType::NONE, "NONE" },
+      { tesseract::collision::ContactApproximationType::BOUNDING_SPHERES, "BOUNDING_SPHERES" }
+    };
+    // LCOV_EXCL_STOP
+    return Node(m.at(rhs));
+  }
+
+  static bool decode(const Node& node, tesseract::collision::ContactApproximationType& rhs)
+  {
+    // LCOV_EXCL_START
+    static const std::map<std::string, tesseract::collision::ContactApproximationType> inv = {
+      { "NONE", tesseract::collision::ContactApproximationType::NONE },
+      { "BOUNDING_SPHERES", tesseract::collision::ContactApproximationType::BOUNDING_SPHERES }
+    };
+    // LCOV_EXCL_STOP
+
+    if (!node.IsScalar())
+      return false;
+
+    auto it = inv.find(node.Scalar());
+    if (it == inv.end())
+      return false;
+
+    rhs = it->second;
+    return true;
+  }
+};
+
 //=========================== ContactTestType Enum ===========================
 template <>
 struct convert<tesseract::collision::ContactTestType>
@@ -85,7 +121,8 @@ struct convert<tesseract::collision::ContactTestType>
       { tesseract::collision::ContactTestType::FIRST, "FIRST" },
       { tesseract::collision::ContactTestType::CLOSEST, "CLOSEST" },
       { tesseract::collision::ContactTestType::ALL, "ALL" },
-      { tesseract::collision::ContactTestType::LIMITED, "LIMITED" }
+      { tesseract::collision::ContactTestType::LIMITED, "LIMITED" },
+      { tesseract::collision::ContactTestType::GLOBAL_MINIMUM, "GLOBAL_MINIMUM" }
     };
     // LCOV_EXCL_STOP
     return Node(m.at(rhs));
@@ -98,7 +135,8 @@ struct convert<tesseract::collision::ContactTestType>
       { "FIRST", tesseract::collision::ContactTestType::FIRST },
       { "CLOSEST", tesseract::collision::ContactTestType::CLOSEST },
       { "ALL", tesseract::collision::ContactTestType::ALL },
-      { "LIMITED", tesseract::collision::ContactTestType::LIMITED }
+      { "LIMITED", tesseract::collision::ContactTestType::LIMITED },
+      { "GLOBAL_MINIMUM", tesseract::collision::ContactTestType::GLOBAL_MINIMUM }
     };
     // LCOV_EXCL_STOP
 
@@ -126,7 +164,8 @@ struct convert<tesseract::collision::CollisionEvaluatorType>
       { tesseract::collision::CollisionEvaluatorType::DISCRETE, "DISCRETE" },
       { tesseract::collision::CollisionEvaluatorType::LVS_DISCRETE, "LVS_DISCRETE" },
       { tesseract::collision::CollisionEvaluatorType::CONTINUOUS, "CONTINUOUS" },
-      { tesseract::collision::CollisionEvaluatorType::LVS_CONTINUOUS, "LVS_CONTINUOUS" }
+      { tesseract::collision::CollisionEvaluatorType::LVS_CONTINUOUS, "LVS_CONTINUOUS" },
+      { tesseract::collision::CollisionEvaluatorType::ADAPTIVE_LVS_DISCRETE, "ADAPTIVE_LVS_DISCRETE" }
     };
     // LCOV_EXCL_STOP
     return Node(m.at(rhs));
@@ -140,7 +179,8 @@ struct convert<tesseract::collision::CollisionEvaluatorType>
       { "DISCRETE", tesseract::collision::CollisionEvaluatorType::DISCRETE },
       { "LVS_DISCRETE", tesseract::collision::CollisionEvaluatorType::LVS_DISCRETE },
       { "CONTINUOUS", tesseract::collision::CollisionEvaluatorType::CONTINUOUS },
-      { "LVS_CONTINUOUS", tesseract::collision::CollisionEvaluatorType::LVS_CONTINUOUS }
+      { "LVS_CONTINUOUS", tesseract::collision::CollisionEvaluatorType::LVS_CONTINUOUS },
+      { "ADAPTIVE_LVS_DISCRETE", tesseract::collision::CollisionEvaluatorType::ADAPTIVE_LVS_DISCRETE }
     };
     // LCOV_EXCL_STOP
 
@@ -249,6 +289,13 @@ struct convert<tesseract::collision::ContactManagerConfig>
     node["acm_override_type"] = rhs.acm_override_type;
     node["acm"] = rhs.acm;
     node["modify_object_enabled"] = rhs.modify_object_enabled;
+    if (rhs.approximation_type.has_value())
+      node["approximation_type"] = rhs.approximation_type.value();
+    if (rhs.contact_result_cache_enabled.has_value())
+      node["contact_result_cache_enabled"] = rhs.contact_result_cache_enabled.value();
+    if (rhs.parallel_narrowphase.has_value())
+      node["parallel_narrowphase"] = rhs.parallel_narrowphase.value();
+
     return node;
   }
 
@@ -275,6 +322,15 @@ struct convert<tesseract::collision::ContactManagerConfig>
     if (const YAML::Node& n = node["modify_object_enabled"])
       rhs.modify_object_enabled = n.as<std::unordered_map<std::string, bool>>();
 
+    if (const YAML::Node& n = node["approximation_type"])
+      rhs.approximation_type = n.as<tesseract::collision::ContactApproximationType>();
+
+    if (const YAML::Node& n = node["contact_result_cache_enabled"])
+      rhs.contact_result_cache_enabled = n.as<bool>();
+
+    if (const YAML::Node& n = node["parallel_narrowphase"])
+      rhs.parallel_narrowphase = n.as<bool>();
+
     return true;
   }
 };
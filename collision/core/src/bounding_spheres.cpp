@@ -0,0 +1,206 @@
+/**
+ * @file bounding_spheres.cpp
+ * @brief Conservative bounding sphere approximation of collision geometry
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <octomap/OcTree.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/collision/bounding_spheres.h>
+#include <tesseract/geometry/geometries.h>
+
+namespace tesseract::collision
+{
+namespace
+{
+void expandBounds(const tesseract::common::VectorVector3d& vertices, Eigen::Vector3d& min, Eigen::Vector3d& max)
+{
+  for (const auto& v : vertices)
+  {
+    min = min.cwiseMin(v);
+    max = max.cwiseMax(v);
+  }
+}
+
+double computeMaxDistance(const tesseract::common::VectorVector3d& vertices, const Eigen::Vector3d& center)
+{
+  double max_sq = 0;
+  for (const auto& v : vertices)
+    max_sq = std::max(max_sq, (v - center).squaredNorm());
+
+  return std::sqrt(max_sq);
+}
+
+BoundingSphere computeVerticesBoundingSphere(const std::vector<const tesseract::common::VectorVector3d*>& vertex_sets)
+{
+  Eigen::Vector3d min = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d max = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+  bool has_vertices{ false };
+  for (const auto* vertices : vertex_sets)
+  {
+    if (vertices == nullptr || vertices->empty())
+      continue;
+
+    expandBounds(*vertices, min, max);
+    has_vertices = true;
+  }
+
+  BoundingSphere sphere;
+  if (!has_vertices)
+    return sphere;
+
+  // The center of the AABB is not the minimum enclosing sphere but it is cheap and always conservative
+  sphere.center = 0.5 * (min + max);
+  for (const auto* vertices : vertex_sets)
+  {
+    if (vertices != nullptr)
+      sphere.radius = std::max(sphere.radius, computeMaxDistance(*vertices, sphere.center));
+  }
+
+  return sphere;
+}
+}  // namespace
+
+BoundingSphere computeBoundingSphere(const tesseract::geometry::Geometry& geom)
+{
+  BoundingSphere sphere;
+  switch (geom.getType())
+  {
+    case tesseract::geometry::GeometryType::SPHERE:
+    {
+      sphere.radius = static_cast<const tesseract::geometry::Sphere&>(geom).getRadius();
+      break;
+    }
+    case tesseract::geometry::GeometryType::BOX:
+    {
+      const auto& box = static_cast<const tesseract::geometry::Box&>(geom);
+      sphere.radius = 0.5 * Eigen::Vector3d(box.getX(), box.getY(), box.getZ()).norm();
+      break;
+    }
+    case tesseract::geometry::GeometryType::CYLINDER:
+    {
+      const auto& cylinder = static_cast<const tesseract::geometry::Cylinder&>(geom);
+      sphere.radius = std::hypot(cylinder.getRadius(), 0.5 * cylinder.getLength());
+      break;
+    }
+    case tesseract::geometry::GeometryType::CONE:
+    {
+      const auto& cone = static_cast<const tesseract::geometry::Cone&>(geom);
+      sphere.radius = std::hypot(cone.getRadius(), 0.5 * cone.getLength());
+      break;
+    }
+    case tesseract::geometry::GeometryType::CAPSULE:
+    {
+      const auto& capsule = static_cast<const tesseract::geometry::Capsule&>(geom);
+      sphere.radius = capsule.getRadius() + (0.5 * capsule.getLength());
+      break;
+    }
+    case tesseract::geometry::GeometryType::MESH:
+    case tesseract::geometry::GeometryType::CONVEX_MESH:
+    case tesseract::geometry::GeometryType::SDF_MESH:
+    case tesseract::geometry::GeometryType::POLYGON_MESH:
+    {
+      const auto& mesh = static_cast<const tesseract::geometry::PolygonMesh&>(geom);
+      sphere = computeVerticesBoundingSphere({ mesh.getVertices().get() });
+      break;
+    }
+    case tesseract::geometry::GeometryType::COMPOUND_MESH:
+    {
+      const auto& compound_mesh = static_cast<const tesseract::geometry::CompoundMesh&>(geom);
+      std::vector<const tesseract::common::VectorVector3d*> vertex_sets;
+      vertex_sets.reserve(compound_mesh.getMeshes().size());
+      for (const auto& mesh : compound_mesh.getMeshes())
+        vertex_sets.push_back(mesh->getVertices().get());
+
+      sphere = computeVerticesBoundingSphere(vertex_sets);
+      break;
+    }
+    case tesseract::geometry::GeometryType::OCTREE:
+    {
+      const auto& octree = static_cast<const tesseract::geometry::Octree&>(geom);
+      if (octree.getOctree() == nullptr || octree.getOctree()->size() == 0)
+        break;
+
+      Eigen::Vector3d min;
+      Eigen::Vector3d max;
+      octree.getOctree()->getMetricMin(min.x(), min.y(), min.z());
+      octree.getOctree()->getMetricMax(max.x(), max.y(), max.z());
+      sphere.center = 0.5 * (min + max);
+
+      // The octree sub shapes may extend beyond the cell, so pad by the resolution
+      sphere.radius = (0.5 * (max - min).norm()) + octree.getOctree()->getResolution();
+      break;
+    }
+    default:
+    {
+      sphere.radius = std::numeric_limits<double>::infinity();
+      break;
+    }
+  }
+
+  return sphere;
+}
+
+BoundingSpheres computeBoundingSpheres(const CollisionShapesConst& shapes,
+                                       const tesseract::common::VectorIsometry3d& shape_poses)
+{
+  assert(shapes.size() == shape_poses.size());
+  BoundingSpheres spheres;
+  spheres.reserve(shapes.size());
+  for (std::size_t i = 0; i < shapes.size(); ++i)
+  {
+    BoundingSphere sphere = computeBoundingSphere(*shapes[i]);
+    sphere.center = shape_poses[i] * sphere.center;
+    spheres.push_back(sphere);
+  }
+
+  return spheres;
+}
+
+double computeBoundingSpheresDistance(const BoundingSpheres& spheres1,
+                                      const Eigen::Isometry3d& tf1,
+                                      const BoundingSpheres& spheres2,
+                                      const Eigen::Isometry3d& tf2)
+{
+  if (spheres1.empty() || spheres2.empty())
+    return -std::numeric_limits<double>::infinity();
+
+  double min_distance = std::numeric_limits<double>::infinity();
+  for (const auto& s1 : spheres1)
+  {
+    const Eigen::Vector3d c1 = tf1 * s1.center;
+    for (const auto& s2 : spheres2)
+    {
+      const double distance = (c1 - (tf2 * s2.center)).norm() - s1.radius - s2.radius;
+      min_distance = std::min(min_distance, distance);
+    }
+  }
+
+  return min_distance;
+}
+
+}  // namespace tesseract::collision
@@ -0,0 +1,87 @@
+/**
+ * @file collision_margin_table.cpp
+ * @brief A compiled collision margin lookup table indexed by collision object id
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/collision/collision_margin_table.h>
+
+namespace tesseract::collision
+{
+CollisionMarginTable::CollisionMarginTable(const tesseract::common::CollisionMarginData& collision_margin_data,
+                                           const std::vector<std::string>& object_names)
+{
+  build(collision_margin_data, object_names);
+}
+
+void CollisionMarginTable::build(const tesseract::common::CollisionMarginData& collision_margin_data,
+                                 const std::vector<std::string>& object_names)
+{
+  size_ = object_names.size();
+  default_collision_margin_ = collision_margin_data.getDefaultCollisionMargin();
+  max_collision_margin_ = collision_margin_data.getMaxCollisionMargin();
+  object_max_margins_.assign(size_, default_collision_margin_);
+  pair_margins_.clear();
+
+  const tesseract::common::CollisionMarginPairData& pair_data = collision_margin_data.getCollisionMarginPairData();
+  if (pair_data.empty())
+    return;
+
+  std::unordered_map<std::string, std::size_t> name_to_index;
+  name_to_index.reserve(size_);
+  for (std::size_t i = 0; i < size_; ++i)
+    name_to_index[object_names[i]] = i;
+
+  pair_margins_.assign(size_ * size_, default_collision_margin_);
+  for (const auto& pair : pair_data.getCollisionMargins())
+  {
+    auto it1 = name_to_index.find(pair.first.first);
+    if (it1 == name_to_index.end())
+      continue;
+
+    auto it2 = name_to_index.find(pair.first.second);
+    if (it2 == name_to_index.end())
+      continue;
+
+    const std::size_t i = it1->second;
+    const std::size_t j = it2->second;
+    pair_margins_[(i * size_) + j] = pair.second;
+    pair_margins_[(j * size_) + i] = pair.second;
+    object_max_margins_[i] = std::max(object_max_margins_[i], pair.second);
+    object_max_margins_[j] = std::max(object_max_margins_[j], pair.second);
+  }
+}
+
+void CollisionMarginTable::clear()
+{
+  size_ = 0;
+  default_collision_margin_ = 0;
+  max_collision_margin_ = 0;
+  pair_margins_.clear();
+  object_max_margins_.clear();
+}
+
+}  // namespace tesseract::collision
@@ -108,14 +108,42 @@ ContactResult* processResult(ContactTestData& cdata,
                              ContactResult& contact,
                              const std::pair<std::string, std::string>& key,
                              bool found)
+{
+  return processResult(
+      cdata, contact, key, found, cdata.collision_margin_data.getCollisionMargin(key.first, key.second));
+}
+
+ContactResult* processResult(ContactTestData& cdata,
+                             ContactResult& contact,
+                             const std::pair<std::string, std::string>& key,
+                             bool found,
+                             double collision_margin)
 {
   if (cdata.req.is_valid && !(*cdata.req.is_valid)(contact))
     return nullptr;
 
-  if ((cdata.req.calculate_distance || cdata.req.calculate_penetration) &&
-      (contact.distance > cdata.collision_margin_data.getCollisionMargin(key.first, key.second)))
+  if ((cdata.req.calculate_distance || cdata.req.calculate_penetration) && (contact.distance > collision_margin))
     return nullptr;
 
+  // Only a contact closer than every contact found so far replaces the global minimum
+  if (cdata.req.type == ContactTestType::GLOBAL_MINIMUM && contact.distance >= cdata.global_minimum_distance)
+    return nullptr;
+
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  if (cdata.statistics != nullptr)
+    ++cdata.statistics->contacts;
+#endif
+
+  if (cdata.req.type == ContactTestType::GLOBAL_MINIMUM)
+  {
+    if (!cdata.global_minimum_key.first.empty() && cdata.global_minimum_key != key)
+      cdata.res->clearContactResult(cdata.global_minimum_key);
+
+    cdata.global_minimum_distance = contact.distance;
+    cdata.global_minimum_key = key;
+    return &(cdata.res->setContactResult(key, contact));
+  }
+
   if (!found)
   {
     if (cdata.req.type == ContactTestType::FIRST)
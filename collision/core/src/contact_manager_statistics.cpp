@@ -0,0 +1,125 @@
+/**
+ * @file contact_manager_statistics.cpp
+ * @brief Low overhead statistics collected by the contact managers during contactTest
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <sstream>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/collision/contact_manager_statistics.h>
+#include <tesseract/common/utils.h>
+
+namespace tesseract::collision
+{
+std::size_t ContactManagerStatistics::getNarrowphaseShapePairs(tesseract::geometry::GeometryType type1,
+                                                               tesseract::geometry::GeometryType type2) const
+{
+  const auto i = static_cast<std::size_t>(type1);
+  const auto j = static_cast<std::size_t>(type2);
+  return narrowphase_shape_pairs[(i * GEOMETRY_TYPE_COUNT) + j];
+}
+
+void ContactManagerStatistics::addNarrowphaseShapePair(tesseract::geometry::GeometryType type1,
+                                                       tesseract::geometry::GeometryType type2)
+{
+  const auto i = static_cast<std::size_t>(type1);
+  const auto j = static_cast<std::size_t>(type2);
+  ++narrowphase_shape_pairs[(i * GEOMETRY_TYPE_COUNT) + j];
+  if (i != j)
+    ++narrowphase_shape_pairs[(j * GEOMETRY_TYPE_COUNT) + i];
+}
+
+void ContactManagerStatistics::addNarrowphaseShapePairs(
+    const std::vector<std::shared_ptr<const tesseract::geometry::Geometry>>& shapes1,
+    const std::vector<std::shared_ptr<const tesseract::geometry::Geometry>>& shapes2)
+{
+  for (const auto& s1 : shapes1)
+  {
+    for (const auto& s2 : shapes2)
+      addNarrowphaseShapePair(s1->getType(), s2->getType());
+  }
+}
+
+void ContactManagerStatistics::reset() { *this = ContactManagerStatistics(); }
+
+std::string ContactManagerStatistics::toString() const
+{
+  std::stringstream ss;
+  ss << "Contact tests: " << contact_tests << "\n";
+  ss << "Broadphase pairs: " << broadphase_pairs << "\n";
+  ss << "Filtered pairs: " << filtered_pairs << "\n";
+  ss << "Approximation filtered pairs: " << approximation_filtered_pairs << "\n";
+  ss << "Narrowphase pairs: " << narrowphase_pairs << "\n";
+  ss << "Contacts: " << contacts << "\n";
+  ss << "Total time (s): " << total_time << "\n";
+  ss << "Broadphase time (s): " << getBroadphaseTime() << "\n";
+  ss << "Narrowphase time (s): " << narrowphase_time << "\n";
+  for (std::size_t i = 0; i < GEOMETRY_TYPE_COUNT; ++i)
+  {
+    for (std::size_t j = i; j < GEOMETRY_TYPE_COUNT; ++j)
+    {
+      const std::size_t cnt = narrowphase_shape_pairs[(i * GEOMETRY_TYPE_COUNT) + j];
+      if (cnt > 0)
+      {
+        ss << "Narrowphase " << tesseract::geometry::GeometryTypeStrings[i] << "-"
+           << tesseract::geometry::GeometryTypeStrings[j] << ": " << cnt << "\n";
+      }
+    }
+  }
+  return ss.str();
+}
+
+ContactManagerStatistics& ContactManagerStatistics::operator+=(const ContactManagerStatistics& rhs)
+{
+  contact_tests += rhs.contact_tests;
+  broadphase_pairs += rhs.broadphase_pairs;
+  filtered_pairs += rhs.filtered_pairs;
+  approximation_filtered_pairs += rhs.approximation_filtered_pairs;
+  narrowphase_pairs += rhs.narrowphase_pairs;
+  contacts += rhs.contacts;
+  total_time += rhs.total_time;
+  narrowphase_time += rhs.narrowphase_time;
+  for (std::size_t i = 0; i < narrowphase_shape_pairs.size(); ++i)
+    narrowphase_shape_pairs[i] += rhs.narrowphase_shape_pairs[i];
+
+  return *this;
+}
+
+bool ContactManagerStatistics::operator==(const ContactManagerStatistics& rhs) const
+{
+  bool ret_val = true;
+  ret_val &= (contact_tests == rhs.contact_tests);
+  ret_val &= (broadphase_pairs == rhs.broadphase_pairs);
+  ret_val &= (filtered_pairs == rhs.filtered_pairs);
+  ret_val &= (approximation_filtered_pairs == rhs.approximation_filtered_pairs);
+  ret_val &= (narrowphase_pairs == rhs.narrowphase_pairs);
+  ret_val &= (contacts == rhs.contacts);
+  ret_val &= tesseract::common::almostEqualRelativeAndAbs(total_time, rhs.total_time);
+  ret_val &= tesseract::common::almostEqualRelativeAndAbs(narrowphase_time, rhs.narrowphase_time);
+  ret_val &= (narrowphase_shape_pairs == rhs.narrowphase_shape_pairs);
+  return ret_val;
+}
+
+bool ContactManagerStatistics::operator!=(const ContactManagerStatistics& rhs) const { return !operator==(rhs); }
+
+}  // namespace tesseract::collision
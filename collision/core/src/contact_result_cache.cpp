@@ -0,0 +1,184 @@
+/**
+ * @file contact_result_cache.cpp
+ * @brief A cache of the contact results of each object pair between contact tests
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/collision/contact_result_cache.h>
+
+namespace tesseract::collision
+{
+ContactResultCache::ContactResultCache(double tolerance) : tolerance_(tolerance) {}
+
+void ContactResultCache::setEnabled(bool enabled)
+{
+  enabled_ = enabled;
+  if (!enabled_)
+    clear();
+}
+
+bool ContactResultCache::isEnabled() const { return enabled_; }
+
+void ContactResultCache::setTolerance(double tolerance)
+{
+  tolerance_ = tolerance;
+  clear();
+}
+
+double ContactResultCache::getTolerance() const { return tolerance_; }
+
+bool ContactResultCache::beginContactTest(const ContactRequest& request)
+{
+  pending_.clear();
+  if (!enabled_ || (request.type != ContactTestType::ALL && request.type != ContactTestType::CLOSEST))
+    return false;
+
+  if (request != request_)
+  {
+    entries_.clear();
+    request_ = request;
+  }
+
+  ++contact_test_;
+  return true;
+}
+
+bool ContactResultCache::reuseContactResults(const std::string& name1,
+                                             const Eigen::Isometry3d& tf1,
+                                             const std::string& name2,
+                                             const Eigen::Isometry3d& tf2,
+                                             ContactResultMap& results)
+{
+  const bool swapped = (name2 < name1);
+  auto key = swapped ? std::make_pair(name2, name1) : std::make_pair(name1, name2);
+  const Eigen::Isometry3d& first_tf = swapped ? tf2 : tf1;
+  const Eigen::Isometry3d relative_tf = first_tf.inverse() * (swapped ? tf1 : tf2);
+
+  auto it = entries_.find(key);
+  if (it != entries_.end())
+  {
+    Entry& entry = it->second;
+    if (entry.contact_test == contact_test_)
+      return entry.reused;
+
+    entry.contact_test = contact_test_;
+    if ((relative_tf.matrix() - entry.relative_tf.matrix()).cwiseAbs().maxCoeff() <= tolerance_)
+    {
+      // Both objects moved by the same transform, so the stored results are moved with them
+      const Eigen::Isometry3d delta = first_tf * entry.tf1.inverse();
+      const Eigen::Matrix3d delta_rotation = delta.linear();
+      for (const auto& stored : entry.results)
+      {
+        // For CLOSEST a stored result only replaces a closer result already in the map, like processResult
+        auto result_it = results.find(key);
+        const bool found = (result_it != results.end() && !result_it->second.empty());
+        if (found && request_.type == ContactTestType::CLOSEST && stored.distance >= result_it->second.front().distance)
+          continue;
+
+        ContactResult& result = (found && request_.type == ContactTestType::CLOSEST) ?
+                                    results.setContactResult(key, stored) :
+                                    results.addContactResult(key, stored);
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+          result.transform[i] = delta * result.transform[i];
+          result.cc_transform[i] = delta * result.cc_transform[i];
+          result.nearest_points[i] = delta * result.nearest_points[i];
+        }
+        result.normal = delta_rotation * result.normal;
+      }
+
+      entry.tf1 = first_tf;
+      entry.reused = true;
+      return true;
+    }
+
+    entry.tf1 = first_tf;
+    entry.relative_tf = relative_tf;
+    entry.reused = false;
+  }
+  else
+  {
+    Entry entry;
+    entry.tf1 = first_tf;
+    entry.relative_tf = relative_tf;
+    entry.contact_test = contact_test_;
+    entries_.emplace(key, entry);
+  }
+
+  // Remember the results the map already holds for the pair, so only the results of this contact test are stored
+  auto result_it = results.find(key);
+  const std::size_t offset = (result_it != results.end()) ? result_it->second.size() : 0;
+  pending_.emplace_back(std::move(key), offset);
+  return false;
+}
+
+void ContactResultCache::endContactTest(const ContactResultMap& results)
+{
+  for (const auto& pending : pending_)
+  {
+    auto it = entries_.find(pending.first);
+    if (it == entries_.end())
+      continue;
+
+    // For CLOSEST the map holds a single result per pair, so the result of this contact test can not be told apart
+    // from a result added before it and the pair is checked again by the next contact test
+    if (pending.second > 0 && request_.type == ContactTestType::CLOSEST)
+    {
+      entries_.erase(it);
+      continue;
+    }
+
+    Entry& entry = it->second;
+    entry.results.clear();
+
+    auto result_it = results.find(pending.first);
+    if (result_it != results.end() && result_it->second.size() > pending.second)
+      entry.results.assign(result_it->second.begin() + static_cast<std::ptrdiff_t>(pending.second),
+                           result_it->second.end());
+  }
+  pending_.clear();
+}
+
+void ContactResultCache::invalidate(const std::string& name)
+{
+  for (auto it = entries_.begin(); it != entries_.end();)
+  {
+    if (it->first.first == name || it->first.second == name)
+      it = entries_.erase(it);
+    else
+      ++it;
+  }
+}
+
+void ContactResultCache::clear()
+{
+  entries_.clear();
+  pending_.clear();
+}
+
+std::size_t ContactResultCache::size() const { return entries_.size(); }
+
+}  // namespace tesseract::collision
@@ -22,11 +22,29 @@
  * limitations under the License.
  */
 
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cassert>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract/collision/discrete_contact_manager.h>
 #include <tesseract/collision/utils.h>
+#include <tesseract/common/task_pool.h>
 
 namespace tesseract::collision
 {
+void DiscreteContactManager::setCollisionObjectsTransform(const std::vector<std::size_t>& indices,
+                                                          const tesseract::common::VectorIsometry3d& poses)
+{
+  assert(indices.size() == poses.size());
+  const std::vector<std::string>& names = getCollisionObjects();
+  for (std::size_t i = 0; i < indices.size(); ++i)
+  {
+    assert(indices[i] < names.size());
+    setCollisionObjectsTransform(names[indices[i]], poses[i]);
+  }
+}
+
 void DiscreteContactManager::applyContactManagerConfig(const ContactManagerConfig& config)
 {
   config.validate();
@@ -37,5 +55,24 @@ void DiscreteContactManager::applyContactManagerConfig(const ContactManagerConfi
   setCollisionMarginPairData(config.pair_margin_data, config.pair_margin_override_type);
   applyContactAllowedValidatorOverride(*this, config.acm, config.acm_override_type);
   applyModifyObjectEnabled(*this, config.modify_object_enabled);
+
+  if (config.approximation_type.has_value())
+    setContactApproximationType(config.approximation_type.value());
+
+  if (config.contact_result_cache_enabled.has_value())
+    setContactResultCacheEnabled(config.contact_result_cache_enabled.value());
+
+  if (config.parallel_narrowphase.has_value())
+  {
+    // The global task executor is never destroyed while the program runs, so the pointer does not own it
+    std::shared_ptr<tesseract::common::TaskExecutor> executor;
+    if (config.parallel_narrowphase.value())
+    {
+      tesseract::common::TaskExecutor& global_executor = tesseract::common::getGlobalTaskExecutor();
+      executor = std::shared_ptr<tesseract::common::TaskExecutor>(executor, &global_executor);
+    }
+
+    setNarrowphaseExecutor(executor);
+  }
 }
 }  // namespace tesseract::collision
@@ -0,0 +1,123 @@
+/**
+ * @file parallel_narrowphase.cpp
+ * @brief Utilities for checking the narrowphase pairs of a contact test in parallel
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <atomic>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/collision/parallel_narrowphase.h>
+#include <tesseract/collision/common.h>
+
+namespace tesseract::collision
+{
+void NarrowphaseBlockData::reset(const ContactTestData& contact_test_data)
+{
+  cdata = contact_test_data;
+  cdata.res = &results;
+  cdata.statistics = &statistics;
+  cdata.contact_result_cache = nullptr;
+  cdata.done = false;
+  results.clear();
+  statistics.reset();
+}
+
+std::size_t getNarrowphaseBlockCount(const tesseract::common::TaskExecutor& executor, std::size_t size)
+{
+  return std::max<std::size_t>(std::min(executor.getThreadCount() + 1, size), 1);
+}
+
+void checkNarrowphasePairs(tesseract::common::TaskExecutor& executor,
+                           ContactTestData& cdata,
+                           std::size_t size,
+                           std::vector<std::unique_ptr<NarrowphaseBlockData>>& blocks,
+                           const std::function<void(std::size_t, ContactTestData&, std::size_t)>& fn)
+{
+  if (size == 0 || cdata.done)
+    return;
+
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ContactStatisticsScopedTimer narrowphase_timer((cdata.statistics != nullptr) ? &cdata.statistics->narrowphase_time :
+                                                                                 nullptr);
+#endif
+
+  const std::size_t block_count = getNarrowphaseBlockCount(executor, size);
+  while (blocks.size() < block_count)
+    blocks.push_back(std::make_unique<NarrowphaseBlockData>());
+
+  for (std::size_t i = 0; i < block_count; ++i)
+    blocks[i]->reset(cdata);
+
+  std::atomic<bool> stop{ false };
+  auto check_block = [&](std::size_t block) {
+    NarrowphaseBlockData& data = *blocks[block];
+    const std::size_t end = ((block + 1) * size) / block_count;
+    for (std::size_t i = (block * size) / block_count; i < end && !stop.load(std::memory_order_relaxed); ++i)
+    {
+      fn(block, data.cdata, i);
+      if (data.cdata.done)
+        stop = true;
+    }
+  };
+
+  {
+    // The destructor of the group cancels and waits on the other blocks if the first block throws
+    tesseract::common::TaskGroup group(executor);
+    for (std::size_t i = 1; i < block_count; ++i)
+      group.run([&check_block, i]() { check_block(i); });
+
+    check_block(0);
+    group.wait();
+  }
+
+  // The contacts were counted by the blocks, so they are not counted again when they are merged
+  ContactManagerStatistics* statistics = cdata.statistics;
+  cdata.statistics = nullptr;
+  for (std::size_t i = 0; i < block_count; ++i)
+  {
+    NarrowphaseBlockData& data = *blocks[i];
+    for (const auto& pair : data.results)
+    {
+      for (const auto& result : pair.second)
+      {
+        if (cdata.done)
+          break;
+
+        const auto it = cdata.res->find(pair.first);
+        const bool found = (it != cdata.res->end() && !it->second.empty());
+        ContactResult contact = result;
+        processResult(cdata, contact, pair.first, found);
+      }
+    }
+
+    if (statistics != nullptr)
+    {
+      data.statistics.narrowphase_time = 0;
+      *statistics += data.statistics;
+    }
+  }
+  cdata.statistics = statistics;
+}
+
+}  // namespace tesseract::collision
@@ -141,6 +141,17 @@ ContactResult& ContactResultMap::setContactResult(const KeyType& key, const Mapp
   return cv.back();
 }
 
+void ContactResultMap::clearContactResult(const KeyType& key)
+{
+  auto it = data_.find(key);
+  if (it == data_.end())
+    return;
+
+  count_ -= static_cast<long>(it->second.size());
+  assert(count_ >= 0);
+  it->second.clear();
+}
+
 void ContactResultMap::addInterpolatedCollisionResults(ContactResultMap& sub_segment_results,
                                                        long sub_segment_index,
                                                        long sub_segment_last_index,
@@ -409,6 +420,9 @@ bool ContactManagerConfig::operator==(const ContactManagerConfig& rhs) const
   ret_val &= (acm == rhs.acm);
   ret_val &= (acm_override_type == rhs.acm_override_type);
   ret_val &= (modify_object_enabled == rhs.modify_object_enabled);
+  ret_val &= (approximation_type == rhs.approximation_type);
+  ret_val &= (contact_result_cache_enabled == rhs.contact_result_cache_enabled);
+  ret_val &= (parallel_narrowphase == rhs.parallel_narrowphase);
   return ret_val;
 }
 bool ContactManagerConfig::operator!=(const ContactManagerConfig& rhs) const { return !operator==(rhs); }
@@ -62,6 +62,14 @@ public:
    */
   void updateAABB();
 
+  /**
+   * @brief Set the internal AABB directly.
+   *
+   * This is used by link broadphase objects whose AABB is the union of the AABBs of the link shapes.
+   * @param new_aabb The AABB
+   */
+  void setAABB(const fcl::AABBd& new_aabb);
+
   /**
    * @brief Set the shape index. This is the geometries index in the urdf.
    * @param index The index
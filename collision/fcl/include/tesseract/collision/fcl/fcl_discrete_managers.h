@@ -41,10 +41,25 @@
 #define TESSERACT_COLLISION_FCL_DISCRETE_MANAGERS_H
 
 #include <tesseract/collision/discrete_contact_manager.h>
+#include <tesseract/collision/contact_result_cache.h>
+#include <tesseract/collision/parallel_narrowphase.h>
 #include <tesseract/collision/fcl/fcl_utils.h>
 
 namespace tesseract::collision
 {
+/** @brief Identify which objects the FCLDiscreteBVHManager registers with its broadphase */
+enum class FCLBroadphaseMode : std::uint8_t
+{
+  /** @brief Every shape of a link is a separate broadphase object */
+  SHAPE,
+  /**
+   * @brief Every link is a single broadphase object with the union of the AABBs of its shapes. The shapes are only
+   * iterated after the link pair passes the contact allowed validator and approximation filtering, which is faster
+   * for links with many shapes.
+   */
+  LINK
+};
+
 /** @brief A FCL implementation of the discrete contact manager */
 class FCLDiscreteBVHManager : public DiscreteContactManager
 {
@@ -54,7 +69,8 @@ public:
   using UPtr = std::unique_ptr<FCLDiscreteBVHManager>;
   using ConstUPtr = std::unique_ptr<const FCLDiscreteBVHManager>;
 
-  FCLDiscreteBVHManager(std::string name = "FCLDiscreteBVHManager");
+  FCLDiscreteBVHManager(std::string name = "FCLDiscreteBVHManager",
+                        FCLBroadphaseMode broadphase_mode = FCLBroadphaseMode::SHAPE);
   ~FCLDiscreteBVHManager() override = default;
   FCLDiscreteBVHManager(const FCLDiscreteBVHManager&) = delete;
   FCLDiscreteBVHManager& operator=(const FCLDiscreteBVHManager&) = delete;
@@ -86,6 +102,8 @@ public:
 
   bool isCollisionObjectEnabled(const std::string& name) const override final;
 
+  using DiscreteContactManager::setCollisionObjectsTransform;
+
   void setCollisionObjectsTransform(const std::string& name, const Eigen::Isometry3d& pose) override final;
 
   void setCollisionObjectsTransform(const std::vector<std::string>& names,
@@ -120,8 +138,27 @@ public:
 
   std::shared_ptr<const tesseract::common::ContactAllowedValidator> getContactAllowedValidator() const override final;
 
+  void setContactApproximationType(ContactApproximationType type) override final;
+
+  ContactApproximationType getContactApproximationType() const override final;
+
+  void setContactResultCacheEnabled(bool enabled) override final;
+
+  bool isContactResultCacheEnabled() const override final;
+
+  void setNarrowphaseExecutor(std::shared_ptr<tesseract::common::TaskExecutor> executor) override final;
+
+  std::shared_ptr<tesseract::common::TaskExecutor> getNarrowphaseExecutor() const override final;
+
+  const ContactManagerStatistics& getStatistics() const override final;
+
+  void resetStatistics() override final;
+
   void contactTest(ContactResultMap& collisions, const ContactRequest& request) override final;
 
+  /** @brief Get the objects registered with the broadphase */
+  FCLBroadphaseMode getBroadphaseMode() const;
+
   /**
    * @brief Add a fcl collision object to the manager
    * @param cow The tesseract fcl collision object
@@ -131,6 +168,9 @@ public:
 private:
   std::string name_;
 
+  /** @brief The objects registered with the broadphase */
+  FCLBroadphaseMode broadphase_mode_;
+
   /** @brief Broad-phase Collision Manager for active collision objects */
   std::unique_ptr<fcl::BroadPhaseCollisionManagerd> static_manager_;
 
@@ -141,18 +181,44 @@ private:
   std::vector<std::string> active_; /**< @brief A list of the active collision objects */
   std::vector<std::string> collision_objects_; /**< @brief A list of the collision objects */
   CollisionMarginData collision_margin_data_;  /**< @brief The contact distance threshold */
+  CollisionMarginTable collision_margin_table_; /**< @brief The compiled contact distance threshold table */
+  bool collision_margin_table_dirty_{ true };   /**< @brief Indicate if the margin table must be rebuilt */
   std::shared_ptr<const tesseract::common::ContactAllowedValidator> validator_; /**< @brief The is allowed collision
                                                                                   function */
   std::size_t fcl_co_count_{ 0 }; /**< @brief The number fcl collision objects */
 
+  /** @brief The geometry approximation used to reject pairs before the exact narrowphase check */
+  ContactApproximationType approximation_type_{ ContactApproximationType::NONE };
+
+  /** @brief The statistics collected during contactTest */
+  ContactManagerStatistics statistics_;
+
+  /** @brief The contact results of the pairs checked by previous contact tests */
+  ContactResultCache contact_result_cache_;
+
   /** @brief This is used to store static collision objects to update */
   std::vector<fcl_internal::CollisionObjectRawPtr> static_update_;
 
   /** @brief This is used to store dynamic collision objects to update */
   std::vector<fcl_internal::CollisionObjectRawPtr> dynamic_update_;
 
+  /** @brief The broadphase pairs with the distance between their AABBs, used to order a global minimum search */
+  std::vector<std::pair<double, std::pair<fcl::CollisionObjectd*, fcl::CollisionObjectd*>>> ordered_pairs_;
+
+  /** @brief The executor used to check the narrowphase pairs in parallel, nullptr to check them serially */
+  std::shared_ptr<tesseract::common::TaskExecutor> narrowphase_executor_;
+
+  /** @brief The broadphase pairs gathered when checking the narrowphase in parallel */
+  std::vector<std::pair<fcl::CollisionObjectd*, fcl::CollisionObjectd*>> narrowphase_pairs_;
+
+  /** @brief The results and statistics of each block of narrowphase pairs checked in parallel */
+  std::vector<std::unique_ptr<NarrowphaseBlockData>> narrowphase_blocks_;
+
   /** @brief This function will update internal data when margin data has changed */
   void onCollisionMarginDataChanged();
+
+  /** @brief Reassign collision object ids after the list of collision objects changed */
+  void updateCollisionObjectIndices();
 };
 
 }  // namespace tesseract::collision
@@ -51,6 +51,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/collision/types.h>
 #include <tesseract/collision/common.h>
+#include <tesseract/collision/bounding_spheres.h>
 #include <tesseract/collision/fcl/fcl_collision_object_wrapper.h>
 
 namespace tesseract::collision::fcl_internal
@@ -92,6 +93,10 @@ public:
 
   const std::string& getName() const { return name_; }
   const int& getTypeID() const { return type_id_; }
+  /** @brief Get the collision object id assigned by the contact manager, -1 if not assigned */
+  int getObjectIndex() const { return object_index_; }
+  /** @brief Set the collision object id, this is used to index the contact managers collision margin table */
+  void setObjectIndex(int index) { object_index_ = index; }
   /** \brief Check if two objects point to the same source object */
   bool sameObject(const CollisionObjectWrapper& other) const
   {
@@ -108,6 +113,9 @@ public:
 
   const tesseract::common::VectorIsometry3d& getCollisionGeometriesTransforms() const { return shape_poses_; }
 
+  /** @brief Get the conservative bounding spheres of the collision geometries relative to the object frame */
+  const BoundingSpheres& getBoundingSpheres() const { return bounding_spheres_; }
+
   void setCollisionObjectsTransform(const Eigen::Isometry3d& pose)
   {
     world_pose_ = pose;
@@ -116,6 +124,9 @@ public:
       co->setTransform(pose * shape_poses_[static_cast<std::size_t>(co->getShapeIndex())]);
       co->updateAABB();  // This a tesseract function that updates abb to take into account contact distance
     }
+
+    if (link_broadphase_)
+      updateLinkAABB();
   }
 
   void setContactDistanceThreshold(double contact_distance)
@@ -123,6 +134,9 @@ public:
     contact_distance_ = contact_distance;
     for (auto& co : collision_objects_)
       co->setContactDistanceThreshold(contact_distance_);
+
+    if (link_broadphase_)
+      updateLinkAABB();
   }
 
   double getContactDistanceThreshold() const { return contact_distance_; }
@@ -131,13 +145,42 @@ public:
   std::vector<CollisionObjectPtr>& getCollisionObjects() { return collision_objects_; }
   const std::vector<CollisionObjectRawPtr>& getCollisionObjectsRaw() const { return collision_objects_raw_; }
   std::vector<CollisionObjectRawPtr>& getCollisionObjectsRaw() { return collision_objects_raw_; }
+
+  /**
+   * @brief Register a single broadphase object for the link instead of one per shape
+   * @details The AABB of the link object is the union of the AABBs of the shapes. This must be called before the
+   * objects are registered with a broadphase manager.
+   * @param enabled Indicate if the link object should be used
+   */
+  void setLinkBroadphase(bool enabled);
+  bool isLinkBroadphase() const { return link_broadphase_; }
+
+  /** @brief Get the objects registered with the broadphase manager, the link object or the shape objects */
+  const std::vector<CollisionObjectPtr>& getBroadphaseObjects() const
+  {
+    return link_broadphase_ ? link_collision_objects_ : collision_objects_;
+  }
+  std::vector<CollisionObjectPtr>& getBroadphaseObjects()
+  {
+    return link_broadphase_ ? link_collision_objects_ : collision_objects_;
+  }
+  const std::vector<CollisionObjectRawPtr>& getBroadphaseObjectsRaw() const
+  {
+    return link_broadphase_ ? link_collision_objects_raw_ : collision_objects_raw_;
+  }
+  std::vector<CollisionObjectRawPtr>& getBroadphaseObjectsRaw()
+  {
+    return link_broadphase_ ? link_collision_objects_raw_ : collision_objects_raw_;
+  }
   std::shared_ptr<CollisionObjectWrapper> clone() const
   {
     auto clone_cow = std::make_shared<CollisionObjectWrapper>();
     clone_cow->name_ = name_;
     clone_cow->type_id_ = type_id_;
+    clone_cow->object_index_ = object_index_;
     clone_cow->shapes_ = shapes_;
     clone_cow->shape_poses_ = shape_poses_;
+    clone_cow->bounding_spheres_ = bounding_spheres_;
     clone_cow->collision_geometries_ = collision_geometries_;
 
     clone_cow->collision_objects_.reserve(collision_objects_.size());
@@ -157,6 +200,7 @@ public:
     clone_cow->m_collisionFilterGroup = m_collisionFilterGroup;
     clone_cow->m_collisionFilterMask = m_collisionFilterMask;
     clone_cow->m_enabled = m_enabled;
+    clone_cow->setLinkBroadphase(link_broadphase_);
     return clone_cow;
   }
 
@@ -170,9 +214,11 @@ public:
 protected:
   std::string name_;                                              // name of the collision object
   int type_id_{ -1 };                                             // user defined type id
+  int object_index_{ -1 };                                        // collision object id assigned by the manager
   Eigen::Isometry3d world_pose_{ Eigen::Isometry3d::Identity() }; /**< @brief Collision Object World Transformation */
   CollisionShapesConst shapes_;
   tesseract::common::VectorIsometry3d shape_poses_;
+  BoundingSpheres bounding_spheres_; /**< @brief The shapes bounding spheres relative to the object frame */
   std::vector<CollisionGeometryPtr> collision_geometries_;
   std::vector<CollisionObjectPtr> collision_objects_;
   /**
@@ -182,6 +228,13 @@ protected:
   std::vector<CollisionObjectRawPtr> collision_objects_raw_;
 
   double contact_distance_{ 0 }; /**< @brief The contact distance threshold */
+
+  bool link_broadphase_{ false }; /**< @brief Indicate if the link object is registered instead of the shapes */
+  std::vector<CollisionObjectPtr> link_collision_objects_; /**< @brief The link object, empty if not used */
+  std::vector<CollisionObjectRawPtr> link_collision_objects_raw_;
+
+  /** @brief Update the AABB of the link object to contain the AABBs of every shape */
+  void updateLinkAABB();
 };
 
 CollisionGeometryPtr createShapePrimitive(const CollisionShapeConstPtr& geom);
@@ -228,7 +281,7 @@ inline void updateCollisionObjectFilters(const std::vector<std::string>& active,
   {
     if (cow->m_collisionFilterGroup != CollisionFilterGroups::StaticFilter)
     {
-      std::vector<CollisionObjectPtr>& objects = cow->getCollisionObjects();
+      std::vector<CollisionObjectPtr>& objects = cow->getBroadphaseObjects();
       // This link was dynamic but is now static
       for (auto& co : objects)
         dynamic_manager->unregisterObject(co.get());
@@ -242,7 +295,7 @@ inline void updateCollisionObjectFilters(const std::vector<std::string>& active,
   {
     if (cow->m_collisionFilterGroup != CollisionFilterGroups::KinematicFilter)
     {
-      std::vector<CollisionObjectPtr>& objects = cow->getCollisionObjects();
+      std::vector<CollisionObjectPtr>& objects = cow->getBroadphaseObjects();
       // This link was static but is now dynamic
       for (auto& co : objects)
         static_manager->unregisterObject(co.get());
@@ -279,9 +332,55 @@ bool needsCollisionCheck(const CollisionObjectWrapper* cd1,
                          const std::shared_ptr<const tesseract::common::ContactAllowedValidator>& validator,
                          bool verbose);
 
+/**
+ * @brief Check if two fcl collision objects could be within their pair collision margin using the contact approximation
+ * @param o1 The first fcl collision object
+ * @param o2 The second fcl collision object
+ * @param cdata The contact test data containing the approximation type and collision margins
+ * @return False if the approximation guarantees the objects are further apart than the margin, otherwise true
+ */
+bool isApproximationWithinMargin(const fcl::CollisionObjectd* o1,
+                                 const fcl::CollisionObjectd* o2,
+                                 const ContactTestData& cdata);
+
+/**
+ * @brief Get the distance between the axis aligned bounding boxes of two fcl collision objects
+ * @details The half contact distance threshold the AABBs are expanded by is removed, so this is a lower bound of the
+ * distance between the objects when it is greater than zero.
+ * @param o1 The first fcl collision object
+ * @param o2 The second fcl collision object
+ * @return The distance between the bounding boxes, zero if they overlap
+ */
+double getAABBDistance(const fcl::CollisionObjectd* o1, const fcl::CollisionObjectd* o2);
+
+/**
+ * @brief Check if two fcl collision objects could be closer than the global minimum found so far
+ * @details This is always true unless the request type is ContactTestType::GLOBAL_MINIMUM. Overlapping bounding boxes
+ * do not bound the penetration depth so those pairs are never rejected.
+ * @param o1 The first fcl collision object
+ * @param o2 The second fcl collision object
+ * @param cdata The contact test data containing the request and the global minimum found so far
+ * @return False if the bounding boxes guarantee the objects are further apart than the global minimum, otherwise true
+ */
+bool isAABBWithinGlobalMinimum(const fcl::CollisionObjectd* o1,
+                               const fcl::CollisionObjectd* o2,
+                               const ContactTestData& cdata);
+
 bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data);
 
 bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data);
 
+/**
+ * @brief The collision callback used when the broadphase contains link objects
+ * @details The link pair is filtered once, afterwards every pair of shapes with overlapping AABBs is checked
+ */
+bool linkCollisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data);
+
+/**
+ * @brief The distance callback used when the broadphase contains link objects
+ * @details The link pair is filtered once, afterwards every pair of shapes with overlapping AABBs is checked
+ */
+bool linkDistanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data);
+
 }  // namespace tesseract::collision::fcl_internal
 #endif  // TESSERACT_COLLISION_FCL_UTILS_H
@@ -53,6 +53,8 @@ void FCLCollisionObjectWrapper::updateAABB()
   }
 }
 
+void FCLCollisionObjectWrapper::setAABB(const fcl::AABBd& new_aabb) { aabb = new_aabb; }
+
 void FCLCollisionObjectWrapper::setShapeIndex(int index) { shape_index_ = index; }
 
 int FCLCollisionObjectWrapper::getShapeIndex() const
@@ -37,6 +37,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <tesseract/collision/fcl/fcl_discrete_managers.h>
 #include <tesseract/common/contact_allowed_validator.h>
@@ -48,7 +49,8 @@ namespace tesseract::collision
 static const CollisionShapesConst EMPTY_COLLISION_SHAPES_CONST;
 static const tesseract::common::VectorIsometry3d EMPTY_COLLISION_SHAPES_TRANSFORMS;
 
-FCLDiscreteBVHManager::FCLDiscreteBVHManager(std::string name) : name_(std::move(name))
+FCLDiscreteBVHManager::FCLDiscreteBVHManager(std::string name, FCLBroadphaseMode broadphase_mode)
+  : name_(std::move(name)), broadphase_mode_(broadphase_mode)
 {
   static_manager_ = std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
   dynamic_manager_ = std::make_unique<fcl::DynamicAABBTreeCollisionManagerd>();
@@ -59,7 +61,7 @@ std::string FCLDiscreteBVHManager::getName() const { return name_; }
 
 DiscreteContactManager::UPtr FCLDiscreteBVHManager::clone() const
 {
-  auto manager = std::make_unique<FCLDiscreteBVHManager>();
+  auto manager = std::make_unique<FCLDiscreteBVHManager>(name_, broadphase_mode_);
 
   for (const auto& cow : link2cow_)
     manager->addCollisionObject(cow.second->clone());
@@ -67,6 +69,9 @@ DiscreteContactManager::UPtr FCLDiscreteBVHManager::clone() const
   manager->setActiveCollisionObjects(active_);
   manager->setCollisionMarginData(collision_margin_data_);
   manager->setContactAllowedValidator(validator_);
+  manager->setContactApproximationType(approximation_type_);
+  manager->setContactResultCacheEnabled(contact_result_cache_.isEnabled());
+  manager->setNarrowphaseExecutor(narrowphase_executor_);
 
   return manager;
 }
@@ -113,7 +118,7 @@ bool FCLDiscreteBVHManager::removeCollisionObject(const std::string& name)
   auto it = link2cow_.find(name);
   if (it != link2cow_.end())
   {
-    std::vector<CollisionObjectPtr>& objects = it->second->getCollisionObjects();
+    std::vector<CollisionObjectPtr>& objects = it->second->getBroadphaseObjects();
     fcl_co_count_ -= objects.size();
 
     std::vector<fcl::CollisionObject<double>*> static_objs;
@@ -137,6 +142,8 @@ bool FCLDiscreteBVHManager::removeCollisionObject(const std::string& name)
 
     collision_objects_.erase(std::find(collision_objects_.begin(), collision_objects_.end(), name));
     link2cow_.erase(name);
+    updateCollisionObjectIndices();
+    contact_result_cache_.invalidate(name);
     return true;
   }
   return false;
@@ -148,6 +155,7 @@ bool FCLDiscreteBVHManager::enableCollisionObject(const std::string& name)
   if (it != link2cow_.end())
   {
     it->second->m_enabled = true;
+    contact_result_cache_.invalidate(name);
     return true;
   }
   return false;
@@ -159,6 +167,7 @@ bool FCLDiscreteBVHManager::disableCollisionObject(const std::string& name)
   if (it != link2cow_.end())
   {
     it->second->m_enabled = false;
+    contact_result_cache_.invalidate(name);
     return true;
   }
   return false;
@@ -186,12 +195,12 @@ void FCLDiscreteBVHManager::setCollisionObjectsTransform(const std::string& name
       if (it->second->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
       {
         // Note: Calling update causes a re-balance of the AABB tree, which is expensive
-        static_manager_->update(it->second->getCollisionObjectsRaw());
+        static_manager_->update(it->second->getBroadphaseObjectsRaw());
       }
       else
       {
         // Note: Calling update causes a re-balance of the AABB tree, which is expensive
-        dynamic_manager_->update(it->second->getCollisionObjectsRaw());
+        dynamic_manager_->update(it->second->getBroadphaseObjectsRaw());
       }
     }
   }
@@ -214,7 +223,7 @@ void FCLDiscreteBVHManager::setCollisionObjectsTransform(const std::vector<std::
           !cur_tf.rotation().isApprox(poses[i].rotation(), 1e-8))
       {
         it->second->setCollisionObjectsTransform(poses[i]);
-        std::vector<CollisionObjectRawPtr>& co = it->second->getCollisionObjectsRaw();
+        std::vector<CollisionObjectRawPtr>& co = it->second->getBroadphaseObjectsRaw();
         if (it->second->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
         {
           static_update_.insert(static_update_.end(), co.begin(), co.end());
@@ -250,7 +259,7 @@ void FCLDiscreteBVHManager::setCollisionObjectsTransform(const tesseract::common
           !cur_tf.rotation().isApprox(transform.second.rotation(), 1e-8))
       {
         it->second->setCollisionObjectsTransform(transform.second);
-        std::vector<CollisionObjectRawPtr>& co = it->second->getCollisionObjectsRaw();
+        std::vector<CollisionObjectRawPtr>& co = it->second->getBroadphaseObjectsRaw();
         if (it->second->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
         {
           static_update_.insert(static_update_.end(), co.begin(), co.end());
@@ -276,6 +285,7 @@ const std::vector<std::string>& FCLDiscreteBVHManager::getCollisionObjects() con
 void FCLDiscreteBVHManager::setActiveCollisionObjects(const std::vector<std::string>& names)
 {
   active_ = names;
+  contact_result_cache_.clear();
 
   for (auto& co : link2cow_)
     updateCollisionObjectFilters(active_, co.second, static_manager_, dynamic_manager_);
@@ -326,6 +336,7 @@ void FCLDiscreteBVHManager::setContactAllowedValidator(
     std::shared_ptr<const tesseract::common::ContactAllowedValidator> validator)
 {
   validator_ = std::move(validator);
+  contact_result_cache_.clear();
 }
 std::shared_ptr<const tesseract::common::ContactAllowedValidator>
 FCLDiscreteBVHManager::getContactAllowedValidator() const
@@ -333,41 +344,163 @@ FCLDiscreteBVHManager::getContactAllowedValidator() const
   return validator_;
 }
 
+void FCLDiscreteBVHManager::setContactApproximationType(ContactApproximationType type) { approximation_type_ = type; }
+
+ContactApproximationType FCLDiscreteBVHManager::getContactApproximationType() const { return approximation_type_; }
+
+void FCLDiscreteBVHManager::setContactResultCacheEnabled(bool enabled) { contact_result_cache_.setEnabled(enabled); }
+
+bool FCLDiscreteBVHManager::isContactResultCacheEnabled() const { return contact_result_cache_.isEnabled(); }
+
+void FCLDiscreteBVHManager::setNarrowphaseExecutor(std::shared_ptr<tesseract::common::TaskExecutor> executor)
+{
+  narrowphase_executor_ = std::move(executor);
+}
+
+std::shared_ptr<tesseract::common::TaskExecutor> FCLDiscreteBVHManager::getNarrowphaseExecutor() const
+{
+  return narrowphase_executor_;
+}
+
+const ContactManagerStatistics& FCLDiscreteBVHManager::getStatistics() const { return statistics_; }
+
+void FCLDiscreteBVHManager::resetStatistics() { statistics_.reset(); }
+
 void FCLDiscreteBVHManager::contactTest(ContactResultMap& collisions, const ContactRequest& request)
 {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ++statistics_.contact_tests;
+  ContactStatisticsScopedTimer total_timer(&statistics_.total_time);
+#endif
+
+  if (collision_margin_table_dirty_)
+  {
+    collision_margin_table_.build(collision_margin_data_, collision_objects_);
+    collision_margin_table_dirty_ = false;
+  }
+
   ContactTestData cdata(collision_margin_data_, validator_, request, collisions);
+  cdata.collision_margin_table = &collision_margin_table_;
+  cdata.approximation_type = approximation_type_;
+  cdata.statistics = &statistics_;
+  cdata.contact_result_cache = contact_result_cache_.beginContactTest(request) ? &contact_result_cache_ : nullptr;
+  const bool link_broadphase = (broadphase_mode_ == FCLBroadphaseMode::LINK);
+  bool (*callback)(fcl::CollisionObjectd*, fcl::CollisionObjectd*, void*){ nullptr };
   if (collision_margin_data_.getMaxCollisionMargin() > 0)
+    callback = link_broadphase ? &linkDistanceCallback : &distanceCallback;
+  else
+    callback = link_broadphase ? &linkCollisionCallback : &collisionCallback;
+
+  if (request.type == ContactTestType::GLOBAL_MINIMUM)
   {
-    // TODO: Should the order be flipped?
+    // Check the closest pairs first so the global minimum shrinks quickly and prunes the remaining pairs
+    ordered_pairs_.clear();
+    auto gather = [](fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data) {
+      auto* pairs = static_cast<decltype(ordered_pairs_)*>(data);
+      pairs->emplace_back(getAABBDistance(o1, o2), std::make_pair(o1, o2));
+      return false;
+    };
+
     if (!static_manager_->empty())
-      static_manager_->collide(dynamic_manager_.get(), &cdata, &distanceCallback);
+      static_manager_->collide(dynamic_manager_.get(), &ordered_pairs_, gather);
+
+    if (!dynamic_manager_->empty())
+      dynamic_manager_->collide(&ordered_pairs_, gather);
+
+    std::stable_sort(ordered_pairs_.begin(), ordered_pairs_.end(), [](const auto& a, const auto& b) {
+      return a.first < b.first;
+    });
 
-    // It looks like the self check is as fast as selfDistanceContactTest even though it is N^2
-    if (!cdata.done && !dynamic_manager_->empty())
-      dynamic_manager_->collide(&cdata, &distanceCallback);
+    for (const auto& pair : ordered_pairs_)
+    {
+      if (callback(pair.second.first, pair.second.second, &cdata))
+        break;
+    }
+    return;
   }
-  else
+
+  if (narrowphase_executor_ != nullptr)
   {
-    // TODO: Should the order be flipped?
+    // Gather the broadphase pairs in the order they are checked serially, then check them in parallel. The cache is
+    // not thread safe, so the pairs with reusable results are skipped here.
+    struct GatherData
+    {
+      ContactTestData* cdata;
+      std::vector<std::pair<fcl::CollisionObjectd*, fcl::CollisionObjectd*>>* pairs;
+    };
+
+    narrowphase_pairs_.clear();
+    GatherData gather_data{ &cdata, &narrowphase_pairs_ };
+    auto gather = [](fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data) {
+      auto* gather_data = static_cast<GatherData*>(data);
+      ContactTestData& cdata = *gather_data->cdata;
+      if (cdata.contact_result_cache != nullptr)
+      {
+        const auto* cd1 = static_cast<const CollisionObjectWrapper*>(o1->getUserData());
+        const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
+        if (needsCollisionCheck(cd1, cd2, cdata.validator, false) &&
+            cdata.contact_result_cache->reuseContactResults(cd1->getName(),
+                                                            cd1->getCollisionObjectsTransform(),
+                                                            cd2->getName(),
+                                                            cd2->getCollisionObjectsTransform(),
+                                                            *cdata.res))
+          return false;
+      }
+
+      gather_data->pairs->emplace_back(o1, o2);
+      return false;
+    };
+
     if (!static_manager_->empty())
-      static_manager_->collide(dynamic_manager_.get(), &cdata, &collisionCallback);
+      static_manager_->collide(dynamic_manager_.get(), &gather_data, gather);
+
+    if (!dynamic_manager_->empty())
+      dynamic_manager_->collide(&gather_data, gather);
+
+    checkNarrowphasePairs(
+        *narrowphase_executor_,
+        cdata,
+        narrowphase_pairs_.size(),
+        narrowphase_blocks_,
+        [this, callback](std::size_t /*block*/, ContactTestData& block_cdata, std::size_t pair_index) {
+          const auto& pair = narrowphase_pairs_[pair_index];
+          callback(pair.first, pair.second, &block_cdata);
+        });
 
-    // It looks like the self check is as fast as selfDistanceContactTest even though it is N^2
-    if (!cdata.done && !dynamic_manager_->empty())
-      dynamic_manager_->collide(&cdata, &collisionCallback);
+    if (cdata.contact_result_cache != nullptr)
+      contact_result_cache_.endContactTest(collisions);
+
+    return;
   }
+
+  // TODO: Should the order be flipped?
+  if (!static_manager_->empty())
+    static_manager_->collide(dynamic_manager_.get(), &cdata, callback);
+
+  // It looks like the self check is as fast as selfDistanceContactTest even though it is N^2
+  if (!cdata.done && !dynamic_manager_->empty())
+    dynamic_manager_->collide(&cdata, callback);
+
+  if (cdata.contact_result_cache != nullptr)
+    contact_result_cache_.endContactTest(collisions);
 }
 
+FCLBroadphaseMode FCLDiscreteBVHManager::getBroadphaseMode() const { return broadphase_mode_; }
+
 void FCLDiscreteBVHManager::addCollisionObject(const COW::Ptr& cow)
 {
-  std::size_t cnt = cow->getCollisionObjectsRaw().size();
+  cow->setLinkBroadphase(broadphase_mode_ == FCLBroadphaseMode::LINK);
+  std::size_t cnt = cow->getBroadphaseObjectsRaw().size();
   fcl_co_count_ += cnt;
   static_update_.reserve(fcl_co_count_);
   dynamic_update_.reserve(fcl_co_count_);
+  cow->setObjectIndex(static_cast<int>(collision_objects_.size()));
   link2cow_[cow->getName()] = cow;
   collision_objects_.push_back(cow->getName());
+  collision_margin_table_dirty_ = true;
+  contact_result_cache_.invalidate(cow->getName());
 
-  std::vector<CollisionObjectPtr>& objects = cow->getCollisionObjects();
+  std::vector<CollisionObjectPtr>& objects = cow->getBroadphaseObjects();
   if (cow->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
   {
     // If static add to static manager
@@ -394,10 +527,15 @@ void FCLDiscreteBVHManager::onCollisionMarginDataChanged()
   static_update_.clear();
   dynamic_update_.clear();
 
+  collision_margin_table_.build(collision_margin_data_, collision_objects_);
+  collision_margin_table_dirty_ = false;
+  contact_result_cache_.clear();
+
   for (auto& cow : link2cow_)
   {
-    cow.second->setContactDistanceThreshold(collision_margin_data_.getMaxCollisionMargin(cow.second->getName()));
-    std::vector<CollisionObjectRawPtr>& co = cow.second->getCollisionObjectsRaw();
+    cow.second->setContactDistanceThreshold(
+        collision_margin_table_.getMaxCollisionMargin(static_cast<std::size_t>(cow.second->getObjectIndex())));
+    std::vector<CollisionObjectRawPtr>& co = cow.second->getBroadphaseObjectsRaw();
     if (cow.second->m_collisionFilterGroup == CollisionFilterGroups::StaticFilter)
     {
       static_update_.insert(static_update_.end(), co.begin(), co.end());
@@ -414,4 +552,12 @@ void FCLDiscreteBVHManager::onCollisionMarginDataChanged()
   if (!dynamic_update_.empty())
     dynamic_manager_->update(dynamic_update_);
 }
+
+void FCLDiscreteBVHManager::updateCollisionObjectIndices()
+{
+  for (std::size_t i = 0; i < collision_objects_.size(); ++i)
+    link2cow_[collision_objects_[i]]->setObjectIndex(static_cast<int>(i));
+
+  collision_margin_table_dirty_ = true;
+}
 }  // namespace tesseract::collision
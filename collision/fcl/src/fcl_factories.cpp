@@ -22,7 +22,13 @@
  * limitations under the License.
  */
 
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <cassert>
+#include <stdexcept>
+#include <yaml-cpp/yaml.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract/collision/fcl/fcl_factories.h>
 #include <tesseract/collision/fcl/fcl_discrete_managers.h>
 #include <tesseract/collision/discrete_contact_manager.h>
@@ -30,9 +36,24 @@
 namespace tesseract::collision
 {
 std::unique_ptr<tesseract::collision::DiscreteContactManager>
-FCLDiscreteBVHManagerFactory::create(const std::string& name, const YAML::Node& /*config*/) const
+FCLDiscreteBVHManagerFactory::create(const std::string& name, const YAML::Node& config) const
 {
-  return std::make_unique<FCLDiscreteBVHManager>(name);
+  FCLBroadphaseMode broadphase_mode{ FCLBroadphaseMode::SHAPE };
+  if (config.IsMap())
+  {
+    if (YAML::Node n = config["broadphase_mode"])
+    {
+      const auto mode = n.as<std::string>();
+      if (mode == "SHAPE")
+        broadphase_mode = FCLBroadphaseMode::SHAPE;
+      else if (mode == "LINK")
+        broadphase_mode = FCLBroadphaseMode::LINK;
+      else
+        throw std::runtime_error("FCLDiscreteBVHManagerFactory: Invalid broadphase_mode '" + mode + "'!");
+    }
+  }
+
+  return std::make_unique<FCLDiscreteBVHManager>(name, broadphase_mode);
 }
 
 PLUGIN_ANCHOR_IMPL(FCLFactoriesAnchor)  // LCOV_EXCL_LINE
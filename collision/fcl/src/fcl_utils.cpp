@@ -55,6 +55,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract/collision/fcl/fcl_utils.h>
 #include <tesseract/collision/fcl/fcl_collision_geometry_cache.h>
 #include <tesseract/geometry/geometries.h>
+#include <tesseract/collision/contact_result_cache.h>
 
 namespace tesseract::collision::fcl_internal
 {
@@ -225,33 +226,109 @@ bool needsCollisionCheck(const CollisionObjectWrapper* cd1,
          !isContactAllowed(cd1->getName(), cd2->getName(), validator, verbose);
 }
 
-bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data)
+bool isApproximationWithinMargin(const fcl::CollisionObjectd* o1,
+                                 const fcl::CollisionObjectd* o2,
+                                 const ContactTestData& cdata)
 {
-  auto* cdata = reinterpret_cast<ContactTestData*>(data);  // NOLINT
-
-  if (cdata->done)
+  if (cdata.approximation_type == ContactApproximationType::NONE)
     return true;
 
   const auto* cd1 = static_cast<const CollisionObjectWrapper*>(o1->getUserData());
   const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
 
-  if (!needsCollisionCheck(cd1, cd2, cdata->validator, false))
-    return false;
+  // Each fcl collision object is a single shape of the link so only its sphere is checked
+  const auto shape_index1 = static_cast<std::size_t>(CollisionObjectWrapper::getShapeIndex(o1));
+  const auto shape_index2 = static_cast<std::size_t>(CollisionObjectWrapper::getShapeIndex(o2));
+  const BoundingSphere& s1 = cd1->getBoundingSpheres()[shape_index1];
+  const BoundingSphere& s2 = cd2->getBoundingSpheres()[shape_index2];
+  const Eigen::Vector3d c1 = cd1->getCollisionObjectsTransform() * s1.center;
+  const Eigen::Vector3d c2 = cd2->getCollisionObjectsTransform() * s2.center;
+  const double margin = cdata.getEffectiveCollisionMargin(
+      cdata.getCollisionMargin(cd1->getObjectIndex(), cd1->getName(), cd2->getObjectIndex(), cd2->getName()));
+
+  return ((c1 - c2).norm() - s1.radius - s2.radius) <= margin;
+}
 
-  std::size_t num_contacts = (cdata->req.contact_limit > 0) ? static_cast<std::size_t>(cdata->req.contact_limit) :
-                                                              std::numeric_limits<std::size_t>::max();
-  if (cdata->req.type == ContactTestType::FIRST)
+double getAABBDistance(const fcl::CollisionObjectd* o1, const fcl::CollisionObjectd* o2)
+{
+  // The AABBs are expanded by half of the contact distance threshold which is removed again
+  const double d1 = static_cast<const FCLCollisionObjectWrapper*>(o1)->getContactDistanceThreshold() / 2.0;
+  const double d2 = static_cast<const FCLCollisionObjectWrapper*>(o2)->getContactDistanceThreshold() / 2.0;
+  const fcl::AABBd& aabb1 = o1->getAABB();
+  const fcl::AABBd& aabb2 = o2->getAABB();
+
+  // The gap along each axis, negative if the boxes overlap along that axis
+  const Eigen::Vector3d gap = (aabb2.min_ - aabb1.max_).cwiseMax(aabb1.min_ - aabb2.max_).array() + (d1 + d2);
+  return gap.cwiseMax(0.0).norm();
+}
+
+bool isAABBWithinGlobalMinimum(const fcl::CollisionObjectd* o1,
+                               const fcl::CollisionObjectd* o2,
+                               const ContactTestData& cdata)
+{
+  if (cdata.req.type != ContactTestType::GLOBAL_MINIMUM)
+    return true;
+
+  const double distance = getAABBDistance(o1, o2);
+  return (distance <= 0 || distance < cdata.global_minimum_distance);
+}
+
+namespace
+{
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+tesseract::geometry::GeometryType getShapeType(const CollisionObjectWrapper* cow, const fcl::CollisionObjectd* co)
+{
+  const auto shape_index = static_cast<std::size_t>(CollisionObjectWrapper::getShapeIndex(co));
+  return cow->getCollisionGeometries()[shape_index]->getType();
+}
+#endif
+
+/** @brief The narrowphase check of a pair of shapes which passed the filtering */
+using ShapePairCheck = bool (*)(fcl::CollisionObjectd* o1,
+                                fcl::CollisionObjectd* o2,
+                                const CollisionObjectWrapper* cd1,
+                                const CollisionObjectWrapper* cd2,
+                                const tesseract::common::LinkNamesPair& link_pair,
+                                double margin,
+                                ContactTestData& cdata);
+
+/**
+ * @brief Run the collision narrowphase for a pair of shapes and store the contacts
+ * @return True if the contact test is done, otherwise false
+ */
+bool collisionShapePair(fcl::CollisionObjectd* o1,
+                        fcl::CollisionObjectd* o2,
+                        const CollisionObjectWrapper* cd1,
+                        const CollisionObjectWrapper* cd2,
+                        const tesseract::common::LinkNamesPair& link_pair,
+                        double margin,
+                        ContactTestData& cdata)
+{
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ContactManagerStatistics* stats = cdata.statistics;
+  if (stats != nullptr)
+  {
+    ++stats->narrowphase_pairs;
+    stats->addNarrowphaseShapePair(getShapeType(cd1, o1), getShapeType(cd2, o2));
+  }
+#endif
+
+  std::size_t num_contacts = (cdata.req.contact_limit > 0) ? static_cast<std::size_t>(cdata.req.contact_limit) :
+                                                             std::numeric_limits<std::size_t>::max();
+  if (cdata.req.type == ContactTestType::FIRST)
     num_contacts = 1;
 
   fcl::CollisionResultd col_result;
-  fcl::collide(o1, o2, fcl::CollisionRequestd(num_contacts, cdata->req.calculate_penetration, 1, false), col_result);
+  {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    ContactStatisticsScopedTimer narrowphase_timer((stats != nullptr) ? &stats->narrowphase_time : nullptr);
+#endif
+    fcl::collide(o1, o2, fcl::CollisionRequestd(num_contacts, cdata.req.calculate_penetration, 1, false), col_result);
+  }
 
   if (!col_result.isCollision())
     return false;
 
-  TESSERACT_THREAD_LOCAL tesseract::common::LinkNamesPair link_pair;
-  tesseract::common::makeOrderedLinkPair(link_pair, cd1->getName(), cd2->getName());
-
   const Eigen::Isometry3d& tf1 = cd1->getCollisionObjectsTransform();
   const Eigen::Isometry3d& tf2 = cd2->getCollisionObjectsTransform();
   Eigen::Isometry3d tf1_inv = tf1.inverse();
@@ -278,33 +355,47 @@ bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, voi
     contact.distance = -1.0 * fcl_contact.penetration_depth;
     contact.normal = fcl_contact.normal;
 
-    const auto it = cdata->res->find(link_pair);
-    bool found = (it != cdata->res->end() && !it->second.empty());
+    const auto it = cdata.res->find(link_pair);
+    bool found = (it != cdata.res->end() && !it->second.empty());
 
-    processResult(*cdata, contact, link_pair, found);
+    processResult(cdata, contact, link_pair, found, margin);
   }
 
-  return cdata->done;
+  return cdata.done;
 }
 
-bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data)
+/**
+ * @brief Run the distance narrowphase for a pair of shapes and store the contact if it is within the margin
+ * @return True if the contact test is done, otherwise false
+ */
+bool distanceShapePair(fcl::CollisionObjectd* o1,
+                       fcl::CollisionObjectd* o2,
+                       const CollisionObjectWrapper* cd1,
+                       const CollisionObjectWrapper* cd2,
+                       const tesseract::common::LinkNamesPair& link_pair,
+                       double margin,
+                       ContactTestData& cdata)
 {
-  auto* cdata = reinterpret_cast<ContactTestData*>(data);  // NOLINT
-
-  if (cdata->done)
-    return true;
-
-  const auto* cd1 = static_cast<const CollisionObjectWrapper*>(o1->getUserData());
-  const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
-
-  if (!needsCollisionCheck(cd1, cd2, cdata->validator, false))
-    return false;
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ContactManagerStatistics* stats = cdata.statistics;
+  if (stats != nullptr)
+  {
+    ++stats->narrowphase_pairs;
+    stats->addNarrowphaseShapePair(getShapeType(cd1, o1), getShapeType(cd2, o2));
+  }
+#endif
 
   fcl::DistanceResultd fcl_result;
   fcl::DistanceRequestd fcl_request(true, true);
-  double d = fcl::distance(o1, o2, fcl_request, fcl_result);
+  double d{ 0 };
+  {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    ContactStatisticsScopedTimer narrowphase_timer((stats != nullptr) ? &stats->narrowphase_time : nullptr);
+#endif
+    d = fcl::distance(o1, o2, fcl_request, fcl_result);
+  }
 
-  if (d > cdata->collision_margin_data.getCollisionMargin(cd1->getName(), cd2->getName()))
+  if (d > margin)
     return false;
 
   const Eigen::Isometry3d& tf1 = cd1->getCollisionObjectsTransform();
@@ -335,14 +426,160 @@ bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void
   // TODO: There is an issue with FCL need to track down
   assert(!std::isnan(contact.nearest_points[0](0)));
 
+  const auto it = cdata.res->find(link_pair);
+  bool found = (it != cdata.res->end() && !it->second.empty());
+
+  processResult(cdata, contact, link_pair, found, margin);
+
+  return cdata.done;
+}
+
+/** @brief Filter a pair of shape objects from the broadphase and run the narrowphase */
+bool shapeCallbackHelper(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data, ShapePairCheck check)
+{
+  auto* cdata = reinterpret_cast<ContactTestData*>(data);  // NOLINT
+
+  if (cdata->done)
+    return true;
+
+  const auto* cd1 = static_cast<const CollisionObjectWrapper*>(o1->getUserData());
+  const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
+
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ContactManagerStatistics* stats = cdata->statistics;
+  if (stats != nullptr)
+    ++stats->broadphase_pairs;
+#endif
+
+  if (!needsCollisionCheck(cd1, cd2, cdata->validator, false))
+  {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    if (stats != nullptr)
+      ++stats->filtered_pairs;
+#endif
+    return false;
+  }
+
+  if (!isAABBWithinGlobalMinimum(o1, o2, *cdata) || !isApproximationWithinMargin(o1, o2, *cdata))
+  {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    if (stats != nullptr)
+      ++stats->approximation_filtered_pairs;
+#endif
+    return false;
+  }
+
+  if (cdata->contact_result_cache != nullptr &&
+      cdata->contact_result_cache->reuseContactResults(cd1->getName(),
+                                                       cd1->getCollisionObjectsTransform(),
+                                                       cd2->getName(),
+                                                       cd2->getCollisionObjectsTransform(),
+                                                       *cdata->res))
+    return false;
+
   TESSERACT_THREAD_LOCAL tesseract::common::LinkNamesPair link_pair;
   tesseract::common::makeOrderedLinkPair(link_pair, cd1->getName(), cd2->getName());
-  const auto it = cdata->res->find(link_pair);
-  bool found = (it != cdata->res->end() && !it->second.empty());
 
-  processResult(*cdata, contact, link_pair, found);
+  const double margin = cdata->getEffectiveCollisionMargin(
+      cdata->getCollisionMargin(cd1->getObjectIndex(), cd1->getName(), cd2->getObjectIndex(), cd2->getName()));
 
-  return cdata->done;
+  return check(o1, o2, cd1, cd2, link_pair, margin, *cdata);
+}
+
+/**
+ * @brief Filter a pair of link objects from the broadphase and run the narrowphase for their shapes
+ * @details The link pair is filtered once and only shape pairs with overlapping AABBs are checked
+ */
+bool linkCallbackHelper(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data, ShapePairCheck check)
+{
+  auto* cdata = reinterpret_cast<ContactTestData*>(data);  // NOLINT
+
+  if (cdata->done)
+    return true;
+
+  const auto* cd1 = static_cast<const CollisionObjectWrapper*>(o1->getUserData());
+  const auto* cd2 = static_cast<const CollisionObjectWrapper*>(o2->getUserData());
+
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  ContactManagerStatistics* stats = cdata->statistics;
+  if (stats != nullptr)
+    ++stats->broadphase_pairs;
+#endif
+
+  if (!needsCollisionCheck(cd1, cd2, cdata->validator, false))
+  {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    if (stats != nullptr)
+      ++stats->filtered_pairs;
+#endif
+    return false;
+  }
+
+  const double margin =
+      cdata->getCollisionMargin(cd1->getObjectIndex(), cd1->getName(), cd2->getObjectIndex(), cd2->getName());
+
+  if (!isAABBWithinGlobalMinimum(o1, o2, *cdata) ||
+      (cdata->approximation_type != ContactApproximationType::NONE &&
+       !isBoundingSpheresWithinMargin(cd1->getBoundingSpheres(),
+                                      cd1->getCollisionObjectsTransform(),
+                                      cd2->getBoundingSpheres(),
+                                      cd2->getCollisionObjectsTransform(),
+                                      cdata->getEffectiveCollisionMargin(margin))))
+  {
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+    if (stats != nullptr)
+      ++stats->approximation_filtered_pairs;
+#endif
+    return false;
+  }
+
+  if (cdata->contact_result_cache != nullptr &&
+      cdata->contact_result_cache->reuseContactResults(cd1->getName(),
+                                                       cd1->getCollisionObjectsTransform(),
+                                                       cd2->getName(),
+                                                       cd2->getCollisionObjectsTransform(),
+                                                       *cdata->res))
+    return false;
+
+  TESSERACT_THREAD_LOCAL tesseract::common::LinkNamesPair link_pair;
+  tesseract::common::makeOrderedLinkPair(link_pair, cd1->getName(), cd2->getName());
+
+  // The shape AABBs include half of the contact distance so they overlap if the shapes could be within the margin
+  for (const auto& co1 : cd1->getCollisionObjects())
+  {
+    for (const auto& co2 : cd2->getCollisionObjects())
+    {
+      if (!co1->getAABB().overlap(co2->getAABB()) || !isAABBWithinGlobalMinimum(co1.get(), co2.get(), *cdata))
+        continue;
+
+      // The global minimum may shrink while the shape pairs are checked
+      if (check(co1.get(), co2.get(), cd1, cd2, link_pair, cdata->getEffectiveCollisionMargin(margin), *cdata))
+        return true;
+    }
+  }
+
+  return false;
+}
+}  // namespace
+
+bool collisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data)
+{
+  return shapeCallbackHelper(o1, o2, data, &collisionShapePair);
+}
+
+bool distanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data)
+{
+  return shapeCallbackHelper(o1, o2, data, &distanceShapePair);
+}
+
+bool linkCollisionCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data)
+{
+  return linkCallbackHelper(o1, o2, data, &collisionShapePair);
+}
+
+bool linkDistanceCallback(fcl::CollisionObjectd* o1, fcl::CollisionObjectd* o2, void* data)
+{
+  return linkCallbackHelper(o1, o2, data, &distanceShapePair);
 }
 
 CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
@@ -356,6 +593,8 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
   assert(!name_.empty());                         // NOLINT
   assert(shapes_.size() == shape_poses_.size());  // NOLINT
 
+  bounding_spheres_ = computeBoundingSpheres(shapes_, shape_poses_);
+
   m_collisionFilterGroup = CollisionFilterGroups::KinematicFilter;
   m_collisionFilterMask = CollisionFilterGroups::StaticFilter | CollisionFilterGroups::KinematicFilter;
 
@@ -401,6 +640,34 @@ CollisionObjectWrapper::CollisionObjectWrapper(std::string name,
   }
 }
 
+void CollisionObjectWrapper::setLinkBroadphase(bool enabled)
+{
+  link_broadphase_ = enabled;
+  link_collision_objects_.clear();
+  link_collision_objects_raw_.clear();
+  if (!link_broadphase_ || collision_objects_.empty())
+    return;
+
+  // The geometry is only required by fcl, the AABB is always set to the union of the shape AABBs
+  auto co = std::make_shared<FCLCollisionObjectWrapper>(collision_geometries_.front());
+  co->setUserData(this);
+  link_collision_objects_.push_back(co);
+  link_collision_objects_raw_.push_back(co.get());
+  updateLinkAABB();
+}
+
+void CollisionObjectWrapper::updateLinkAABB()
+{
+  if (link_collision_objects_.empty())
+    return;
+
+  fcl::AABBd aabb = collision_objects_.front()->getAABB();
+  for (std::size_t i = 1; i < collision_objects_.size(); ++i)
+    aabb += collision_objects_[i]->getAABB();
+
+  link_collision_objects_.front()->setAABB(aabb);
+}
+
 int CollisionObjectWrapper::getShapeIndex(const fcl::CollisionObjectd* co)
 {
   return static_cast<const FCLCollisionObjectWrapper*>(co)->getShapeIndex();
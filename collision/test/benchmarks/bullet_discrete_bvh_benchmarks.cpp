@@ -5,6 +5,7 @@
 #include <tesseract/collision/test_suite/benchmarks/large_dataset_benchmarks.hpp>
 #include <tesseract/collision/test_suite/benchmarks/benchmark_utils.hpp>
 #include <tesseract/collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract/common/task_pool.h>
 #include <tesseract/geometry/geometry.h>
 
 using namespace tesseract::collision;
@@ -330,6 +331,47 @@ int main(int argc, char** argv)
     }
   }
 
+  //////////////////////////////////////
+  // Large Dataset parallel narrowphase contactTest
+  //////////////////////////////////////
+  if (std::string(BENCHMARK_ARGS) != "CI_ONLY")
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int, tesseract::geometry::GeometryType)>
+        BM_LARGE_DATASET_MULTILINK_FUNC = BM_LARGE_DATASET_MULTILINK;
+    std::vector<int> edge_sizes = { 4, 8, 12 };
+    std::vector<std::pair<tesseract::geometry::GeometryType, std::string>> types = {
+      { tesseract::geometry::GeometryType::CONVEX_MESH, "CONVEX_MESH" },
+      { tesseract::geometry::GeometryType::SPHERE, "PRIMATIVE" },
+      { tesseract::geometry::GeometryType::MESH, "DETAILED_MESH" }
+    };
+
+    // The same checks with the narrowphase pairs checked serially and on a task pool
+    auto task_pool = std::make_shared<tesseract::common::TaskPool>();
+    for (const auto& type : types)
+    {
+      for (const auto& edge_size : edge_sizes)
+      {
+        DiscreteContactManager::Ptr serial = checker->clone();
+        serial->setNarrowphaseExecutor(nullptr);
+        std::string name = "BM_LARGE_DATASET_MULTILINK_" + checker->getName() + "_SERIAL_NARROWPHASE_" + type.second +
+                           "_EDGE_SIZE_" + std::to_string(edge_size);
+        // NOLINTNEXTLINE
+        benchmark::RegisterBenchmark(name.c_str(), BM_LARGE_DATASET_MULTILINK_FUNC, serial, edge_size, type.first)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+        DiscreteContactManager::Ptr parallel = checker->clone();
+        parallel->setNarrowphaseExecutor(task_pool);
+        name = "BM_LARGE_DATASET_MULTILINK_" + checker->getName() + "_PARALLEL_NARROWPHASE_" + type.second +
+               "_EDGE_SIZE_" + std::to_string(edge_size);
+        // NOLINTNEXTLINE
+        benchmark::RegisterBenchmark(name.c_str(), BM_LARGE_DATASET_MULTILINK_FUNC, parallel, edge_size, type.first)
+            ->UseRealTime()
+            ->Unit(benchmark::TimeUnit::kMicrosecond);
+      }
+    }
+  }
+
   benchmark::Initialize(&argc, argv);
   benchmark::RunSpecifiedBenchmarks();
 }
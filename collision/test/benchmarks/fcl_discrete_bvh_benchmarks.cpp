@@ -17,6 +17,8 @@ static const bool RUN_QUICK = true;
 int main(int argc, char** argv)
 {
   const FCLDiscreteBVHManager::ConstPtr checker = std::make_shared<FCLDiscreteBVHManager>();
+  const FCLDiscreteBVHManager::ConstPtr link_checker =
+      std::make_shared<FCLDiscreteBVHManager>("FCLDiscreteBVHLinkManager", FCLBroadphaseMode::LINK);
 
   //////////////////////////////////////
   // Clone
@@ -345,6 +347,61 @@ int main(int argc, char** argv)
     }
   }
 
+  //////////////////////////////////////
+  // Large Dataset contactTest comparing the shape and link broadphase modes
+  //////////////////////////////////////
+  if (std::string(BENCHMARK_ARGS) != "CI_ONLY")
+  {
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int, tesseract::geometry::GeometryType)>
+        BM_LARGE_DATASET_MULTILINK_FUNC = BM_LARGE_DATASET_MULTILINK;
+    std::function<void(benchmark::State&, DiscreteContactManager::Ptr, int, tesseract::geometry::GeometryType)>
+        BM_LARGE_DATASET_SINGLELINK_FUNC = BM_LARGE_DATASET_SINGLELINK;
+    std::vector<int> edge_sizes = { 2, 4, 6, 8, 10 };
+
+    for (const auto& edge_size : edge_sizes)
+    {
+      DiscreteContactManager::Ptr clone = link_checker->clone();
+      std::string name = "BM_LARGE_DATASET_MULTILINK_" + link_checker->getName() + "_PRIMATIVE_EDGE_SIZE_" +
+                         std::to_string(edge_size);
+      // NOLINTNEXTLINE
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_LARGE_DATASET_MULTILINK_FUNC,
+                                   clone,
+                                   edge_size,
+                                   tesseract::geometry::GeometryType::SPHERE)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+    }
+    for (const auto& edge_size : edge_sizes)
+    {
+      DiscreteContactManager::Ptr clone = link_checker->clone();
+      std::string name = "BM_LARGE_DATASET_SINGLELINK_" + link_checker->getName() + "_PRIMATIVE_EDGE_SIZE_" +
+                         std::to_string(edge_size);
+      // NOLINTNEXTLINE
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_LARGE_DATASET_SINGLELINK_FUNC,
+                                   clone,
+                                   edge_size,
+                                   tesseract::geometry::GeometryType::SPHERE)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+    }
+    for (const auto& edge_size : edge_sizes)
+    {
+      DiscreteContactManager::Ptr clone = link_checker->clone();
+      std::string name = "BM_LARGE_DATASET_SINGLELINK_" + link_checker->getName() + "_CONVEX_MESH_EDGE_SIZE_" +
+                         std::to_string(edge_size);
+      // NOLINTNEXTLINE
+      benchmark::RegisterBenchmark(name.c_str(),
+                                   BM_LARGE_DATASET_SINGLELINK_FUNC,
+                                   clone,
+                                   edge_size,
+                                   tesseract::geometry::GeometryType::CONVEX_MESH)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kNanosecond);
+    }
+  }
+
   benchmark::Initialize(&argc, argv);
   benchmark::RunSpecifiedBenchmarks();
 }
@@ -40,6 +40,12 @@ TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionBoxBoxUnit)  // NOLINT
   test_suite::runTest(checker, false);
 }
 
+TEST(TesseractCollisionUnit, FCLDiscreteBVHLinkCollisionBoxBoxUnit)  // NOLINT
+{
+  FCLDiscreteBVHManager checker("FCLDiscreteBVHManager", FCLBroadphaseMode::LINK);
+  test_suite::runTest(checker, false);
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionBoxBoxConvexHullUnit)  // NOLINT
 {
   FCLDiscreteBVHManager checker;
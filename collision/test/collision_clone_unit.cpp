@@ -28,6 +28,12 @@ TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionCloneUnit)  // NOLINT
   test_suite::runTest(checker, 0.001, 0.001, 0.001);
 }
 
+TEST(TesseractCollisionUnit, FCLDiscreteBVHLinkCollisionCloneUnit)  // NOLINT
+{
+  FCLDiscreteBVHManager checker("FCLDiscreteBVHManager", FCLBroadphaseMode::LINK);
+  test_suite::runTest(checker, 0.001, 0.001, 0.001);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
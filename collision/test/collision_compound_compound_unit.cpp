@@ -30,6 +30,12 @@ TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionCompoundCompoundUnit)  // NO
   test_suite::runTest(checker);
 }
 
+TEST(TesseractCollisionUnit, FCLDiscreteBVHLinkCollisionCompoundCompoundUnit)  // NOLINT
+{
+  FCLDiscreteBVHManager checker("FCLDiscreteBVHManager", FCLBroadphaseMode::LINK);
+  test_suite::runTest(checker);
+}
+
 TEST(TesseractCollisionUnit, BulletContinuousSimpleCollisionCompoundCompoundUnit)  // NOLINT
 {
   BulletCastSimpleManager checker;
@@ -13,8 +13,14 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/collision/common.h>
 #include <tesseract/collision/types.h>
+#include <tesseract/collision/collision_margin_table.h>
+#include <tesseract/collision/contact_result_cache.h>
+#include <tesseract/collision/parallel_narrowphase.h>
+#include <tesseract/collision/bounding_spheres.h>
+#include <tesseract/collision/contact_manager_statistics.h>
 #include <tesseract/collision/yaml_extensions.h>
 #include <tesseract/collision/cereal_serialization.h>
+#include <tesseract/geometry/geometries.h>
 
 class TestContactAllowedValidator : public tesseract::common::ContactAllowedValidator
 {
@@ -164,6 +170,9 @@ TEST(TesseractCoreUnit, ContactManagerConfigYamlUnit)  // NOLINT
     modify_object_enabled:
       object1: true
       object2: false
+    approximation_type: BOUNDING_SPHERES
+    contact_result_cache_enabled: true
+    parallel_narrowphase: true
   )";
 
   tesseract::collision::ContactManagerConfig data_original;
@@ -174,6 +183,9 @@ TEST(TesseractCoreUnit, ContactManagerConfigYamlUnit)  // NOLINT
   data_original.acm.addAllowedCollision("linkA", "linkB", "always");
   data_original.modify_object_enabled["object1"] = true;
   data_original.modify_object_enabled["object2"] = false;
+  data_original.approximation_type = tesseract::collision::ContactApproximationType::BOUNDING_SPHERES;
+  data_original.contact_result_cache_enabled = true;
+  data_original.parallel_narrowphase = true;
 
   // Decode test
   {
@@ -244,6 +256,15 @@ TEST(TesseractCoreUnit, ContactManagerConfigYamlUnit)  // NOLINT
     EXPECT_TRUE(output_n["modify_object_enabled"]);
     EXPECT_EQ(output_n["modify_object_enabled"]["object1"].as<bool>(), true);
     EXPECT_EQ(output_n["modify_object_enabled"]["object2"].as<bool>(), false);
+
+    EXPECT_TRUE(output_n["approximation_type"]);
+    EXPECT_EQ(output_n["approximation_type"].as<std::string>(), "BOUNDING_SPHERES");
+
+    EXPECT_TRUE(output_n["contact_result_cache_enabled"]);
+    EXPECT_TRUE(output_n["contact_result_cache_enabled"].as<bool>());
+
+    EXPECT_TRUE(output_n["parallel_narrowphase"]);
+    EXPECT_TRUE(output_n["parallel_narrowphase"].as<bool>());
   }
 
   // Encode-decode cycle test
@@ -304,6 +325,365 @@ TEST(TesseractCoreUnit, isContactAllowedUnit)  // NOLINT
   EXPECT_TRUE(tesseract::collision::isContactAllowed("base_link", "link_1", validator, true));
 }
 
+TEST(TesseractCoreUnit, CollisionMarginTableUnit)  // NOLINT
+{
+  std::vector<std::string> object_names{ "base_link", "link_1", "link_2", "part_link" };
+
+  {  // Default margin only
+    tesseract::collision::CollisionMarginData data(0.05);
+    tesseract::collision::CollisionMarginTable table(data, object_names);
+    EXPECT_EQ(table.size(), 4U);
+    EXPECT_FALSE(table.hasPairMargins());
+    EXPECT_NEAR(table.getMaxCollisionMargin(), 0.05, 1e-8);
+    for (std::size_t i = 0; i < object_names.size(); ++i)
+    {
+      EXPECT_NEAR(table.getMaxCollisionMargin(i), 0.05, 1e-8);
+      for (std::size_t j = 0; j < object_names.size(); ++j)
+        EXPECT_NEAR(table.getCollisionMargin(i, j), 0.05, 1e-8);
+    }
+  }
+
+  {  // Pair margins, including a pair for an unknown object
+    tesseract::collision::CollisionMarginData data(0.05);
+    data.setCollisionMargin("link_2", "base_link", 0.1);
+    data.setCollisionMargin("link_1", "part_link", 0.01);
+    data.setCollisionMargin("link_1", "unknown_link", 0.5);
+    tesseract::collision::CollisionMarginTable table(data, object_names);
+    EXPECT_EQ(table.size(), 4U);
+    EXPECT_TRUE(table.hasPairMargins());
+    EXPECT_NEAR(table.getMaxCollisionMargin(), data.getMaxCollisionMargin(), 1e-8);
+    for (std::size_t i = 0; i < object_names.size(); ++i)
+    {
+      for (std::size_t j = 0; j < object_names.size(); ++j)
+      {
+        if (i == j)
+          continue;
+
+        EXPECT_NEAR(
+            table.getCollisionMargin(i, j), data.getCollisionMargin(object_names[i], object_names[j]), 1e-8);
+      }
+    }
+
+    EXPECT_NEAR(table.getMaxCollisionMargin(0), 0.1, 1e-8);
+    EXPECT_NEAR(table.getMaxCollisionMargin(1), 0.05, 1e-8);
+    EXPECT_NEAR(table.getMaxCollisionMargin(2), 0.1, 1e-8);
+    EXPECT_NEAR(table.getMaxCollisionMargin(3), 0.05, 1e-8);
+
+    // Rebuild after incrementing the margins
+    data.incrementMargins(0.1);
+    table.build(data, object_names);
+    EXPECT_NEAR(table.getCollisionMargin(0, 2), 0.2, 1e-8);
+    EXPECT_NEAR(table.getCollisionMargin(2, 0), 0.2, 1e-8);
+    EXPECT_NEAR(table.getCollisionMargin(1, 3), 0.11, 1e-8);
+    EXPECT_NEAR(table.getCollisionMargin(1, 2), 0.15, 1e-8);
+
+    // Check the contact test data lookup uses the table and falls back to names
+    tesseract::collision::ContactTestData cdata;
+    cdata.collision_margin_data = data;
+    EXPECT_NEAR(cdata.getCollisionMargin(0, "base_link", 2, "link_2"), 0.2, 1e-8);
+    cdata.collision_margin_table = &table;
+    EXPECT_NEAR(cdata.getCollisionMargin(0, "base_link", 2, "link_2"), 0.2, 1e-8);
+    EXPECT_NEAR(cdata.getCollisionMargin(-1, "base_link", 2, "link_2"), 0.2, 1e-8);
+  }
+
+  tesseract::collision::CollisionMarginTable table;
+  table.build(tesseract::collision::CollisionMarginData(0.05), object_names);
+  table.clear();
+  EXPECT_EQ(table.size(), 0U);
+  EXPECT_FALSE(table.hasPairMargins());
+}
+
+TEST(TesseractCoreUnit, ContactResultCacheUnit)  // NOLINT
+{
+  using tesseract::collision::ContactRequest;
+  using tesseract::collision::ContactResult;
+  using tesseract::collision::ContactResultCache;
+  using tesseract::collision::ContactResultMap;
+  using tesseract::collision::ContactTestType;
+
+  Eigen::Isometry3d tf_a = Eigen::Isometry3d::Identity();
+  Eigen::Isometry3d tf_b = Eigen::Isometry3d::Identity();
+  tf_b.translation() = Eigen::Vector3d(1, 0, 0);
+
+  ContactResult contact;
+  contact.link_names = { "link_a", "link_b" };
+  contact.distance = 0.5;
+  contact.transform = { tf_a, tf_b };
+  contact.nearest_points = { Eigen::Vector3d(0.25, 0, 0), Eigen::Vector3d(0.75, 0, 0) };
+  contact.nearest_points_local = contact.nearest_points;
+  contact.normal = Eigen::Vector3d(1, 0, 0);
+
+  const auto key = tesseract::common::makeOrderedLinkPair("link_a", "link_b");
+  ContactRequest request(ContactTestType::ALL);
+
+  ContactResultCache cache;
+  EXPECT_FALSE(cache.isEnabled());
+  EXPECT_FALSE(cache.beginContactTest(request));
+  cache.setEnabled(true);
+  EXPECT_TRUE(cache.isEnabled());
+
+  // The first contact test computes the results
+  ContactResultMap results;
+  EXPECT_TRUE(cache.beginContactTest(request));
+  EXPECT_FALSE(cache.reuseContactResults("link_b", tf_b, "link_a", tf_a, results));
+  results.addContactResult(key, contact);
+  cache.endContactTest(results);
+  EXPECT_EQ(cache.size(), 1U);
+
+  // Moving both objects by the same transform reuses the moved results
+  Eigen::Isometry3d delta = Eigen::Isometry3d::Identity();
+  delta.translation() = Eigen::Vector3d(0, 2, 0);
+  delta.linear() = Eigen::AngleAxisd(M_PI_2, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+  results.clear();
+  EXPECT_TRUE(cache.beginContactTest(request));
+  EXPECT_TRUE(cache.reuseContactResults("link_a", delta * tf_a, "link_b", delta * tf_b, results));
+  EXPECT_TRUE(cache.reuseContactResults("link_a", delta * tf_a, "link_b", delta * tf_b, results));
+  cache.endContactTest(results);
+  ASSERT_EQ(results.count(), 1);
+  const ContactResult& moved = results.at(key).front();
+  EXPECT_NEAR(moved.distance, 0.5, 1e-8);
+  EXPECT_TRUE(moved.transform[1].isApprox(delta * tf_b, 1e-8));
+  EXPECT_TRUE(moved.nearest_points[0].isApprox(Eigen::Vector3d(0, 2.25, 0), 1e-8));
+  EXPECT_TRUE(moved.nearest_points[1].isApprox(Eigen::Vector3d(0, 2.75, 0), 1e-8));
+  EXPECT_TRUE(moved.nearest_points_local[1].isApprox(contact.nearest_points_local[1], 1e-8));
+  EXPECT_TRUE(moved.normal.isApprox(Eigen::Vector3d(0, 1, 0), 1e-8));
+
+  // Changing the relative transform requires the narrowphase check and stores the new results
+  Eigen::Isometry3d tf_b_far = tf_b;
+  tf_b_far.translation() = Eigen::Vector3d(3, 0, 0);
+  results.clear();
+  EXPECT_TRUE(cache.beginContactTest(request));
+  EXPECT_FALSE(cache.reuseContactResults("link_a", tf_a, "link_b", tf_b_far, results));
+  EXPECT_FALSE(cache.reuseContactResults("link_a", tf_a, "link_b", tf_b_far, results));
+  cache.endContactTest(results);
+  EXPECT_EQ(results.count(), 0);
+
+  results.clear();
+  EXPECT_TRUE(cache.beginContactTest(request));
+  EXPECT_TRUE(cache.reuseContactResults("link_a", tf_a, "link_b", tf_b_far, results));
+  cache.endContactTest(results);
+  EXPECT_EQ(results.count(), 0);
+
+  // Changing the request clears the cache
+  EXPECT_TRUE(cache.beginContactTest(ContactRequest(ContactTestType::CLOSEST)));
+  EXPECT_EQ(cache.size(), 0U);
+  cache.endContactTest(results);
+
+  // The other contact test types are not cached
+  EXPECT_FALSE(cache.beginContactTest(ContactRequest(ContactTestType::FIRST)));
+  EXPECT_FALSE(cache.beginContactTest(ContactRequest(ContactTestType::LIMITED)));
+  EXPECT_FALSE(cache.beginContactTest(ContactRequest(ContactTestType::GLOBAL_MINIMUM)));
+
+  // Invalidate only removes the pairs of the object
+  results.clear();
+  EXPECT_TRUE(cache.beginContactTest(request));
+  EXPECT_FALSE(cache.reuseContactResults("link_a", tf_a, "link_b", tf_b, results));
+  EXPECT_FALSE(cache.reuseContactResults("link_a", tf_a, "link_c", tf_b, results));
+  EXPECT_FALSE(cache.reuseContactResults("link_c", tf_a, "link_d", tf_b, results));
+  cache.endContactTest(results);
+  EXPECT_EQ(cache.size(), 3U);
+  cache.invalidate("link_a");
+  EXPECT_EQ(cache.size(), 1U);
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0U);
+
+  // A result map which is not cleared between contact tests only stores the results of the contact test
+  ContactResult closer = contact;
+  closer.distance = 0.25;
+  results.clear();
+  results.addContactResult(key, contact);
+  EXPECT_TRUE(cache.beginContactTest(request));
+  EXPECT_FALSE(cache.reuseContactResults("link_a", tf_a, "link_b", tf_b, results));
+  results.addContactResult(key, closer);
+  cache.endContactTest(results);
+  EXPECT_TRUE(cache.beginContactTest(request));
+  EXPECT_TRUE(cache.reuseContactResults("link_a", tf_a, "link_b", tf_b, results));
+  cache.endContactTest(results);
+  ASSERT_EQ(results.at(key).size(), 3U);
+  EXPECT_NEAR(results.at(key)[0].distance, 0.5, 1e-8);
+  EXPECT_NEAR(results.at(key)[1].distance, 0.25, 1e-8);
+  EXPECT_NEAR(results.at(key)[2].distance, 0.25, 1e-8);
+
+  // For CLOSEST the result of a pair which already has a result is not stored
+  ContactRequest closest_request(ContactTestType::CLOSEST);
+  EXPECT_TRUE(cache.beginContactTest(closest_request));
+  EXPECT_FALSE(cache.reuseContactResults("link_a", tf_a, "link_b", tf_b, results));
+  results.setContactResult(key, closer);
+  cache.endContactTest(results);
+  EXPECT_EQ(cache.size(), 0U);
+  results.clear();
+
+  // Disabling the cache clears it
+  EXPECT_TRUE(cache.beginContactTest(request));
+  EXPECT_FALSE(cache.reuseContactResults("link_a", tf_a, "link_b", tf_b, results));
+  cache.endContactTest(results);
+  EXPECT_EQ(cache.size(), 1U);
+  cache.setEnabled(false);
+  EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST(TesseractCoreUnit, checkNarrowphasePairsUnit)  // NOLINT
+{
+  using tesseract::collision::ContactRequest;
+  using tesseract::collision::ContactResult;
+  using tesseract::collision::ContactResultMap;
+  using tesseract::collision::ContactTestData;
+  using tesseract::collision::ContactTestType;
+
+  const std::size_t pair_count{ 20 };
+  tesseract::common::TaskPool executor(3);
+  EXPECT_EQ(tesseract::collision::getNarrowphaseBlockCount(executor, 0), 1U);
+  EXPECT_EQ(tesseract::collision::getNarrowphaseBlockCount(executor, 2), 2U);
+  EXPECT_EQ(tesseract::collision::getNarrowphaseBlockCount(executor, pair_count), 4U);
+
+  // Every pair reports a contact, the link pair is shared when unique_keys is false
+  bool unique_keys{ true };
+  auto check_pair = [&unique_keys](std::size_t /*block*/, ContactTestData& block_cdata, std::size_t pair_index) {
+    ContactResult contact;
+    contact.link_names = { "base_link", unique_keys ? "link_" + std::to_string(pair_index) : "link" };
+    contact.distance = 0.5 - (0.01 * static_cast<double>(pair_index));
+    const auto key = tesseract::common::makeOrderedLinkPair(contact.link_names[0], contact.link_names[1]);
+    const auto it = block_cdata.res->find(key);
+    tesseract::collision::processResult(
+        block_cdata, contact, key, it != block_cdata.res->end() && !it->second.empty());
+  };
+
+  std::vector<std::unique_ptr<tesseract::collision::NarrowphaseBlockData>> blocks;
+  {
+    ContactResultMap results;
+    ContactTestData cdata(
+        tesseract::collision::CollisionMarginData(1.0), nullptr, ContactRequest(ContactTestType::ALL), results);
+    tesseract::collision::checkNarrowphasePairs(executor, cdata, pair_count, blocks, check_pair);
+    EXPECT_EQ(blocks.size(), 4U);
+    EXPECT_EQ(results.size(), pair_count);
+    EXPECT_EQ(results.count(), static_cast<long>(pair_count));
+    EXPECT_EQ(cdata.res, &results);
+    EXPECT_FALSE(cdata.done);
+  }
+
+  unique_keys = false;
+  {
+    ContactResultMap results;
+    ContactTestData cdata(
+        tesseract::collision::CollisionMarginData(1.0), nullptr, ContactRequest(ContactTestType::CLOSEST), results);
+    tesseract::collision::checkNarrowphasePairs(executor, cdata, pair_count, blocks, check_pair);
+    ASSERT_EQ(results.count(), 1);
+    EXPECT_NEAR(results.begin()->second.front().distance, 0.5 - (0.01 * static_cast<double>(pair_count - 1)), 1e-8);
+  }
+
+  {
+    ContactResultMap results;
+    ContactTestData cdata(
+        tesseract::collision::CollisionMarginData(1.0), nullptr, ContactRequest(ContactTestType::FIRST), results);
+    tesseract::collision::checkNarrowphasePairs(executor, cdata, pair_count, blocks, check_pair);
+    EXPECT_EQ(results.count(), 1);
+    EXPECT_TRUE(cdata.done);
+  }
+
+  // Nothing is checked once the contact test is done
+  {
+    ContactResultMap results;
+    ContactTestData cdata(tesseract::collision::CollisionMarginData(1.0), nullptr, ContactRequest(), results);
+    cdata.done = true;
+    tesseract::collision::checkNarrowphasePairs(executor, cdata, pair_count, blocks, check_pair);
+    EXPECT_TRUE(results.empty());
+  }
+}
+
+TEST(TesseractCoreUnit, BoundingSpheresUnit)  // NOLINT
+{
+  using namespace tesseract::collision;
+
+  EXPECT_NEAR(computeBoundingSphere(tesseract::geometry::Sphere(0.25)).radius, 0.25, 1e-8);
+  EXPECT_NEAR(computeBoundingSphere(tesseract::geometry::Box(1, 2, 2)).radius, 1.5, 1e-8);
+  EXPECT_NEAR(computeBoundingSphere(tesseract::geometry::Cylinder(0.3, 0.8)).radius, 0.5, 1e-8);
+  EXPECT_NEAR(computeBoundingSphere(tesseract::geometry::Cone(0.3, 0.8)).radius, 0.5, 1e-8);
+  EXPECT_NEAR(computeBoundingSphere(tesseract::geometry::Capsule(0.25, 1)).radius, 0.75, 1e-8);
+  EXPECT_TRUE(std::isinf(computeBoundingSphere(tesseract::geometry::Plane(1, 0, 0, 0)).radius));
+
+  {  // Mesh
+    auto vertices = std::make_shared<tesseract::common::VectorVector3d>();
+    vertices->emplace_back(1, 1, 0);
+    vertices->emplace_back(3, 1, 0);
+    vertices->emplace_back(3, 1, 2);
+    auto faces = std::make_shared<Eigen::VectorXi>(4);
+    (*faces) << 3, 0, 1, 2;
+    tesseract::geometry::Mesh mesh(vertices, faces);
+    BoundingSphere sphere = computeBoundingSphere(mesh);
+    EXPECT_TRUE(sphere.center.isApprox(Eigen::Vector3d(2, 1, 1), 1e-8));
+    EXPECT_NEAR(sphere.radius, std::sqrt(2.0), 1e-8);
+  }
+
+  CollisionShapesConst shapes{ std::make_shared<tesseract::geometry::Sphere>(0.1),
+                               std::make_shared<tesseract::geometry::Sphere>(0.2) };
+  tesseract::common::VectorIsometry3d shape_poses{ Eigen::Isometry3d::Identity(), Eigen::Isometry3d::Identity() };
+  shape_poses[1].translation() = Eigen::Vector3d(0, 0, 1);
+  BoundingSpheres spheres = computeBoundingSpheres(shapes, shape_poses);
+  ASSERT_EQ(spheres.size(), 2U);
+  EXPECT_TRUE(spheres[1].center.isApprox(Eigen::Vector3d(0, 0, 1), 1e-8));
+
+  Eigen::Isometry3d tf1 = Eigen::Isometry3d::Identity();
+  Eigen::Isometry3d tf2 = Eigen::Isometry3d::Identity();
+  tf2.translation() = Eigen::Vector3d(1, 0, 1);
+  EXPECT_NEAR(computeBoundingSpheresDistance(spheres, tf1, spheres, tf2), 0.7, 1e-8);
+  EXPECT_TRUE(isBoundingSpheresWithinMargin(spheres, tf1, spheres, tf2, 0.71));
+  EXPECT_FALSE(isBoundingSpheresWithinMargin(spheres, tf1, spheres, tf2, 0.6));
+  EXPECT_TRUE(std::isinf(computeBoundingSpheresDistance({}, tf1, spheres, tf2)));
+}
+
+TEST(TesseractCoreUnit, ContactManagerStatisticsUnit)  // NOLINT
+{
+  using namespace tesseract::collision;
+  using tesseract::geometry::GeometryType;
+
+  ContactManagerStatistics stats;
+  EXPECT_EQ(stats, ContactManagerStatistics());
+  EXPECT_EQ(stats.getNarrowphaseShapePairs(GeometryType::BOX, GeometryType::SPHERE), 0U);
+
+  stats.addNarrowphaseShapePair(GeometryType::BOX, GeometryType::SPHERE);
+  EXPECT_EQ(stats.getNarrowphaseShapePairs(GeometryType::BOX, GeometryType::SPHERE), 1U);
+  EXPECT_EQ(stats.getNarrowphaseShapePairs(GeometryType::SPHERE, GeometryType::BOX), 1U);
+
+  stats.addNarrowphaseShapePair(GeometryType::BOX, GeometryType::BOX);
+  EXPECT_EQ(stats.getNarrowphaseShapePairs(GeometryType::BOX, GeometryType::BOX), 1U);
+
+  CollisionShapesConst shapes1{ std::make_shared<tesseract::geometry::Box>(1, 1, 1),
+                                std::make_shared<tesseract::geometry::Sphere>(0.1) };
+  CollisionShapesConst shapes2{ std::make_shared<tesseract::geometry::Sphere>(0.1) };
+  stats.addNarrowphaseShapePairs(shapes1, shapes2);
+  EXPECT_EQ(stats.getNarrowphaseShapePairs(GeometryType::BOX, GeometryType::SPHERE), 2U);
+  EXPECT_EQ(stats.getNarrowphaseShapePairs(GeometryType::SPHERE, GeometryType::SPHERE), 1U);
+
+  stats.contact_tests = 2;
+  stats.broadphase_pairs = 10;
+  stats.filtered_pairs = 4;
+  stats.narrowphase_pairs = 6;
+  stats.contacts = 3;
+  stats.total_time = 0.5;
+  stats.narrowphase_time = 0.2;
+  EXPECT_NEAR(stats.getBroadphaseTime(), 0.3, 1e-8);
+  EXPECT_FALSE(stats.toString().empty());
+
+  ContactManagerStatistics total;
+  total += stats;
+  total += stats;
+  EXPECT_NE(total, stats);
+  EXPECT_EQ(total.contact_tests, 4U);
+  EXPECT_EQ(total.broadphase_pairs, 20U);
+  EXPECT_EQ(total.contacts, 6U);
+  EXPECT_NEAR(total.total_time, 1.0, 1e-8);
+  EXPECT_EQ(total.getNarrowphaseShapePairs(GeometryType::SPHERE, GeometryType::BOX), 4U);
+
+  total.reset();
+  EXPECT_EQ(total, ContactManagerStatistics());
+
+#ifdef TESSERACT_CONTACT_STATISTICS_ENABLED
+  EXPECT_TRUE(ContactManagerStatistics::isEnabled());
+#else
+  EXPECT_FALSE(ContactManagerStatistics::isEnabled());
+#endif
+}
+
 TEST(TesseractCoreUnit, scaleVerticesUnit)  // NOLINT
 {
   tesseract::common::VectorVector3d base_vertices{};
@@ -350,6 +730,57 @@ TEST(TesseractCoreUnit, scaleVerticesUnit)  // NOLINT
   EXPECT_TRUE(test_vertices[7].isApprox(Eigen::Vector3d(10, 10, 0)));
 }
 
+TEST(TesseractCoreUnit, processResultGlobalMinimumUnit)  // NOLINT
+{
+  using namespace tesseract::collision;
+
+  ContactResultMap results;
+  ContactTestData cdata(CollisionMarginData(0.5), nullptr, ContactRequest(ContactTestType::GLOBAL_MINIMUM), results);
+  EXPECT_NEAR(cdata.getEffectiveCollisionMargin(0.5), 0.5, 1e-8);
+
+  auto process = [&cdata](const std::string& link_name1, const std::string& link_name2, double distance) {
+    ContactResult contact;
+    contact.link_names[0] = link_name1;
+    contact.link_names[1] = link_name2;
+    contact.distance = distance;
+    const auto key = tesseract::common::makeOrderedLinkPair(link_name1, link_name2);
+    const auto it = cdata.res->find(key);
+    return processResult(cdata, contact, key, (it != cdata.res->end() && !it->second.empty()));
+  };
+
+  EXPECT_TRUE(process("link_1", "link_2", 0.3) != nullptr);
+  EXPECT_EQ(results.count(), 1);
+  EXPECT_NEAR(cdata.global_minimum_distance, 0.3, 1e-8);
+  EXPECT_NEAR(cdata.getEffectiveCollisionMargin(0.5), 0.3, 1e-8);
+
+  // Contacts which are not closer are rejected
+  EXPECT_TRUE(process("link_1", "link_3", 0.4) == nullptr);
+  EXPECT_TRUE(process("link_1", "link_3", 0.3) == nullptr);
+  EXPECT_EQ(results.count(), 1);
+
+  // A closer contact of another pair replaces the previous one
+  EXPECT_TRUE(process("link_1", "link_3", 0.1) != nullptr);
+  EXPECT_EQ(results.count(), 1);
+  EXPECT_EQ(results.size(), 1);
+  EXPECT_TRUE(results.at(tesseract::common::makeOrderedLinkPair("link_1", "link_2")).empty());
+  EXPECT_NEAR(results.at(tesseract::common::makeOrderedLinkPair("link_1", "link_3")).front().distance, 0.1, 1e-8);
+
+  // A closer contact of the same pair replaces the previous one
+  EXPECT_TRUE(process("link_1", "link_3", -0.1) != nullptr);
+  EXPECT_EQ(results.count(), 1);
+  EXPECT_NEAR(results.at(tesseract::common::makeOrderedLinkPair("link_1", "link_3")).front().distance, -0.1, 1e-8);
+
+  // Contacts outside the collision margin are rejected
+  cdata.global_minimum_distance = std::numeric_limits<double>::max();
+  EXPECT_TRUE(process("link_2", "link_3", 0.6) == nullptr);
+
+  // Clear the results of a single key
+  results.clearContactResult(tesseract::common::makeOrderedLinkPair("link_1", "link_3"));
+  results.clearContactResult(tesseract::common::makeOrderedLinkPair("link_4", "link_5"));
+  EXPECT_EQ(results.count(), 0);
+  EXPECT_TRUE(results.empty());
+}
+
 TEST(TesseractCoreUnit, ContactResultsUnit)  // NOLINT
 {
   tesseract::collision::ContactResult results;
@@ -46,6 +46,12 @@ TEST(TesseractCollisionLargeDataSetUnit, FCLDiscreteBVHCollisionLargeDataSetUnit
   test_suite::runTest(checker);
 }
 
+TEST(TesseractCollisionLargeDataSetUnit, FCLDiscreteBVHLinkCollisionLargeDataSetUnit)  // NOLINT
+{
+  FCLDiscreteBVHManager checker("FCLDiscreteBVHManager", FCLBroadphaseMode::LINK);
+  test_suite::runTest(checker);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
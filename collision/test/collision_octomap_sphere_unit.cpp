@@ -1,11 +1,16 @@
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/collision/test_suite/collision_octomap_sphere_unit.hpp>
 #include <tesseract/collision/bullet/bullet_discrete_simple_manager.h>
 #include <tesseract/collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract/collision/bullet/tesseract_octree_shape.h>
 #include <tesseract/collision/fcl/fcl_discrete_managers.h>
 
 using namespace tesseract::collision;
@@ -46,6 +51,191 @@ TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionOctomapSphereConvexHullUnit)
   test_suite::runTest(checker, 0.16, true);  // TODO: There appears to be an issue in fcl for octomap::OcTree.
 }
 
+TEST(TesseractCollisionUnit, BulletOctreeShapeUnit)  // NOLINT
+{
+  tesseract::common::GeneralResourceLocator locator;
+  std::string path = locator.locateResource("package://tesseract/support/meshes/blender_monkey.bt")->getFilePath();
+  auto ot = std::make_shared<octomap::OcTree>(path);
+  bullet_internal::TesseractOctreeShape shape(ot, tesseract::geometry::OctreeSubType::BOX);
+
+  std::size_t occupied_count{ 0 };
+  for (auto it = ot->begin_leafs(), end = ot->end_leafs(); it != end; ++it)
+  {
+    if (it->getOccupancy() >= ot->getOccupancyThres())
+      ++occupied_count;
+  }
+  EXPECT_GT(occupied_count, 0U);
+
+  struct CountLeafCallback : public bullet_internal::TesseractOctreeLeafCallback
+  {
+    std::size_t count{ 0 };
+    std::size_t max_count{ std::numeric_limits<std::size_t>::max() };
+
+    bool processLeaf(btConvexShape* /*shape*/, const btTransform& /*local_tf*/) override { return ++count < max_count; }
+  };
+
+  // Every occupied leaf is within the bounds of the shape
+  btVector3 aabb_min, aabb_max;
+  shape.getAabb(btTransform::getIdentity(), aabb_min, aabb_max);
+  CountLeafCallback all_callback;
+  shape.processOccupiedLeaves(aabb_min, aabb_max, all_callback);
+  EXPECT_EQ(all_callback.count, occupied_count);
+
+  // Only the leaves overlapping smaller bounds are processed
+  CountLeafCallback corner_callback;
+  shape.processOccupiedLeaves(aabb_min, aabb_min + btVector3(0.1, 0.1, 0.1), corner_callback);
+  EXPECT_LT(corner_callback.count, occupied_count);
+
+  // The traversal stops when requested by the callback
+  CountLeafCallback stop_callback;
+  stop_callback.max_count = 1;
+  shape.processOccupiedLeaves(aabb_min, aabb_max, stop_callback);
+  EXPECT_EQ(stop_callback.count, 1U);
+
+  // The bounds of a cast shape include the end of the cast
+  bullet_internal::TesseractOctreeShape::Ptr cast_shape = shape.createCastShape();
+  EXPECT_FALSE(shape.isCast());
+  EXPECT_TRUE(cast_shape->isCast());
+  cast_shape->updateCastTransform(btTransform(btMatrix3x3::getIdentity(), btVector3(1, 0, 0)));
+  btVector3 cast_aabb_min, cast_aabb_max;
+  cast_shape->getAabb(btTransform::getIdentity(), cast_aabb_min, cast_aabb_max);
+  EXPECT_NEAR(cast_aabb_min.x(), aabb_min.x(), 1e-6);
+  EXPECT_NEAR(cast_aabb_max.x(), aabb_max.x() + 1, 1e-6);
+
+  // The leaves are swept by the cast transform
+  const btVector3 end_aabb_min(aabb_max.x() + 0.5, aabb_min.y(), aabb_min.z());
+  CountLeafCallback start_callback;
+  shape.processOccupiedLeaves(end_aabb_min, cast_aabb_max, start_callback);
+  EXPECT_EQ(start_callback.count, 0U);
+
+  CountLeafCallback cast_callback;
+  cast_shape->processOccupiedLeaves(end_aabb_min, cast_aabb_max, cast_callback);
+  EXPECT_GT(cast_callback.count, 0U);
+
+  CountLeafCallback cast_all_callback;
+  cast_shape->processOccupiedLeaves(aabb_min + btVector3(1, 0, 0), cast_aabb_max, cast_all_callback);
+  EXPECT_EQ(cast_all_callback.count, occupied_count);
+}
+
+namespace
+{
+/** @brief Stores the bounds of the processed leaves */
+struct AabbLeafCallback : public bullet_internal::TesseractOctreeLeafCallback
+{
+  std::vector<std::pair<btVector3, btVector3>> aabbs;
+
+  bool processLeaf(btConvexShape* shape, const btTransform& local_tf) override
+  {
+    btVector3 aabb_min, aabb_max;
+    shape->getAabb(local_tf, aabb_min, aabb_max);
+    aabbs.emplace_back(aabb_min, aabb_max);
+    return true;
+  }
+};
+}  // namespace
+
+TEST(TesseractCollisionUnit, BulletOctreeShapeLazyEvalUnit)  // NOLINT
+{
+  // The inner nodes are not updated when the occupied leaf is added, so they are still free
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  ot->updateNode(octomap::point3d(0.15F, 0.05F, 0.05F), false);
+  ot->updateNode(octomap::point3d(0.05F, 0.05F, 0.05F), true, true);
+  ASSERT_LT(ot->getRoot()->getOccupancy(), ot->getOccupancyThres());
+
+  const btVector3 aabb_min(-1, -1, -1);
+  const btVector3 aabb_max(1, 1, 1);
+  for (const auto& sub_type : { tesseract::geometry::OctreeSubType::BOX,
+                                tesseract::geometry::OctreeSubType::SPHERE_INSIDE,
+                                tesseract::geometry::OctreeSubType::SPHERE_OUTSIDE })
+  {
+    bullet_internal::TesseractOctreeShape shape(ot, sub_type);
+    AabbLeafCallback callback;
+    shape.processOccupiedLeaves(aabb_min, aabb_max, callback);
+    EXPECT_EQ(callback.aabbs.size(), 1U);
+  }
+}
+
+TEST(TesseractCollisionUnit, BulletOctreeShapeSphereOutsideBoundsUnit)  // NOLINT
+{
+  // The leaf is in the corner of all of its ancestors except the root
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  const octomap::point3d leaf_coord(0.05F, 0.05F, 0.05F);
+  ot->updateNode(leaf_coord, true);
+  bullet_internal::TesseractOctreeShape shape(ot, tesseract::geometry::OctreeSubType::SPHERE_OUTSIDE);
+
+  AabbLeafCallback all_callback;
+  shape.processOccupiedLeaves(btVector3(-1, -1, -1), btVector3(1, 1, 1), all_callback);
+  ASSERT_EQ(all_callback.aabbs.size(), 1U);
+  const btVector3& leaf_min = all_callback.aabbs.front().first;
+  const btVector3& leaf_max = all_callback.aabbs.front().second;
+  EXPECT_NEAR(leaf_min.x(), 0.05 - (std::sqrt(2.0) * 0.05), 1e-6);
+
+  // The sqrt(2) * h half extent of every ancestor node contains the sphere of the leaf
+  const octomap::OcTreeKey leaf_key = ot->coordToKey(leaf_coord);
+  const unsigned tree_depth = ot->getTreeDepth();
+  for (unsigned depth = 0; depth <= tree_depth; ++depth)
+  {
+    const auto level = static_cast<octomap::key_type>(tree_depth - depth);
+    const octomap::OcTreeKey node_key = octomap::computeIndexKey(level, leaf_key);
+    const octomap::point3d node_coord = ot->keyToCoord(node_key, depth);
+    const btVector3 center(node_coord.x(), node_coord.y(), node_coord.z());
+    const auto extent = static_cast<btScalar>(std::sqrt(2.0) * ot->getNodeSize(depth) / 2.0);
+    for (int i = 0; i < 3; ++i)
+    {
+      EXPECT_LE(center[i] - extent, leaf_min[i] + 1e-6);
+      EXPECT_GE(center[i] + extent, leaf_max[i] - 1e-6);
+    }
+  }
+
+  // Bounds which only overlap the part of the sphere outside of the leaf box still find the leaf
+  AabbLeafCallback outside_callback;
+  shape.processOccupiedLeaves(btVector3(-0.02F, 0.04F, 0.04F), btVector3(-0.01F, 0.06F, 0.06F), outside_callback);
+  EXPECT_EQ(outside_callback.aabbs.size(), 1U);
+}
+
+TEST(TesseractCollisionUnit, BulletOctreeShapeFreeSubtreeUnit)  // NOLINT
+{
+  // One octant of the root only has free leaves, the other has an occupied leaf
+  auto ot = std::make_shared<octomap::OcTree>(0.1);
+  for (float x = 0.05F; x < 1.0F; x += 0.1F)
+    ot->updateNode(octomap::point3d(x, 0.05F, 0.05F), false);
+  ot->updateNode(octomap::point3d(-0.05F, 0.05F, 0.05F), true);
+
+  bullet_internal::TesseractOctreeShape shape(ot, tesseract::geometry::OctreeSubType::BOX);
+  const octomap::OcTreeNode* root = ot->getRoot();
+  ASSERT_NE(root, nullptr);
+  EXPECT_TRUE(shape.isSubtreeOccupied(root));
+
+  std::size_t free_children{ 0 };
+  std::size_t occupied_children{ 0 };
+  for (unsigned i = 0; i < 8; ++i)
+  {
+    if (!ot->nodeChildExists(root, i))
+      continue;
+
+    if (shape.isSubtreeOccupied(ot->getNodeChild(root, i)))
+      ++occupied_children;
+    else
+      ++free_children;
+  }
+  EXPECT_EQ(free_children, 1U);
+  EXPECT_EQ(occupied_children, 1U);
+
+  // Bounds which only overlap the free leaves find nothing, bounds which overlap both find the occupied leaf
+  AabbLeafCallback free_callback;
+  shape.processOccupiedLeaves(btVector3(0.01F, 0, 0), btVector3(1, 0.1F, 0.1F), free_callback);
+  EXPECT_TRUE(free_callback.aabbs.empty());
+
+  AabbLeafCallback all_callback;
+  shape.processOccupiedLeaves(btVector3(-1, -1, -1), btVector3(1, 1, 1), all_callback);
+  ASSERT_EQ(all_callback.aabbs.size(), 1U);
+  EXPECT_NEAR(all_callback.aabbs.front().first.x(), -0.1, 1e-6);
+
+  // A cast copy shares the occupied subtrees
+  auto cast_shape = shape.createCastShape();
+  EXPECT_TRUE(cast_shape->isSubtreeOccupied(root));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
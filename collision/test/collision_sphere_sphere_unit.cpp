@@ -1,6 +1,7 @@
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <algorithm>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/collision/test_suite/collision_sphere_sphere_unit.hpp>
@@ -34,12 +35,67 @@ TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionSphereSphereConvexHullUni
   test_suite::runTest(checker, true);
 }
 
+TEST(TesseractCollisionUnit, BulletDiscreteBVHCollisionSphereSphereIndexTransformUnit)  // NOLINT
+{
+  BulletDiscreteBVHManager checker;
+  test_suite::detail::addCollisionObjects(checker, false);
+  checker.setActiveCollisionObjects({ "sphere_link", "sphere1_link" });
+  checker.setCollisionMarginData(CollisionMarginData(0.1));
+
+  const std::vector<std::string>& names = checker.getCollisionObjects();
+  const auto sphere_idx =
+      static_cast<std::size_t>(std::distance(names.begin(), std::find(names.begin(), names.end(), "sphere_link")));
+  const auto sphere1_idx =
+      static_cast<std::size_t>(std::distance(names.begin(), std::find(names.begin(), names.end(), "sphere1_link")));
+  ASSERT_LT(sphere_idx, names.size());
+  ASSERT_LT(sphere1_idx, names.size());
+
+  // Objects in collision
+  Eigen::Isometry3d sphere1_pose = Eigen::Isometry3d::Identity();
+  sphere1_pose.translation()(0) = 0.2;
+  checker.setCollisionObjectsTransform(std::vector<std::size_t>{ sphere_idx, sphere1_idx },
+                                       { Eigen::Isometry3d::Identity(), sphere1_pose });
+
+  ContactResultMap result;
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  ContactResultVector result_vector;
+  result.flattenMoveResults(result_vector);
+  ASSERT_FALSE(result_vector.empty());
+  EXPECT_NEAR(result_vector[0].distance, -0.30, 0.0001);
+
+  // Move only one object, the unchanged object is skipped
+  sphere1_pose.translation()(0) = 1;
+  checker.setCollisionObjectsTransform(std::vector<std::size_t>{ sphere_idx, sphere1_idx },
+                                       { Eigen::Isometry3d::Identity(), sphere1_pose });
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  result.flattenMoveResults(result_vector);
+  EXPECT_TRUE(result_vector.empty());
+
+  // Move back within the margin
+  sphere1_pose.translation()(0) = 0.55;
+  checker.setCollisionObjectsTransform(std::vector<std::size_t>{ sphere1_idx }, { sphere1_pose });
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  result.flattenMoveResults(result_vector);
+  ASSERT_FALSE(result_vector.empty());
+  EXPECT_NEAR(result_vector[0].distance, 0.05, 0.0001);
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionSphereSphereUnit)  // NOLINT
 {
   FCLDiscreteBVHManager checker;
   test_suite::runTest(checker, false);
 }
 
+TEST(TesseractCollisionUnit, FCLDiscreteBVHLinkCollisionSphereSphereUnit)  // NOLINT
+{
+  FCLDiscreteBVHManager checker("FCLDiscreteBVHManager", FCLBroadphaseMode::LINK);
+  test_suite::runTest(checker, false);
+}
+
 TEST(TesseractCollisionUnit, FCLDiscreteBVHCollisionSphereSphereConvexHullUnit)  // NOLINT
 {
   FCLDiscreteBVHManager checker;
@@ -4,6 +4,7 @@
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <console_bridge/console.h>
+#include <algorithm>
 #include <chrono>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -102,6 +103,34 @@ inline void runTest(DiscreteContactManager& checker, bool use_convex_mesh = fals
   auto end_time = std::chrono::high_resolution_clock::now();
 
   CONSOLE_BRIDGE_logInform("DT: %f ms", std::chrono::duration<double, std::milli>(end_time - start_time).count());
+
+  // Move the first sphere closer to its neighbor so the global minimum is unique
+  location[link_names.front()].translation().x() += 0.02;
+  checker.setCollisionObjectsTransform(location);
+
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  result.flattenMoveResults(result_vector);
+  ASSERT_FALSE(result_vector.empty());
+  auto closest =
+      std::min_element(result_vector.begin(), result_vector.end(), [](const ContactResult& a, const ContactResult& b) {
+        return a.distance < b.distance;
+      });
+
+  // The result must not depend on previous contact tests
+  for (int i = 0; i < 2; ++i)
+  {
+    ContactResultMap global_minimum_result;
+    ContactResultVector global_minimum_vector;
+    checker.contactTest(global_minimum_result, ContactRequest(ContactTestType::GLOBAL_MINIMUM));
+    global_minimum_result.flattenMoveResults(global_minimum_vector);
+    ASSERT_EQ(global_minimum_vector.size(), 1);
+    EXPECT_NEAR(global_minimum_vector.front().distance, closest->distance, 1e-6);
+    EXPECT_EQ(tesseract::common::makeOrderedLinkPair(global_minimum_vector.front().link_names[0],
+                                                     global_minimum_vector.front().link_names[1]),
+              tesseract::common::makeOrderedLinkPair(closest->link_names[0], closest->link_names[1]));
+  }
 }
 }  // namespace tesseract::collision::test_suite
 #endif  // TESSERACT_COLLISION_COLLISION_LARGE_DATASET_UNIT_HPP
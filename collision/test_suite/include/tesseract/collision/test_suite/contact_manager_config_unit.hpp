@@ -5,6 +5,7 @@
 #include <tesseract/collision/continuous_contact_manager.h>
 #include <tesseract/collision/common.h>
 #include <tesseract/geometry/geometries.h>
+#include <tesseract/common/task_pool.h>
 
 namespace tesseract::collision::test_suite
 {
@@ -219,6 +220,195 @@ inline void runTest(DiscreteContactManager& checker)
   EXPECT_NEAR(result_vector[0].normal[0], idx[2] * 1.0, 0.001);
   EXPECT_NEAR(result_vector[0].normal[1], idx[2] * 0.0, 0.001);
   EXPECT_NEAR(result_vector[0].normal[2], idx[2] * 0.0, 0.001);
+
+  /////////////////////////////////////////////////////////////
+  // Test the bounding sphere approximation gives same result
+  /////////////////////////////////////////////////////////////
+  EXPECT_EQ(checker.getContactApproximationType(), ContactApproximationType::NONE);
+  config.approximation_type = ContactApproximationType::BOUNDING_SPHERES;
+  checker.applyContactManagerConfig(config);
+  EXPECT_EQ(checker.getContactApproximationType(), ContactApproximationType::BOUNDING_SPHERES);
+
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  result.flattenMoveResults(result_vector);
+
+  EXPECT_TRUE(!result_vector.empty());
+  EXPECT_NEAR(result_vector[0].distance, 0.5, 0.0001);
+
+  DiscreteContactManager::UPtr cloned_checker = checker.clone();
+  EXPECT_EQ(cloned_checker->getContactApproximationType(), ContactApproximationType::BOUNDING_SPHERES);
+
+  config.default_margin = 0.48;
+  checker.applyContactManagerConfig(config);
+  result.clear();
+  result_vector.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  result.flattenMoveResults(result_vector);
+
+  EXPECT_TRUE(result_vector.empty());
+
+  ///////////////////////////////////////////////////////
+  // Test the statistics when they are compiled in
+  ///////////////////////////////////////////////////////
+  if (ContactManagerStatistics::isEnabled())
+  {
+    const ContactManagerStatistics& stats = checker.getStatistics();
+    EXPECT_EQ(stats.contact_tests, 5U);
+    EXPECT_GE(stats.broadphase_pairs, stats.narrowphase_pairs);
+    EXPECT_GT(stats.narrowphase_pairs, 0U);
+    EXPECT_GT(stats.contacts, 0U);
+    EXPECT_GE(stats.total_time, stats.narrowphase_time);
+    EXPECT_GT(stats.getNarrowphaseShapePairs(tesseract::geometry::GeometryType::SPHERE,
+                                             tesseract::geometry::GeometryType::SPHERE),
+              0U);
+  }
+
+  checker.resetStatistics();
+  EXPECT_EQ(checker.getStatistics(), ContactManagerStatistics());
+
+  /////////////////////////////////////////////////////////////
+  // Test the contact result cache gives same result
+  /////////////////////////////////////////////////////////////
+  EXPECT_FALSE(checker.isContactResultCacheEnabled());
+  config = ContactManagerConfig(0.52);
+  config.contact_result_cache_enabled = true;
+  checker.applyContactManagerConfig(config);
+  EXPECT_TRUE(checker.isContactResultCacheEnabled());
+  EXPECT_TRUE(checker.clone()->isContactResultCacheEnabled());
+
+  // The second contact test moves both objects by the same transform so the results of the first are reused
+  for (double offset : { 0.0, 0.5 })
+  {
+    location["sphere_link"].translation() = Eigen::Vector3d(0, offset, 0);
+    location["sphere1_link"].translation() = Eigen::Vector3d(1, offset, 0);
+    checker.setCollisionObjectsTransform(location);
+
+    result.clear();
+    result_vector.clear();
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    result.flattenMoveResults(result_vector);
+
+    ASSERT_EQ(result_vector.size(), 1U);
+    EXPECT_NEAR(result_vector[0].distance, 0.5, 0.0001);
+
+    idx = { 0, 1, 1 };
+    if (result_vector[0].link_names[0] != "sphere_link")
+      idx = { 1, 0, -1 };
+
+    EXPECT_NEAR(result_vector[0].nearest_points[static_cast<size_t>(idx[0])][0], 0.25, 0.001);
+    EXPECT_NEAR(result_vector[0].nearest_points[static_cast<size_t>(idx[0])][1], offset, 0.001);
+    EXPECT_NEAR(result_vector[0].nearest_points[static_cast<size_t>(idx[1])][0], 0.75, 0.001);
+    EXPECT_NEAR(result_vector[0].nearest_points[static_cast<size_t>(idx[1])][1], offset, 0.001);
+    EXPECT_NEAR(result_vector[0].normal[0], idx[2] * 1.0, 0.001);
+  }
+
+  if (ContactManagerStatistics::isEnabled())
+  {
+    EXPECT_EQ(checker.getStatistics().contact_tests, 2U);
+    EXPECT_EQ(checker.getStatistics().narrowphase_pairs, 1U);
+  }
+
+  // Changing the margin clears the cache
+  checker.setDefaultCollisionMargin(0.48);
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+  EXPECT_TRUE(result.empty());
+
+  // A result map which is not cleared between contact tests does not store or reuse the results of earlier tests
+  checker.setDefaultCollisionMargin(0.52);
+  checker.setContactResultCacheEnabled(false);
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_EQ(result.count(), 1);
+  checker.setContactResultCacheEnabled(true);
+  for (long count : { 2, 3, 4 })
+  {
+    checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+    EXPECT_EQ(result.count(), count);
+  }
+
+  result_vector.clear();
+  result.flattenMoveResults(result_vector);
+  for (const auto& contact : result_vector)
+    EXPECT_NEAR(contact.distance, 0.5, 0.0001);
+
+  checker.setContactResultCacheEnabled(false);
+  EXPECT_FALSE(checker.isContactResultCacheEnabled());
+
+  /////////////////////////////////////////////////////////////
+  // Test the parallel narrowphase gives same result
+  /////////////////////////////////////////////////////////////
+  EXPECT_EQ(checker.getNarrowphaseExecutor(), nullptr);
+  auto executor = std::make_shared<tesseract::common::TaskPool>(2);
+  checker.setNarrowphaseExecutor(executor);
+  EXPECT_EQ(checker.getNarrowphaseExecutor(), executor);
+  EXPECT_EQ(checker.clone()->getNarrowphaseExecutor(), executor);
+
+  checker.setDefaultCollisionMargin(0.52);
+  for (auto type : { ContactTestType::FIRST, ContactTestType::CLOSEST, ContactTestType::ALL })
+  {
+    result.clear();
+    result_vector.clear();
+    checker.contactTest(result, ContactRequest(type));
+    result.flattenMoveResults(result_vector);
+
+    ASSERT_EQ(result_vector.size(), 1U);
+    EXPECT_NEAR(result_vector[0].distance, 0.5, 0.0001);
+  }
+
+  checker.setDefaultCollisionMargin(0.48);
+  result.clear();
+  checker.contactTest(result, ContactRequest(ContactTestType::ALL));
+  EXPECT_TRUE(result.empty());
+
+  config = ContactManagerConfig();
+  config.parallel_narrowphase = false;
+  checker.applyContactManagerConfig(config);
+  EXPECT_EQ(checker.getNarrowphaseExecutor(), nullptr);
+
+  config.parallel_narrowphase = true;
+  checker.applyContactManagerConfig(config);
+  EXPECT_EQ(checker.getNarrowphaseExecutor().get(), &tesseract::common::getGlobalTaskExecutor());
+  checker.setNarrowphaseExecutor(nullptr);
+
+  /////////////////////////////////////////////////////////////
+  // Test setting the transforms by index
+  /////////////////////////////////////////////////////////////
+  checker.setDefaultCollisionMargin(0.52);
+  for (double x : { 1.0, 1.1 })
+  {
+    std::vector<std::size_t> indices;
+    tesseract::common::VectorIsometry3d poses;
+    const std::vector<std::string>& names = checker.getCollisionObjects();
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+      if (names[i] != "sphere_link" && names[i] != "sphere1_link")
+        continue;
+
+      indices.push_back(i);
+      poses.emplace_back(Eigen::Isometry3d::Identity());
+      if (names[i] == "sphere1_link")
+        poses.back().translation() = Eigen::Vector3d(x, 0, 0);
+    }
+    checker.setCollisionObjectsTransform(indices, poses);
+
+    result.clear();
+    result_vector.clear();
+    checker.contactTest(result, ContactRequest(ContactTestType::CLOSEST));
+    result.flattenMoveResults(result_vector);
+
+    if (x < 1.05)
+    {
+      ASSERT_EQ(result_vector.size(), 1U);
+      EXPECT_NEAR(result_vector[0].distance, 0.5, 0.0001);
+    }
+    else
+    {
+      EXPECT_TRUE(result_vector.empty());
+    }
+  }
 }
 
 inline void runTest(ContinuousContactManager& checker)
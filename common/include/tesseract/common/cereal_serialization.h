@@ -146,10 +146,37 @@ template <class Archive>
 void serialize(Archive& ar, BytesResource& obj)
 {
   ar(cereal::make_nvp("url", obj.url_));
-  ar(cereal::make_nvp("bytes", obj.bytes_));
+  // The bytes may be shared with resource buffers, so a new vector is loaded into
+  if constexpr (Archive::is_loading::value)
+    obj.bytes_ = std::make_shared<std::vector<uint8_t>>();
+  ar(cereal::make_nvp("bytes", *obj.bytes_));
   ar(cereal::make_nvp("parent", obj.parent_));
 }
 
+template <class Archive>
+void serialize(Archive& ar, BundleResourceLocator& obj)
+{
+  // The bundle is opened again when loading
+  ar(cereal::make_nvp("bundle_path", obj.bundle_path_));
+  if constexpr (Archive::is_loading::value)
+  {
+    if (!obj.bundle_path_.empty())
+      obj.load();
+  }
+}
+
+template <class Archive>
+void serialize(Archive& ar, BundleResource& obj)
+{
+  ar(cereal::make_nvp("url", obj.url_));
+  ar(cereal::make_nvp("parent", obj.parent_));
+  if constexpr (Archive::is_loading::value)
+  {
+    Resource::Ptr resource = (obj.parent_ == nullptr) ? nullptr : obj.parent_->locateResource(obj.url_);
+    obj.buffer_ = (resource == nullptr) ? ResourceBuffer() : resource->getResourceBuffer();
+  }
+}
+
 template <class Archive>
 void save(Archive& ar, const PluginInfo& obj)
 {
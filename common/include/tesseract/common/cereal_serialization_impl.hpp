@@ -36,6 +36,8 @@ CEREAL_REGISTER_TYPE(tesseract::common::Resource)
 CEREAL_REGISTER_TYPE(tesseract::common::GeneralResourceLocator)
 CEREAL_REGISTER_TYPE(tesseract::common::SimpleLocatedResource)
 CEREAL_REGISTER_TYPE(tesseract::common::BytesResource)
+CEREAL_REGISTER_TYPE(tesseract::common::BundleResourceLocator)
+CEREAL_REGISTER_TYPE(tesseract::common::BundleResource)
 CEREAL_REGISTER_TYPE(tesseract::common::ProfileDictionaryPtrAnyPoly)
 
 CEREAL_REGISTER_POLYMORPHIC_RELATION(tesseract::common::AnyInterface, tesseract::common::BoolAnyPoly)
@@ -70,6 +72,8 @@ CEREAL_REGISTER_POLYMORPHIC_RELATION(tesseract::common::ResourceLocator, tessera
 CEREAL_REGISTER_POLYMORPHIC_RELATION(tesseract::common::ResourceLocator, tesseract::common::GeneralResourceLocator)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(tesseract::common::Resource, tesseract::common::SimpleLocatedResource)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(tesseract::common::Resource, tesseract::common::BytesResource)
+CEREAL_REGISTER_POLYMORPHIC_RELATION(tesseract::common::ResourceLocator, tesseract::common::BundleResourceLocator)
+CEREAL_REGISTER_POLYMORPHIC_RELATION(tesseract::common::Resource, tesseract::common::BundleResource)
 CEREAL_REGISTER_POLYMORPHIC_RELATION(tesseract::common::AnyInterface, tesseract::common::ProfileDictionaryPtrAnyPoly)
 
 #endif  // TESSERACT_COMMON_CEREAL_SERIALIZATION_IMPL_HPP
@@ -72,6 +72,12 @@ class ResourceLocator;
 // serialization.h
 struct Serialization;
 
+// task_pool.h
+class TaskExecutor;
+class SerialTaskExecutor;
+class TaskPool;
+class TaskGroup;
+
 // timer.h
 class Timer;
 
@@ -26,9 +26,13 @@
 
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
 #include <functional>
+#include <istream>
+#include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 #include <filesystem>
@@ -41,6 +45,8 @@ class Resource;
 class GeneralResourceLocator;
 class SimpleLocatedResource;
 class BytesResource;
+class BundleResourceLocator;
+class BundleResource;
 
 template <class Archive>
 void serialize(Archive& ar, Resource& obj);
@@ -54,6 +60,79 @@ void serialize(Archive& ar, SimpleLocatedResource& obj);
 template <class Archive>
 void serialize(Archive& ar, BytesResource& obj);
 
+template <class Archive>
+void serialize(Archive& ar, BundleResourceLocator& obj);
+
+template <class Archive>
+void serialize(Archive& ar, BundleResource& obj);
+
+/**
+ * @brief An immutable view of resource bytes which shares ownership of the underlying storage
+ * @details The storage is a memory mapped file or a shared byte buffer, so copying a buffer does not copy the bytes
+ * and the bytes stay valid as long as any copy of the buffer exists.
+ */
+class ResourceBuffer
+{
+public:
+  ResourceBuffer() = default;
+
+  /**
+   * @brief Create a buffer which takes ownership of the bytes
+   * @param bytes The bytes
+   */
+  explicit ResourceBuffer(std::vector<uint8_t> bytes);
+
+  /**
+   * @brief Create a buffer which shares ownership of the bytes
+   * @param bytes The bytes, they must not be modified while the buffer exists
+   */
+  explicit ResourceBuffer(std::shared_ptr<const std::vector<uint8_t>> bytes);
+
+  /**
+   * @brief Create a buffer over memory owned by another object
+   * @param data The first byte
+   * @param size The number of bytes
+   * @param owner The object which owns the memory, it is released when the last copy of the buffer is destroyed
+   */
+  ResourceBuffer(const uint8_t* data, std::size_t size, std::shared_ptr<const void> owner);
+
+  /** @brief Get a pointer to the first byte, nullptr if the buffer is empty */
+  const uint8_t* data() const;
+
+  /** @brief Get the number of bytes */
+  std::size_t size() const;
+
+  /** @brief Check if the buffer is empty */
+  bool empty() const;
+
+  const uint8_t* begin() const;
+  const uint8_t* end() const;
+
+  /** @brief Get the bytes as characters, this is useful for text resources */
+  std::string_view view() const;
+
+  /**
+   * @brief Get a part of the buffer which shares ownership of the bytes
+   * @details This throws std::out_of_range if the part is not within the buffer
+   * @param offset The offset of the first byte
+   * @param size The number of bytes
+   * @return The part of the buffer
+   */
+  ResourceBuffer subBuffer(std::size_t offset, std::size_t size) const;
+
+  /**
+   * @brief Create a stream which reads the buffer without copying it
+   * @details The stream shares ownership of the bytes and supports seeking
+   * @return A std::istream shared pointer for the buffer
+   */
+  std::shared_ptr<std::istream> createStream() const;
+
+private:
+  const uint8_t* data_{ nullptr };
+  std::size_t size_{ 0 };
+  std::shared_ptr<const void> owner_;
+};
+
 /** @brief Abstract class for resource loaders */
 class ResourceLocator
 {
@@ -134,7 +213,14 @@ public:
   bool loadEnvironmentVariable(const std::string& environment_variable);
 
 private:
-  std::unordered_map<std::string, std::string> package_paths_;
+  /**
+   * @brief The package paths
+   * @details This is shared with the copies stored as the parent of every located resource, so it is copied before
+   * being modified if it is shared.
+   */
+  std::shared_ptr<std::unordered_map<std::string, std::string>> package_paths_{
+    std::make_shared<std::unordered_map<std::string, std::string>>()
+  };
 
   void processToken(const std::string& token);
 
@@ -184,6 +270,14 @@ public:
    */
   virtual std::shared_ptr<std::istream> getResourceContentStream() const = 0;
 
+  /**
+   * @brief Get the resource as an immutable shared buffer. This function may block
+   * @details Unlike getResourceContents() the bytes are not copied for every call. The default implementation wraps
+   * the result of getResourceContents().
+   * @return The resource bytes, empty if the resource could not be read
+   */
+  virtual ResourceBuffer getResourceBuffer() const;
+
   bool operator==(const Resource& rhs) const;
   bool operator!=(const Resource& rhs) const;
 
@@ -227,6 +321,9 @@ public:
 
   std::shared_ptr<std::istream> getResourceContentStream() const override final;
 
+  /** @brief The file is memory mapped where supported, otherwise it is read into a shared buffer */
+  ResourceBuffer getResourceBuffer() const override final;
+
   Resource::Ptr locateResource(const std::string& url) const override final;
 
   bool operator==(const SimpleLocatedResource& rhs) const;
@@ -260,6 +357,7 @@ public:
   std::string getFilePath() const override final;
   std::vector<uint8_t> getResourceContents() const override final;
   std::shared_ptr<std::istream> getResourceContentStream() const override final;
+  ResourceBuffer getResourceBuffer() const override final;
   Resource::Ptr locateResource(const std::string& url) const override final;
 
   bool operator==(const BytesResource& rhs) const;
@@ -267,13 +365,120 @@ public:
 
 private:
   std::string url_;
-  std::vector<uint8_t> bytes_;
+  /** @brief The bytes, these are shared with the buffers returned by getResourceBuffer() and never modified */
+  std::shared_ptr<std::vector<uint8_t>> bytes_{ std::make_shared<std::vector<uint8_t>>() };
   ResourceLocator::ConstPtr parent_;
 
   template <class Archive>
   friend void ::tesseract::common::serialize(Archive& ar, BytesResource& obj);
 };
 
+/**
+ * @brief A resource locator which serves every resource from a single bundle file
+ * @details A bundle stores the bytes of resources indexed by the url used to locate them, so loading a robot with
+ * its meshes and configuration files opens a single file which is memory mapped. Create a bundle with
+ * writeResourceBundle() or the create_resource_bundle tool. Only urls stored in the bundle can be located, relative
+ * urls are resolved against the url of the resource they are located from like SimpleLocatedResource.
+ *
+ * The bundle layout, the integers use the byte order of the writer and are byte swapped when read on a host with the
+ * other byte order:
+ *   - The magic "TESBUNDL" (8 bytes)
+ *   - The byte order mark 0x01020304 (uint32)
+ *   - The layout version, currently 1 (uint32)
+ *   - The number of entries (uint64)
+ *   - For every entry the url size (uint64), the offset of the data from the start of the file (uint64), the data
+ *     size (uint64) and the url characters
+ *   - The data of every entry
+ */
+class BundleResourceLocator : public ResourceLocator
+{
+public:
+  using Ptr = std::shared_ptr<BundleResourceLocator>;
+  using ConstPtr = std::shared_ptr<const BundleResourceLocator>;
+
+  /** @brief This is for serialization do not use directly */
+  BundleResourceLocator() = default;
+
+  /**
+   * @brief Open a bundle
+   * @details This throws if the bundle can not be read or is invalid
+   * @param bundle_path The file path of the bundle
+   */
+  explicit BundleResourceLocator(std::string bundle_path);
+  ~BundleResourceLocator() override = default;
+  BundleResourceLocator(const BundleResourceLocator&) = default;
+  BundleResourceLocator& operator=(const BundleResourceLocator&) = default;
+  BundleResourceLocator(BundleResourceLocator&&) = default;
+  BundleResourceLocator& operator=(BundleResourceLocator&&) = default;
+
+  std::shared_ptr<Resource> locateResource(const std::string& url) const override;
+
+  /** @brief Get the file path of the bundle */
+  const std::string& getBundlePath() const;
+
+  /** @brief Get the urls of the resources in the bundle */
+  std::vector<std::string> getUrls() const;
+
+  bool operator==(const BundleResourceLocator& rhs) const;
+  bool operator!=(const BundleResourceLocator& rhs) const;
+
+private:
+  std::string bundle_path_;
+
+  /** @brief The resource buffers, these share the mapped bundle and are shared with the copies of the locator */
+  std::shared_ptr<const std::unordered_map<std::string, ResourceBuffer>> resources_{
+    std::make_shared<const std::unordered_map<std::string, ResourceBuffer>>()
+  };
+
+  /** @brief Map the bundle and read its index */
+  void load();
+
+  template <class Archive>
+  friend void ::tesseract::common::serialize(Archive& ar, BundleResourceLocator& obj);
+};
+
+/** @brief A resource stored in a bundle, see BundleResourceLocator */
+class BundleResource : public Resource
+{
+public:
+  /** @brief This is for serialization do not use directly */
+  BundleResource() = default;
+
+  BundleResource(std::string url, ResourceBuffer buffer, std::shared_ptr<const BundleResourceLocator> parent);
+  ~BundleResource() override = default;
+  BundleResource(const BundleResource&) = default;
+  BundleResource& operator=(const BundleResource&) = default;
+  BundleResource(BundleResource&&) = default;
+  BundleResource& operator=(BundleResource&&) = default;
+
+  bool isFile() const override final;
+  std::string getUrl() const override final;
+  std::string getFilePath() const override final;
+  std::vector<uint8_t> getResourceContents() const override final;
+  std::shared_ptr<std::istream> getResourceContentStream() const override final;
+  ResourceBuffer getResourceBuffer() const override final;
+  Resource::Ptr locateResource(const std::string& url) const override final;
+
+  bool operator==(const BundleResource& rhs) const;
+  bool operator!=(const BundleResource& rhs) const;
+
+private:
+  std::string url_;
+  ResourceBuffer buffer_;
+  std::shared_ptr<const BundleResourceLocator> parent_;
+
+  template <class Archive>
+  friend void ::tesseract::common::serialize(Archive& ar, BundleResource& obj);
+};
+
+/**
+ * @brief Write resources to a bundle which can be loaded with the BundleResourceLocator
+ * @details This throws if a resource can not be read or the bundle can not be written
+ * @param bundle_path The file path of the bundle
+ * @param resources The resources indexed by the url used to locate them
+ */
+void writeResourceBundle(const std::string& bundle_path, const std::map<std::string, Resource::ConstPtr>& resources);
+
 }  // namespace tesseract::common
 
 #endif  // TESSERACT_COMMON_RESOURCE_LOCATOR_H
@@ -0,0 +1,228 @@
+/**
+ * @file task_pool.h
+ * @brief A work-stealing task pool with task groups, cancellation and a serial fallback
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMON_TASK_POOL_H
+#define TESSERACT_COMMON_TASK_POOL_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract::common
+{
+/**
+ * @brief The interface used to execute tasks
+ * @details Parallel utilities take a TaskExecutor so the caller decides which threads are used. Tasks submitted
+ * directly to an executor are fire and forget, use a TaskGroup to wait for them.
+ */
+class TaskExecutor
+{
+public:
+  using Ptr = std::shared_ptr<TaskExecutor>;
+  using ConstPtr = std::shared_ptr<const TaskExecutor>;
+
+  TaskExecutor() = default;
+  virtual ~TaskExecutor() = default;
+  TaskExecutor(const TaskExecutor&) = delete;
+  TaskExecutor& operator=(const TaskExecutor&) = delete;
+  TaskExecutor(TaskExecutor&&) = delete;
+  TaskExecutor& operator=(TaskExecutor&&) = delete;
+
+  /**
+   * @brief Get the number of worker threads
+   * @details Zero indicates tasks are executed on the thread which submits them
+   */
+  virtual std::size_t getThreadCount() const = 0;
+
+  /**
+   * @brief Submit a task for execution
+   * @param task The task, it must not throw
+   */
+  virtual void submit(std::function<void()> task) = 0;
+
+  /**
+   * @brief Execute one pending task on the calling thread
+   * @details This is used by threads waiting on tasks so they help instead of blocking, which also makes nested
+   * parallelism safe.
+   * @return True if a task was executed, otherwise false
+   */
+  virtual bool runPendingTask() = 0;
+};
+
+/** @brief Executes every task immediately on the thread which submits it */
+class SerialTaskExecutor : public TaskExecutor
+{
+public:
+  using Ptr = std::shared_ptr<SerialTaskExecutor>;
+  using ConstPtr = std::shared_ptr<const SerialTaskExecutor>;
+
+  std::size_t getThreadCount() const override;
+  void submit(std::function<void()> task) override;
+  bool runPendingTask() override;
+};
+
+/**
+ * @brief A work-stealing task pool
+ * @details Every worker has its own queue. Tasks submitted by a worker are pushed to its own queue and executed last
+ * in first out, tasks submitted by other threads are distributed round robin. Workers without tasks steal the oldest
+ * task from the other queues. If the pool has no workers it behaves like the SerialTaskExecutor.
+ */
+class TaskPool : public TaskExecutor
+{
+public:
+  using Ptr = std::shared_ptr<TaskPool>;
+  using ConstPtr = std::shared_ptr<const TaskPool>;
+
+  /**
+   * @brief Create a task pool
+   * @param thread_count The number of worker threads
+   */
+  explicit TaskPool(std::size_t thread_count = std::thread::hardware_concurrency());
+
+  /** @brief Executes the remaining tasks and joins the worker threads */
+  ~TaskPool() override;
+  TaskPool(const TaskPool&) = delete;
+  TaskPool& operator=(const TaskPool&) = delete;
+  TaskPool(TaskPool&&) = delete;
+  TaskPool& operator=(TaskPool&&) = delete;
+
+  std::size_t getThreadCount() const override;
+  void submit(std::function<void()> task) override;
+  bool runPendingTask() override;
+
+private:
+  struct WorkerQueue
+  {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::atomic<std::size_t> pending_{ 0 };
+  std::atomic<std::size_t> next_queue_{ 0 };
+  bool stop_{ false };
+
+  /** @brief Get the index of the calling worker thread, the thread count if it is not a worker of this pool */
+  std::size_t getWorkerIndex() const;
+
+  /**
+   * @brief Pop a task from the queue of a worker, otherwise steal one from the other queues
+   * @param index The index of the queue to pop from first
+   * @param task The task
+   * @return True if a task was found, otherwise false
+   */
+  bool popTask(std::size_t index, std::function<void()>& task);
+
+  void workerLoop(std::size_t index);
+};
+
+/**
+ * @brief A group of tasks which can be waited on and canceled together
+ * @details The first exception thrown by a task cancels the group and is rethrown by wait(). Tasks which have not
+ * started when the group is canceled are skipped, running tasks can check isCanceled() to exit early. The destructor
+ * cancels and waits on the remaining tasks.
+ */
+class TaskGroup
+{
+public:
+  /**
+   * @brief Create a task group
+   * @param executor The executor, it must outlive the task group
+   */
+  explicit TaskGroup(TaskExecutor& executor);
+  ~TaskGroup();
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+  TaskGroup(TaskGroup&&) = delete;
+  TaskGroup& operator=(TaskGroup&&) = delete;
+
+  /**
+   * @brief Run a task as part of the group
+   * @param task The task
+   */
+  void run(std::function<void()> task);
+
+  /**
+   * @brief Wait for every task in the group to finish
+   * @details The calling thread executes pending tasks while waiting. Afterwards the group can be reused.
+   */
+  void wait();
+
+  /** @brief Cancel the tasks in the group which have not started */
+  void cancel();
+
+  /** @brief Check if the group was canceled */
+  bool isCanceled() const;
+
+private:
+  struct State
+  {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t pending{ 0 };
+    std::atomic<bool> canceled{ false };
+    std::exception_ptr exception;
+  };
+
+  TaskExecutor& executor_;
+  std::shared_ptr<State> state_;
+
+  /** @brief Wait for the tasks without rethrowing exceptions */
+  void waitHelper();
+};
+
+/**
+ * @brief Split a range into blocks and execute them in parallel
+ * @details The blocks are contiguous and the calling thread participates. If the executor has no worker threads or
+ * the range is smaller than the grain size the function is called once with the full range. Exceptions are rethrown
+ * after every block has finished or was skipped.
+ * @param executor The executor
+ * @param size The size of the range
+ * @param fn The function called with the begin and end index of each block
+ * @param grain_size The minimum number of items in a block
+ */
+void parallelFor(TaskExecutor& executor,
+                 std::size_t size,
+                 const std::function<void(std::size_t, std::size_t)>& fn,
+                 std::size_t grain_size = 1);
+
+/**
+ * @brief Get the task pool shared by the library
+ * @details This has a worker thread per hardware thread and is created on first use
+ */
+TaskExecutor& getGlobalTaskExecutor();
+
+}  // namespace tesseract::common
+
+#endif  // TESSERACT_COMMON_TASK_POOL_H
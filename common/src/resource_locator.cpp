@@ -24,11 +24,19 @@
 
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstring>
 #include <fstream>
 #include <console_bridge/console.h>
+#include <streambuf>
 #include <iostream>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/common/resource_locator.h>
@@ -37,6 +45,154 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract::common
 {
+namespace
+{
+/** @brief The first bytes of a resource bundle */
+constexpr std::string_view BUNDLE_MAGIC{ "TESBUNDL" };
+
+/** @brief The byte order mark of a resource bundle, it reads byte swapped if the bundle has the other byte order */
+constexpr std::uint32_t BUNDLE_BYTE_ORDER_MARK{ 0x01020304 };
+
+/** @brief The version of the resource bundle layout */
+constexpr std::uint32_t BUNDLE_VERSION{ 1 };
+
+/** @brief The size of the resource bundle header, the magic, the byte order mark, the version and the entry count */
+constexpr std::size_t BUNDLE_HEADER_SIZE{ BUNDLE_MAGIC.size() + (2 * sizeof(std::uint32_t)) + sizeof(std::uint64_t) };
+
+/** @brief Reverse the byte order of an unsigned integer */
+template <typename T>
+T byteSwap(T value)
+{
+  T swapped{ 0 };
+  for (std::size_t i = 0; i < sizeof(T); ++i)
+  {
+    swapped = static_cast<T>(swapped << 8U) | static_cast<T>(value & 0xFFU);
+    value = static_cast<T>(value >> 8U);
+  }
+  return swapped;
+}
+
+/**
+ * @brief Resolve a url relative to the url of the resource it is located from
+ * @return The resolved url, empty if the base url has no separator
+ */
+std::string getRelativeUrl(const std::string& base_url, const std::string& url)
+{
+  // Find the last occurrences of both separators
+  std::size_t last_slash = base_url.find_last_of('/');
+  std::size_t last_backslash = base_url.find_last_of('\\');
+  std::size_t last_separator{ 0 };
+  if (last_slash != std::string::npos && last_backslash != std::string::npos)
+    last_separator = std::max(last_slash, last_backslash);
+  else if (last_slash != std::string::npos)
+    last_separator = last_slash;
+  else if (last_backslash != std::string::npos)
+    last_separator = last_backslash;
+  else
+    return {};
+
+  std::filesystem::path path(url);
+  std::string url_base_path = base_url.substr(0, last_separator);
+  return url_base_path + std::string(1, std::filesystem::path::preferred_separator) + path.filename().string();
+}
+
+/** @brief A read only stream buffer over memory which is not owned */
+class ResourceStreamBuffer : public std::streambuf
+{
+public:
+  ResourceStreamBuffer(const uint8_t* data, std::size_t size)
+  {
+    // The get area is never written to, std::streambuf only takes non const pointers
+    auto* begin = const_cast<char*>(reinterpret_cast<const char*>(data));  // NOLINT
+    setg(begin, begin, begin + size);                                     // NOLINT
+  }
+
+protected:
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+  {
+    if ((which & std::ios_base::in) == 0)
+      return pos_type(off_type(-1));
+
+    off_type pos{ 0 };
+    if (dir == std::ios_base::beg)
+      pos = off;
+    else if (dir == std::ios_base::cur)
+      pos = (gptr() - eback()) + off;
+    else
+      pos = (egptr() - eback()) + off;
+
+    if (pos < 0 || pos > (egptr() - eback()))
+      return pos_type(off_type(-1));
+
+    setg(eback(), eback() + pos, egptr());  // NOLINT
+    return pos_type(pos);
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+  {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+};
+
+/** @brief A stream which keeps the bytes of the resource buffer it reads alive */
+class ResourceBufferStream : public std::istream
+{
+public:
+  explicit ResourceBufferStream(ResourceBuffer buffer)
+    : std::istream(nullptr), buffer_(std::move(buffer)), stream_buffer_(buffer_.data(), buffer_.size())
+  {
+    rdbuf(&stream_buffer_);
+  }
+
+private:
+  ResourceBuffer buffer_;
+  ResourceStreamBuffer stream_buffer_;
+};
+}  // namespace
+
+ResourceBuffer::ResourceBuffer(std::vector<uint8_t> bytes)
+  : ResourceBuffer(std::make_shared<const std::vector<uint8_t>>(std::move(bytes)))
+{
+}
+
+ResourceBuffer::ResourceBuffer(std::shared_ptr<const std::vector<uint8_t>> bytes)
+{
+  if (bytes == nullptr || bytes->empty())
+    return;
+
+  data_ = bytes->data();
+  size_ = bytes->size();
+  owner_ = std::move(bytes);
+}
+
+ResourceBuffer::ResourceBuffer(const uint8_t* data, std::size_t size, std::shared_ptr<const void> owner)
+  : data_((size == 0) ? nullptr : data), size_((data == nullptr) ? 0 : size), owner_(std::move(owner))
+{
+}
+
+const uint8_t* ResourceBuffer::data() const { return data_; }
+std::size_t ResourceBuffer::size() const { return size_; }
+bool ResourceBuffer::empty() const { return (size_ == 0); }
+const uint8_t* ResourceBuffer::begin() const { return data_; }
+const uint8_t* ResourceBuffer::end() const { return data_ + size_; }  // NOLINT
+std::string_view ResourceBuffer::view() const
+{
+  return (size_ == 0) ? std::string_view() : std::string_view(reinterpret_cast<const char*>(data_), size_);  // NOLINT
+}
+
+ResourceBuffer ResourceBuffer::subBuffer(std::size_t offset, std::size_t size) const
+{
+  if (offset > size_ || size > size_ - offset)
+    throw std::out_of_range("ResourceBuffer: The part is not within the buffer!");
+
+  return { data_ + offset, size, owner_ };  // NOLINT
+}
+
+std::shared_ptr<std::istream> ResourceBuffer::createStream() const
+{
+  return std::make_shared<ResourceBufferStream>(*this);
+}
+
 bool isRelativePath(const std::string& url)
 {
   std::filesystem::path path(url);
@@ -104,14 +260,18 @@ void GeneralResourceLocator::processToken(const std::string& token)
   std::filesystem::path d(token);
   if (std::filesystem::is_directory(d) && std::filesystem::exists(d))
   {
+    // The package paths may be shared with the parent of a located resource
+    if (package_paths_.use_count() > 1)
+      package_paths_ = std::make_shared<std::unordered_map<std::string, std::string>>(*package_paths_);
+
     // Check current directory
     std::filesystem::path check = d;
     check.append("package.xml");
     if (std::filesystem::exists(check))
     {
       std::string dir_name = d.filename().string();
-      if (package_paths_.find(dir_name) == package_paths_.end())
-        package_paths_[dir_name] = d.string();
+      if (package_paths_->find(dir_name) == package_paths_->end())
+        (*package_paths_)[dir_name] = d.string();
     }
 
     // Check all subdirectories
@@ -123,8 +283,8 @@ void GeneralResourceLocator::processToken(const std::string& token)
       if (std::filesystem::exists(check))
       {
         std::string dir_name = dir->path().filename().string();
-        if (package_paths_.find(dir_name) == package_paths_.end())
-          package_paths_[dir_name] = dir->path().string();
+        if (package_paths_->find(dir_name) == package_paths_->end())
+          (*package_paths_)[dir_name] = dir->path().string();
 
         dir.disable_recursion_pending();  // don't recurse into this directory.
       }
@@ -175,8 +335,8 @@ std::shared_ptr<Resource> GeneralResourceLocator::locateResource(const std::stri
     std::string package = mod_url.substr(0, pos);
     mod_url.erase(0, pos);
 
-    auto find_package = package_paths_.find(package);
-    if (find_package != package_paths_.end())
+    auto find_package = package_paths_->find(package);
+    if (find_package != package_paths_->end())
     {
       mod_url = find_package->second + mod_url;
     }
@@ -193,16 +353,19 @@ std::shared_ptr<Resource> GeneralResourceLocator::locateResource(const std::stri
     return nullptr;
   }
 
+  // The copy shares the package paths
   return std::make_shared<SimpleLocatedResource>(url, mod_url, std::make_shared<GeneralResourceLocator>(*this));
 }
 
 bool GeneralResourceLocator::operator==(const GeneralResourceLocator& rhs) const
 {
   return tesseract::common::isIdenticalMap<std::unordered_map<std::string, std::string>, std::string>(
-      package_paths_, rhs.package_paths_);
+      *package_paths_, *rhs.package_paths_);
 }
 bool GeneralResourceLocator::operator!=(const GeneralResourceLocator& rhs) const { return !operator==(rhs); }
 
+ResourceBuffer Resource::getResourceBuffer() const { return ResourceBuffer(getResourceContents()); }
+
 bool Resource::operator==(const Resource& /*rhs*/) const { return true; }
 bool Resource::operator!=(const Resource& /*rhs*/) const { return false; }
 
@@ -248,6 +411,45 @@ std::shared_ptr<std::istream> SimpleLocatedResource::getResourceContentStream()
   return ifs;
 }
 
+ResourceBuffer SimpleLocatedResource::getResourceBuffer() const
+{
+#ifndef _WIN32
+  const int fd = ::open(filename_.c_str(), O_RDONLY);  // NOLINT
+  if (fd < 0)
+  {
+    CONSOLE_BRIDGE_logError("Could not get resource: %s", filename_.c_str());
+    return {};
+  }
+
+  struct stat file_stat
+  {
+  };
+  if (::fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode))  // NOLINT
+  {
+    ::close(fd);
+    return Resource::getResourceBuffer();
+  }
+
+  const auto size = static_cast<std::size_t>(file_stat.st_size);
+  if (size == 0)
+  {
+    ::close(fd);
+    return {};
+  }
+
+  // The mapping stays valid after the file descriptor is closed
+  void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED)  // NOLINT
+    return Resource::getResourceBuffer();
+
+  std::shared_ptr<const void> owner(data, [size](const void* ptr) { ::munmap(const_cast<void*>(ptr), size); });
+  return { static_cast<const uint8_t*>(data), size, std::move(owner) };
+#else
+  return Resource::getResourceBuffer();
+#endif
+}
+
 tesseract::common::Resource::Ptr SimpleLocatedResource::locateResource(const std::string& url) const
 {
   if (parent_ == nullptr || url.empty())
@@ -255,23 +457,10 @@ tesseract::common::Resource::Ptr SimpleLocatedResource::locateResource(const std
 
   if (isRelativePath(url))
   {
-    // Find the last occurrences of both separators
-    std::size_t last_slash = url_.find_last_of('/');
-    std::size_t last_backslash = url_.find_last_of('\\');
-    std::size_t last_separator{ 0 };
-    if (last_slash != std::string::npos && last_backslash != std::string::npos)
-      last_separator = std::max(last_slash, last_backslash);
-    else if (last_slash != std::string::npos)
-      last_separator = last_slash;
-    else if (last_backslash != std::string::npos)
-      last_separator = last_backslash;
-    else
+    std::string new_url = getRelativeUrl(url_, url);
+    if (new_url.empty())
       return nullptr;
 
-    std::filesystem::path path(url);
-    std::string url_base_path = url_.substr(0, last_separator);
-    std::string new_url =
-        url_base_path + std::string(1, std::filesystem::path::preferred_separator) + path.filename().string();
     CONSOLE_BRIDGE_logDebug("new_url: %s", new_url.c_str());
     return parent_->locateResource(new_url);
   }
@@ -292,13 +481,13 @@ bool SimpleLocatedResource::operator==(const SimpleLocatedResource& rhs) const
 bool SimpleLocatedResource::operator!=(const SimpleLocatedResource& rhs) const { return !operator==(rhs); }
 
 BytesResource::BytesResource(std::string url, std::vector<uint8_t> bytes, ResourceLocator::ConstPtr parent)
-  : url_(std::move(url)), bytes_(std::move(bytes)), parent_(std::move(parent))
+  : url_(std::move(url)), bytes_(std::make_shared<std::vector<uint8_t>>(std::move(bytes))), parent_(std::move(parent))
 {
 }
 
 BytesResource::BytesResource(std::string url, const uint8_t* bytes, size_t bytes_len, ResourceLocator::ConstPtr parent)
   : url_(std::move(url))
-  , bytes_(std::vector<uint8_t>(bytes, bytes + bytes_len))  // NOLINT
+  , bytes_(std::make_shared<std::vector<uint8_t>>(bytes, bytes + bytes_len))  // NOLINT
   , parent_(std::move(parent))
 {
 }
@@ -306,14 +495,12 @@ BytesResource::BytesResource(std::string url, const uint8_t* bytes, size_t bytes
 bool BytesResource::isFile() const { return false; }
 std::string BytesResource::getUrl() const { return url_; }
 std::string BytesResource::getFilePath() const { return ""; }
-std::vector<uint8_t> BytesResource::getResourceContents() const { return bytes_; }
+std::vector<uint8_t> BytesResource::getResourceContents() const { return *bytes_; }
 std::shared_ptr<std::istream> BytesResource::getResourceContentStream() const
 {
-  std::shared_ptr<std::stringstream> o = std::make_shared<std::stringstream>();
-  o->write((const char*)&bytes_.at(0), static_cast<std::streamsize>(bytes_.size()));  // NOLINT
-  o->seekg(0, std::stringstream::beg);
-  return o;
+  return getResourceBuffer().createStream();
 }
+ResourceBuffer BytesResource::getResourceBuffer() const { return ResourceBuffer(bytes_); }
 
 Resource::Ptr BytesResource::locateResource(const std::string& url) const
 {
@@ -342,11 +529,214 @@ bool BytesResource::operator==(const BytesResource& rhs) const
   bool equal = true;
   equal &= Resource::operator==(rhs);
   equal &= url_ == rhs.url_;
-  equal &= bytes_ == rhs.bytes_;
+  equal &= *bytes_ == *rhs.bytes_;
   equal &= tesseract::common::pointersEqual(parent_, rhs.parent_);
   return equal;
 }
 
 bool BytesResource::operator!=(const BytesResource& rhs) const { return !operator==(rhs); }
 
+BundleResourceLocator::BundleResourceLocator(std::string bundle_path) : bundle_path_(std::move(bundle_path))
+{
+  load();
+}
+
+void BundleResourceLocator::load()
+{
+  // The bundle is the only file opened, every resource shares its mapping
+  const ResourceBuffer bundle = SimpleLocatedResource(bundle_path_, bundle_path_).getResourceBuffer();
+
+  std::size_t pos{ 0 };
+  auto read = [&bundle, &pos](std::size_t size) {
+    try
+    {
+      ResourceBuffer buffer = bundle.subBuffer(pos, size);
+      pos += size;
+      return buffer;
+    }
+    catch (...)
+    {
+      std::throw_with_nested(std::runtime_error("BundleResourceLocator: The bundle is truncated!"));
+    }
+  };
+  bool swap{ false };
+  auto read_uint32 = [&read, &swap]() {
+    std::uint32_t value{ 0 };
+    std::memcpy(&value, read(sizeof(value)).data(), sizeof(value));
+    return (swap) ? byteSwap(value) : value;
+  };
+  auto read_uint64 = [&read, &swap]() {
+    std::uint64_t value{ 0 };
+    std::memcpy(&value, read(sizeof(value)).data(), sizeof(value));
+    return static_cast<std::size_t>((swap) ? byteSwap(value) : value);
+  };
+
+  if (bundle.empty())
+    throw std::runtime_error("BundleResourceLocator: Failed to read '" + bundle_path_ + "'!");
+
+  if (bundle.size() < BUNDLE_HEADER_SIZE || read(BUNDLE_MAGIC.size()).view() != BUNDLE_MAGIC)
+    throw std::runtime_error("BundleResourceLocator: '" + bundle_path_ + "' is not a resource bundle!");
+
+  // The bundle is read in either byte order
+  const std::uint32_t byte_order_mark = read_uint32();
+  if (byte_order_mark == byteSwap(BUNDLE_BYTE_ORDER_MARK))
+    swap = true;
+  else if (byte_order_mark != BUNDLE_BYTE_ORDER_MARK)
+    throw std::runtime_error("BundleResourceLocator: '" + bundle_path_ + "' has an invalid byte order mark!");
+
+  const std::uint32_t version = read_uint32();
+  if (version != BUNDLE_VERSION)
+    throw std::runtime_error("BundleResourceLocator: '" + bundle_path_ + "' has the unsupported version " +
+                             std::to_string(version) + "!");
+
+  auto resources = std::make_shared<std::unordered_map<std::string, ResourceBuffer>>();
+  const std::size_t count = read_uint64();
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const std::size_t url_size = read_uint64();
+    const std::size_t offset = read_uint64();
+    const std::size_t size = read_uint64();
+    std::string url(read(url_size).view());
+    try
+    {
+      (*resources)[std::move(url)] = bundle.subBuffer(offset, size);
+    }
+    catch (...)
+    {
+      std::throw_with_nested(std::runtime_error("BundleResourceLocator: The bundle is truncated!"));
+    }
+  }
+
+  resources_ = std::move(resources);
+}
+
+std::shared_ptr<Resource> BundleResourceLocator::locateResource(const std::string& url) const
+{
+  auto it = resources_->find(url);
+  if (it == resources_->end())
+  {
+    CONSOLE_BRIDGE_logError("Failed to find resource %s in bundle %s", url.c_str(), bundle_path_.c_str());
+    return nullptr;
+  }
+
+  // The copy shares the resource buffers
+  return std::make_shared<BundleResource>(url, it->second, std::make_shared<BundleResourceLocator>(*this));
+}
+
+const std::string& BundleResourceLocator::getBundlePath() const { return bundle_path_; }
+
+std::vector<std::string> BundleResourceLocator::getUrls() const
+{
+  std::vector<std::string> urls;
+  urls.reserve(resources_->size());
+  for (const auto& resource : *resources_)
+    urls.push_back(resource.first);
+
+  return urls;
+}
+
+bool BundleResourceLocator::operator==(const BundleResourceLocator& rhs) const
+{
+  bool equal = true;
+  equal &= ResourceLocator::operator==(rhs);
+  equal &= bundle_path_ == rhs.bundle_path_;
+  return equal;
+}
+bool BundleResourceLocator::operator!=(const BundleResourceLocator& rhs) const { return !operator==(rhs); }
+
+BundleResource::BundleResource(std::string url,
+                               ResourceBuffer buffer,
+                               std::shared_ptr<const BundleResourceLocator> parent)
+  : url_(std::move(url)), buffer_(std::move(buffer)), parent_(std::move(parent))
+{
+}
+
+bool BundleResource::isFile() const { return false; }
+std::string BundleResource::getUrl() const { return url_; }
+std::string BundleResource::getFilePath() const { return ""; }
+std::vector<uint8_t> BundleResource::getResourceContents() const { return { buffer_.begin(), buffer_.end() }; }
+std::shared_ptr<std::istream> BundleResource::getResourceContentStream() const { return buffer_.createStream(); }
+ResourceBuffer BundleResource::getResourceBuffer() const { return buffer_; }
+
+Resource::Ptr BundleResource::locateResource(const std::string& url) const
+{
+  if (parent_ == nullptr || url.empty())
+    return nullptr;
+
+  if (isRelativePath(url))
+  {
+    std::string new_url = getRelativeUrl(url_, url);
+    if (new_url.empty())
+      return nullptr;
+
+    return parent_->locateResource(new_url);
+  }
+
+  return parent_->locateResource(url);
+}
+
+bool BundleResource::operator==(const BundleResource& rhs) const
+{
+  bool equal = true;
+  equal &= Resource::operator==(rhs);
+  equal &= url_ == rhs.url_;
+  equal &= buffer_.view() == rhs.buffer_.view();
+  equal &= tesseract::common::pointersEqual(parent_, rhs.parent_);
+  return equal;
+}
+
+bool BundleResource::operator!=(const BundleResource& rhs) const { return !operator==(rhs); }
+
+void writeResourceBundle(const std::string& bundle_path, const std::map<std::string, Resource::ConstPtr>& resources)
+{
+  std::vector<ResourceBuffer> buffers;
+  buffers.reserve(resources.size());
+  std::uint64_t offset = BUNDLE_HEADER_SIZE;
+  for (const auto& resource : resources)
+  {
+    // An empty buffer is either an empty resource or a resource which can not be read
+    ResourceBuffer buffer;
+    if (resource.second != nullptr)
+      buffer = resource.second->getResourceBuffer();
+
+    if (buffer.empty() && (resource.second == nullptr || resource.second->getResourceContentStream() == nullptr))
+      throw std::runtime_error("writeResourceBundle: Failed to read resource '" + resource.first + "'!");
+
+    offset += (3 * sizeof(std::uint64_t)) + resource.first.size();
+    buffers.push_back(std::move(buffer));
+  }
+
+  std::ofstream ofs(bundle_path, std::ios::binary | std::ios::trunc);
+  if (!ofs)
+    throw std::runtime_error("writeResourceBundle: Failed to open '" + bundle_path + "'!");
+
+  auto write_uint32 = [&ofs](std::uint32_t value) {
+    ofs.write(reinterpret_cast<const char*>(&value), sizeof(value));  // NOLINT
+  };
+  auto write_uint64 = [&ofs](std::uint64_t value) {
+    ofs.write(reinterpret_cast<const char*>(&value), sizeof(value));  // NOLINT
+  };
+
+  // The integers use the native byte order, which readers detect from the byte order mark
+  ofs.write(BUNDLE_MAGIC.data(), static_cast<std::streamsize>(BUNDLE_MAGIC.size()));
+  write_uint32(BUNDLE_BYTE_ORDER_MARK);
+  write_uint32(BUNDLE_VERSION);
+  write_uint64(resources.size());
+  auto buffer = buffers.begin();
+  for (const auto& resource : resources)
+  {
+    write_uint64(resource.first.size());
+    write_uint64(offset);
+    write_uint64(buffer->size());
+    ofs.write(resource.first.data(), static_cast<std::streamsize>(resource.first.size()));
+    offset += (buffer++)->size();
+  }
+
+  for (const auto& data : buffers)
+    ofs.write(data.view().data(), static_cast<std::streamsize>(data.size()));
+
+  if (!ofs)
+    throw std::runtime_error("writeResourceBundle: Failed to write '" + bundle_path + "'!");
+}
+
 }  // namespace tesseract::common
@@ -0,0 +1,330 @@
+/**
+ * @file task_pool.cpp
+ * @brief A work-stealing task pool with task groups, cancellation and a serial fallback
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <chrono>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/common/task_pool.h>
+
+namespace tesseract::common
+{
+namespace
+{
+/** @brief The pool the calling thread is a worker of */
+thread_local const TaskPool* current_pool{ nullptr };  // NOLINT
+
+/** @brief The index of the calling thread in the pool it is a worker of */
+thread_local std::size_t current_index{ 0 };  // NOLINT
+
+/** @brief Execute a task which is not part of a task group, these must not throw */
+void runTask(const std::function<void()>& task)
+{
+  try
+  {
+    task();
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("TaskPool, a task threw an exception: %s", e.what());
+  }
+  catch (...)
+  {
+    CONSOLE_BRIDGE_logError("TaskPool, a task threw an unknown exception");
+  }
+}
+}  // namespace
+
+std::size_t SerialTaskExecutor::getThreadCount() const { return 0; }
+
+void SerialTaskExecutor::submit(std::function<void()> task) { runTask(task); }
+
+bool SerialTaskExecutor::runPendingTask() { return false; }
+
+TaskPool::TaskPool(std::size_t thread_count)
+{
+  queues_.reserve(thread_count);
+  for (std::size_t i = 0; i < thread_count; ++i)
+    queues_.push_back(std::make_unique<WorkerQueue>());
+
+  threads_.reserve(thread_count);
+  for (std::size_t i = 0; i < thread_count; ++i)
+    threads_.emplace_back([this, i]() { workerLoop(i); });
+}
+
+TaskPool::~TaskPool()
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+
+  for (auto& thread : threads_)
+    thread.join();
+}
+
+std::size_t TaskPool::getThreadCount() const { return threads_.size(); }
+
+void TaskPool::submit(std::function<void()> task)
+{
+  if (threads_.empty())
+  {
+    runTask(task);
+    return;
+  }
+
+  std::size_t index = getWorkerIndex();
+  if (index == threads_.size())
+    index = next_queue_++ % queues_.size();
+
+  // Increment first so a worker never misses a task which is being pushed
+  ++pending_;
+  {
+    std::unique_lock<std::mutex> lock(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(task));
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+  }
+  cv_.notify_one();
+}
+
+bool TaskPool::runPendingTask()
+{
+  if (threads_.empty())
+    return false;
+
+  std::function<void()> task;
+  if (!popTask(getWorkerIndex(), task))
+    return false;
+
+  runTask(task);
+  return true;
+}
+
+std::size_t TaskPool::getWorkerIndex() const { return (current_pool == this) ? current_index : threads_.size(); }
+
+bool TaskPool::popTask(std::size_t index, std::function<void()>& task)
+{
+  const std::size_t count = queues_.size();
+
+  // Workers take the newest task of their own queue because its data is most likely still in cache
+  if (index < count)
+  {
+    WorkerQueue& queue = *queues_[index];
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty())
+    {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      --pending_;
+      return true;
+    }
+  }
+
+  // Steal the oldest task of another queue
+  const std::size_t start = (index < count) ? index + 1 : next_queue_.load();
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    WorkerQueue& queue = *queues_[(start + i) % count];
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty())
+    {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      --pending_;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void TaskPool::workerLoop(std::size_t index)
+{
+  current_pool = this;
+  current_index = index;
+
+  std::function<void()> task;
+  while (true)
+  {
+    if (popTask(index, task))
+    {
+      runTask(task);
+      task = nullptr;
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return stop_ || pending_ > 0; });
+    if (stop_ && pending_ == 0)
+      return;
+  }
+}
+
+TaskGroup::TaskGroup(TaskExecutor& executor) : executor_(executor), state_(std::make_shared<State>()) {}
+
+TaskGroup::~TaskGroup()
+{
+  cancel();
+  waitHelper();
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+  if (state_->canceled)
+    return;
+
+  {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    ++state_->pending;
+  }
+
+  executor_.submit([state = state_, task = std::move(task)]() {
+    if (!state->canceled)
+    {
+      try
+      {
+        task();
+      }
+      catch (...)
+      {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        if (!state->exception)
+          state->exception = std::current_exception();
+
+        state->canceled = true;
+      }
+    }
+
+    {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      --state->pending;
+    }
+    state->cv.notify_all();
+  });
+}
+
+void TaskGroup::wait()
+{
+  waitHelper();
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    std::swap(exception, state_->exception);
+    state_->canceled = false;
+  }
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+void TaskGroup::cancel() { state_->canceled = true; }
+
+bool TaskGroup::isCanceled() const { return state_->canceled; }
+
+void TaskGroup::waitHelper()
+{
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(state_->mutex);
+      if (state_->pending == 0)
+        return;
+    }
+
+    // Help with pending tasks, otherwise every task of this group is running on another thread
+    if (!executor_.runPendingTask())
+    {
+      std::unique_lock<std::mutex> lock(state_->mutex);
+      state_->cv.wait_for(lock, std::chrono::milliseconds(1), [this]() { return state_->pending == 0; });
+    }
+  }
+}
+
+void parallelFor(TaskExecutor& executor,
+                 std::size_t size,
+                 const std::function<void(std::size_t, std::size_t)>& fn,
+                 std::size_t grain_size)
+{
+  if (size == 0)
+    return;
+
+  grain_size = std::max<std::size_t>(grain_size, 1);
+  const std::size_t thread_count = executor.getThreadCount();
+  if (thread_count == 0 || size <= grain_size)
+  {
+    fn(0, size);
+    return;
+  }
+
+  // Use several blocks per thread so idle threads can steal work when the blocks take different amounts of time
+  const std::size_t max_block_count = (size + grain_size - 1) / grain_size;
+  const std::size_t block_count = std::min((thread_count + 1) * 4, max_block_count);
+  const std::size_t block_size = (size + block_count - 1) / block_count;
+
+  TaskGroup group(executor);
+  for (std::size_t begin = block_size; begin < size; begin += block_size)
+  {
+    const std::size_t end = std::min(begin + block_size, size);
+    group.run([&fn, begin, end]() { fn(begin, end); });
+  }
+
+  // The calling thread executes the first block
+  std::exception_ptr exception;
+  try
+  {
+    fn(0, std::min(block_size, size));
+  }
+  catch (...)
+  {
+    exception = std::current_exception();
+    group.cancel();
+  }
+
+  try
+  {
+    group.wait();
+  }
+  catch (...)
+  {
+    if (!exception)
+      exception = std::current_exception();
+  }
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+TaskExecutor& getGlobalTaskExecutor()
+{
+  static TaskPool task_pool;
+  return task_pool;
+}
+
+}  // namespace tesseract::common
@@ -33,6 +33,20 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract::common
 {
+namespace
+{
+/** @brief Parse the resource from its shared buffer so files are memory mapped instead of copied */
+YAML::Node loadYamlResource(const Resource& resource)
+{
+  const ResourceBuffer buffer = resource.getResourceBuffer();
+  if (buffer.empty() && resource.isFile())
+    return YAML::LoadFile(resource.getFilePath());
+
+  std::shared_ptr<std::istream> stream = buffer.createStream();
+  return YAML::Load(*stream);
+}
+}  // namespace
+
 void processYamlIncludeDirective(YAML::Node& node, const ResourceLocator& locator)
 {
   // Case 1: this node *is* an include → replace it with the loaded file
@@ -49,7 +63,7 @@ void processYamlIncludeDirective(YAML::Node& node, const ResourceLocator& locato
       throw std::runtime_error("Unable to locate resource: " + included_file);
 
     // Parse once
-    YAML::Node loaded = YAML::LoadFile(resource->getFilePath());
+    YAML::Node loaded = loadYamlResource(*resource);
 
     // Take over this node
     node = loaded;
@@ -108,7 +122,7 @@ void processYamlIncludeDirective(YAML::Node& node, const ResourceLocator& locato
 YAML::Node loadYamlFile(const std::string& file_path, const ResourceLocator& locator)
 {
   auto resource = locator.locateResource(file_path);
-  YAML::Node root = YAML::LoadFile(resource->getFilePath());
+  YAML::Node root = loadYamlResource(*resource);
   processYamlIncludeDirective(root, *resource);
   return root;
 }
@@ -1,8 +1,12 @@
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/common/resource_locator.h>
@@ -216,6 +220,215 @@ TEST(ResourceLocatorUnit, ByteResourceUnit)  // NOLINT
   EXPECT_TRUE(resource_does_not_exist->getResourceContentStream() == nullptr);
 }
 
+TEST(ResourceLocatorUnit, ResourceBufferUnit)  // NOLINT
+{
+  using namespace tesseract::common;
+  ResourceLocator::Ptr locator = std::make_shared<TestResourceLocator>();
+
+  {  // Memory mapped file
+    Resource::Ptr resource = locator->locateResource("package://tesseract/package.xml");
+    const std::vector<uint8_t> contents = resource->getResourceContents();
+    const ResourceBuffer buffer = resource->getResourceBuffer();
+    EXPECT_FALSE(buffer.empty());
+    EXPECT_EQ(buffer.size(), contents.size());
+    EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), contents.begin(), contents.end()));
+
+    // The bytes stay valid after the resource is destroyed
+    const ResourceBuffer copy = buffer;
+    resource = nullptr;
+    EXPECT_EQ(copy.data(), buffer.data());
+    EXPECT_EQ(copy.view(), std::string(contents.begin(), contents.end()));
+
+    std::shared_ptr<std::istream> stream = copy.createStream();
+    std::string line;
+    std::getline(*stream, line);
+    EXPECT_EQ(line, copy.view().substr(0, line.size()));
+    stream->seekg(0, std::ios::end);
+    EXPECT_EQ(static_cast<std::size_t>(stream->tellg()), copy.size());
+    stream->seekg(0, std::ios::beg);
+    EXPECT_EQ(std::string(std::istreambuf_iterator<char>(*stream), {}), copy.view());
+
+    Resource::Ptr resource_does_not_exist = locator->locateResource("package://tesseract/does_not_exist.txt");
+    EXPECT_TRUE(resource_does_not_exist->getResourceBuffer().empty());
+  }
+
+  {  // Shared bytes
+    BytesResource resource("url", { 1, 2, 3, 4, 5 });
+    const ResourceBuffer buffer = resource.getResourceBuffer();
+    EXPECT_EQ(buffer.size(), 5);
+    EXPECT_EQ(buffer.data(), resource.getResourceBuffer().data());
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.end()), resource.getResourceContents());
+
+    std::shared_ptr<std::istream> stream = resource.getResourceContentStream();
+    std::vector<uint8_t> read(std::istreambuf_iterator<char>(*stream), {});
+    EXPECT_EQ(read, resource.getResourceContents());
+
+    // A copy of the resource shares the bytes
+    BytesResource resource_copy(resource);
+    EXPECT_EQ(resource_copy.getResourceBuffer().data(), buffer.data());
+    EXPECT_TRUE(resource_copy == resource);
+
+    BytesResource empty_resource("url", std::vector<uint8_t>());
+    EXPECT_TRUE(empty_resource.getResourceBuffer().empty());
+    EXPECT_TRUE(empty_resource.getResourceBuffer().view().empty());
+  }
+
+  {  // Owned bytes
+    const ResourceBuffer buffer(std::vector<uint8_t>({ 'a', 'b', 'c' }));
+    EXPECT_EQ(buffer.view(), "abc");
+
+    const ResourceBuffer empty_buffer;
+    EXPECT_TRUE(empty_buffer.empty());
+    EXPECT_TRUE(empty_buffer.data() == nullptr);
+    std::shared_ptr<std::istream> stream = empty_buffer.createStream();
+    EXPECT_EQ(stream->get(), std::char_traits<char>::eof());
+  }
+}
+
+TEST(ResourceLocatorUnit, GeneralResourceLocatorSharedPathsUnit)  // NOLINT
+{
+  using namespace tesseract::common;
+  const std::filesystem::path tmp = std::filesystem::temp_directory_path() / "tesseract_resource_locator_unit";
+  for (const std::string package : { "package_a", "package_b" })
+  {
+    std::filesystem::create_directories(tmp / package);
+    std::ofstream(tmp / package / "package.xml") << "<package/>";
+  }
+
+  GeneralResourceLocator locator(std::vector<std::string>{});
+  EXPECT_TRUE(locator.addPath(tmp / "package_a"));
+  Resource::Ptr resource = locator.locateResource("package://package_a/package.xml");
+  EXPECT_TRUE(resource != nullptr);
+  EXPECT_EQ(resource->getResourceBuffer().view(), "<package/>");
+
+  // The located resource shares the package paths, adding a path afterwards must not change them
+  EXPECT_TRUE(locator.addPath(tmp / "package_b"));
+  EXPECT_TRUE(locator.locateResource("package://package_b/package.xml") != nullptr);
+  EXPECT_TRUE(resource->locateResource("package://package_a/package.xml") != nullptr);
+  EXPECT_TRUE(resource->locateResource("package://package_b/package.xml") == nullptr);
+
+  std::filesystem::remove_all(tmp);
+}
+
+TEST(ResourceLocatorUnit, BundleResourceLocatorUnit)  // NOLINT
+{
+  using namespace tesseract::common;
+  ResourceLocator::Ptr locator = std::make_shared<TestResourceLocator>();
+  Resource::Ptr file_resource = locator->locateResource("package://tesseract/package.xml");
+  const std::string bundle_path = (std::filesystem::temp_directory_path() / "resource_locator_unit.bundle").string();
+
+  std::map<std::string, Resource::ConstPtr> resources;
+  resources["package://tesseract/package.xml"] = file_resource;
+  resources["package://tesseract/colcon.pkg"] = std::make_shared<BytesResource>("url", std::vector<uint8_t>{ 1, 2, 3 });
+  resources["package://tesseract/empty.txt"] = std::make_shared<BytesResource>("url", std::vector<uint8_t>());
+  writeResourceBundle(bundle_path, resources);
+
+  auto bundle_locator = std::make_shared<BundleResourceLocator>(bundle_path);
+  EXPECT_EQ(bundle_locator->getBundlePath(), bundle_path);
+  EXPECT_EQ(bundle_locator->getUrls().size(), 3);
+
+  Resource::Ptr resource = bundle_locator->locateResource("package://tesseract/package.xml");
+  EXPECT_TRUE(resource != nullptr);
+  EXPECT_FALSE(resource->isFile());
+  EXPECT_EQ(resource->getUrl(), "package://tesseract/package.xml");
+  EXPECT_TRUE(resource->getFilePath().empty());
+  EXPECT_EQ(resource->getResourceContents(), file_resource->getResourceContents());
+  EXPECT_EQ(resource->getResourceBuffer().view(), file_resource->getResourceBuffer().view());
+  EXPECT_TRUE(resource->getResourceContentStream() != nullptr);
+
+  // Relative urls are resolved against the url of the resource
+  const std::string separator(1, std::filesystem::path::preferred_separator);
+  if (separator == "/")
+  {
+    Resource::Ptr sub_resource = resource->locateResource("colcon.pkg");
+    EXPECT_TRUE(sub_resource != nullptr);
+    EXPECT_EQ(sub_resource->getUrl(), "package://tesseract/colcon.pkg");
+    EXPECT_EQ(sub_resource->getResourceContents(), std::vector<uint8_t>({ 1, 2, 3 }));
+  }
+
+  Resource::Ptr empty_resource = bundle_locator->locateResource("package://tesseract/empty.txt");
+  EXPECT_TRUE(empty_resource != nullptr);
+  EXPECT_TRUE(empty_resource->getResourceContents().empty());
+
+  EXPECT_TRUE(bundle_locator->locateResource("package://tesseract/does_not_exist.txt") == nullptr);
+  EXPECT_TRUE(resource->locateResource("") == nullptr);
+
+  // The header has a byte order mark and a version
+  {
+    std::ifstream ifs(bundle_path, std::ios::binary);
+    std::string magic(8, '\0');
+    std::uint32_t byte_order_mark{ 0 };
+    std::uint32_t version{ 0 };
+    ifs.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+    ifs.read(reinterpret_cast<char*>(&byte_order_mark), sizeof(byte_order_mark));  // NOLINT
+    ifs.read(reinterpret_cast<char*>(&version), sizeof(version));                  // NOLINT
+    EXPECT_EQ(magic, "TESBUNDL");
+    EXPECT_EQ(byte_order_mark, 0x01020304);
+    EXPECT_EQ(version, 1);
+  }
+
+  // A bundle written with the other byte order is read byte swapped
+  {
+    auto write_swapped = [](std::ofstream& ofs, auto value) {
+      std::array<char, sizeof(value)> bytes{};
+      std::memcpy(bytes.data(), &value, sizeof(value));
+      std::reverse(bytes.begin(), bytes.end());
+      ofs.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    };
+
+    const std::string swapped_path = bundle_path + ".swapped";
+    const std::string url = "package://tesseract/file.txt";
+    const std::string data = "swapped";
+    {
+      std::ofstream ofs(swapped_path, std::ios::binary | std::ios::trunc);
+      ofs.write("TESBUNDL", 8);
+      write_swapped(ofs, std::uint32_t{ 0x01020304 });
+      write_swapped(ofs, std::uint32_t{ 1 });
+      write_swapped(ofs, std::uint64_t{ 1 });
+      write_swapped(ofs, std::uint64_t{ url.size() });
+      write_swapped(ofs, std::uint64_t{ 8 + 4 + 4 + 8 + 24 + url.size() });
+      write_swapped(ofs, std::uint64_t{ data.size() });
+      ofs.write(url.data(), static_cast<std::streamsize>(url.size()));
+      ofs.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    BundleResourceLocator swapped_locator(swapped_path);
+    Resource::Ptr swapped_resource = swapped_locator.locateResource(url);
+    ASSERT_TRUE(swapped_resource != nullptr);
+    EXPECT_EQ(swapped_resource->getResourceBuffer().view(), data);
+    std::filesystem::remove(swapped_path);
+  }
+
+  // An unknown version or byte order mark throws
+  {
+    const std::string modified_path = bundle_path + ".modified";
+    auto write_uint32 = [&bundle_path, &modified_path](std::streamoff pos, std::uint32_t value) {
+      std::filesystem::copy_file(bundle_path, modified_path, std::filesystem::copy_options::overwrite_existing);
+      std::fstream fs(modified_path, std::ios::binary | std::ios::in | std::ios::out);
+      fs.seekp(pos);
+      fs.write(reinterpret_cast<const char*>(&value), sizeof(value));  // NOLINT
+    };
+
+    write_uint32(12, 2);
+    EXPECT_ANY_THROW(BundleResourceLocator{ modified_path });  // NOLINT
+
+    write_uint32(8, 0x04030202);
+    EXPECT_ANY_THROW(BundleResourceLocator{ modified_path });  // NOLINT
+    std::filesystem::remove(modified_path);
+  }
+
+  // Unreadable resources and invalid bundles throw
+  resources["package://tesseract/does_not_exist.txt"] =
+      locator->locateResource("package://tesseract/does_not_exist.txt");
+  EXPECT_ANY_THROW(writeResourceBundle(bundle_path, resources));  // NOLINT
+
+  std::ofstream(bundle_path, std::ios::trunc) << "not a bundle";
+  EXPECT_ANY_THROW(BundleResourceLocator{ bundle_path });  // NOLINT
+  EXPECT_ANY_THROW(BundleResourceLocator{ bundle_path + ".does_not_exist" });  // NOLINT
+
+  std::filesystem::remove(bundle_path);
+}
+
 TEST(ResourceLocatorUnit, SimpleLocatedResourceSerializUnit)  // NOLINT
 {
   using namespace tesseract::common;
@@ -230,6 +443,22 @@ TEST(ResourceLocatorUnit, BytesResourceSerializUnit)  // NOLINT
   tesseract::common::testSerialization<BytesResource>(resource, "BytesResource");
 }
 
+TEST(ResourceLocatorUnit, BundleResourceSerializUnit)  // NOLINT
+{
+  using namespace tesseract::common;
+  const std::filesystem::path bundle_file = std::filesystem::temp_directory_path() / "resource_serialize.bundle";
+  const std::string bundle_path = bundle_file.string();
+  std::map<std::string, Resource::ConstPtr> resources;
+  resources["package://tesseract/file.txt"] = std::make_shared<BytesResource>("url", std::vector<uint8_t>{ 1, 2, 3 });
+  writeResourceBundle(bundle_path, resources);
+
+  BundleResourceLocator locator(bundle_path);
+  tesseract::common::testSerialization<BundleResourceLocator>(locator, "BundleResourceLocator");
+
+  auto resource = std::dynamic_pointer_cast<BundleResource>(locator.locateResource("package://tesseract/file.txt"));
+  tesseract::common::testSerialization<BundleResource>(*resource, "BundleResource");
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
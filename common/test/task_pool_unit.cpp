@@ -0,0 +1,171 @@
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <atomic>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/common/task_pool.h>
+
+using namespace tesseract::common;
+
+void runTaskGroupTest(TaskExecutor& executor)
+{
+  std::atomic<int> count{ 0 };
+  TaskGroup group(executor);
+  for (int i = 0; i < 100; ++i)
+    group.run([&count]() { ++count; });
+
+  group.wait();
+  EXPECT_EQ(count, 100);
+  EXPECT_FALSE(group.isCanceled());
+
+  // Exceptions are rethrown by wait and the group can be reused afterwards
+  group.run([]() { throw std::runtime_error("Failed"); });
+  EXPECT_ANY_THROW(group.wait());  // NOLINT
+
+  group.run([&count]() { ++count; });
+  group.wait();
+  EXPECT_EQ(count, 101);
+
+  // Tasks which have not started are skipped when canceled
+  group.cancel();
+  EXPECT_TRUE(group.isCanceled());
+  group.run([&count]() { ++count; });
+  group.wait();
+  EXPECT_EQ(count, 101);
+  EXPECT_FALSE(group.isCanceled());
+}
+
+void runParallelForTest(TaskExecutor& executor)
+{
+  for (std::size_t size : { 0, 1, 7, 1000 })
+  {
+    std::vector<int> values(size, 0);
+    parallelFor(executor, size, [&values](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+        values[i] += static_cast<int>(i);
+    });
+
+    for (std::size_t i = 0; i < size; ++i)
+      EXPECT_EQ(values[i], static_cast<int>(i));
+  }
+
+  // Grain size
+  std::atomic<std::size_t> blocks{ 0 };
+  parallelFor(
+      executor,
+      100,
+      [&blocks](std::size_t begin, std::size_t end) {
+        EXPECT_TRUE(end - begin >= 25 || end == 100);
+        ++blocks;
+      },
+      25);
+  EXPECT_LE(blocks, 4);
+
+  // Exceptions
+  EXPECT_ANY_THROW(parallelFor(executor, 100, [](std::size_t begin, std::size_t /*end*/) {  // NOLINT
+    if (begin == 0)
+      throw std::runtime_error("Failed");
+  }));
+  EXPECT_ANY_THROW(parallelFor(executor, 100, [](std::size_t /*begin*/, std::size_t end) {  // NOLINT
+    if (end == 100)
+      throw std::runtime_error("Failed");
+  }));
+}
+
+TEST(TesseractCommonTaskPoolUnit, SerialTaskExecutor)  // NOLINT
+{
+  SerialTaskExecutor executor;
+  EXPECT_EQ(executor.getThreadCount(), 0);
+  EXPECT_FALSE(executor.runPendingTask());
+
+  int count{ 0 };
+  executor.submit([&count]() { ++count; });
+  EXPECT_EQ(count, 1);
+
+  // Exceptions of tasks which are not part of a group are caught
+  executor.submit([]() { throw std::runtime_error("Failed"); });
+
+  runTaskGroupTest(executor);
+  runParallelForTest(executor);
+}
+
+TEST(TesseractCommonTaskPoolUnit, TaskPool)  // NOLINT
+{
+  for (std::size_t thread_count : { 0, 1, 4 })
+  {
+    TaskPool pool(thread_count);
+    EXPECT_EQ(pool.getThreadCount(), thread_count);
+
+    runTaskGroupTest(pool);
+    runParallelForTest(pool);
+  }
+}
+
+TEST(TesseractCommonTaskPoolUnit, TaskPoolRemainingTasks)  // NOLINT
+{
+  // The destructor executes the remaining tasks
+  std::atomic<int> count{ 0 };
+  {
+    TaskPool pool(2);
+    for (int i = 0; i < 100; ++i)
+      pool.submit([&count]() { ++count; });
+  }
+  EXPECT_EQ(count, 100);
+}
+
+TEST(TesseractCommonTaskPoolUnit, TaskPoolThreads)  // NOLINT
+{
+  TaskPool pool(4);
+  std::mutex mutex;
+  std::set<std::thread::id> thread_ids;
+  parallelFor(pool, 64, [&mutex, &thread_ids](std::size_t /*begin*/, std::size_t /*end*/) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    std::unique_lock<std::mutex> lock(mutex);
+    thread_ids.insert(std::this_thread::get_id());
+  });
+
+  // The calling thread participates
+  EXPECT_GT(thread_ids.size(), 1);
+  EXPECT_TRUE(thread_ids.find(std::this_thread::get_id()) != thread_ids.end());
+}
+
+TEST(TesseractCommonTaskPoolUnit, TaskPoolNested)  // NOLINT
+{
+  // Waiting threads execute pending tasks so nested parallelism does not deadlock
+  TaskPool pool(2);
+  std::atomic<std::size_t> count{ 0 };
+  parallelFor(pool, 16, [&pool, &count](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      parallelFor(pool, 16, [&count](std::size_t inner_begin, std::size_t inner_end) {
+        count += inner_end - inner_begin;
+      });
+    }
+  });
+  EXPECT_EQ(count, 256);
+}
+
+TEST(TesseractCommonTaskPoolUnit, GlobalTaskExecutor)  // NOLINT
+{
+  TaskExecutor& executor = getGlobalTaskExecutor();
+  EXPECT_EQ(&executor, &getGlobalTaskExecutor());
+
+  std::vector<double> values(1000);
+  parallelFor(executor, values.size(), [&values](std::size_t begin, std::size_t end) {
+    std::iota(values.begin() + static_cast<long>(begin), values.begin() + static_cast<long>(end), begin);
+  });
+  EXPECT_DOUBLE_EQ(values.back(), 999);
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
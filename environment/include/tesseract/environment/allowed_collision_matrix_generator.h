@@ -0,0 +1,89 @@
+/**
+ * @file allowed_collision_matrix_generator.h
+ * @brief Generate the allowed collision matrix of a scene graph by sampling random states
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_ALLOWED_COLLISION_MATRIX_GENERATOR_H
+#define TESSERACT_ENVIRONMENT_ALLOWED_COLLISION_MATRIX_GENERATOR_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/common/fwd.h>
+#include <tesseract/common/allowed_collision_matrix.h>
+#include <tesseract/scene_graph/fwd.h>
+#include <tesseract/collision/fwd.h>
+
+namespace tesseract::environment
+{
+/** @brief The configuration used to generate an allowed collision matrix */
+struct AllowedCollisionMatrixGeneratorConfig
+{
+  /** @brief The number of random states sampled to find the links which are always or never in collision */
+  std::size_t sample_count{ 10000 };
+
+  /** @brief The fraction of the sampled states a link pair must be in collision to be considered always in collision */
+  double always_in_collision_fraction{ 0.95 };
+
+  /** @brief The distance below which two links are considered in collision */
+  double contact_distance{ 0 };
+
+  /** @brief Allow collision between links that are adjacent in the kinematic tree */
+  bool disable_adjacent{ true };
+
+  /** @brief Allow collision between links that are in collision in the default state */
+  bool disable_default{ true };
+
+  /** @brief Allow collision between links that are in collision in almost every sampled state */
+  bool disable_always{ true };
+
+  /** @brief Allow collision between links that are not in collision in any sampled state */
+  bool disable_never{ true };
+};
+
+/**
+ * @brief Generate the allowed collision matrix of a scene graph
+ * @details Only links with collision geometry are considered. The link pairs are disabled with the same reasons used
+ * in SRDF files, in the following order:
+ *   - "Adjacent": The links are connected by a joint, links without collision geometry in between are skipped
+ *   - "Default": The links are in collision in the default state of the scene graph
+ *   - "Always": The links are in collision in at least always_in_collision_fraction of the sampled states
+ *   - "Never": The links are not in collision in any of the sampled states
+ *
+ * The random states are sampled like StateSolver::getRandomState() and checked in parallel, every task uses its own
+ * clone of the contact manager. Pairs disabled by an earlier step are not checked by the later steps. Assign the
+ * result to SRDFModel::acm to save it as the disabled collisions of an SRDF file.
+ * @param scene_graph The scene graph
+ * @param manager The contact manager which is cloned, the links of the scene graph which it does not contain are added
+ * @param config The configuration
+ * @param executor The executor used to check the sampled states
+ * @return The allowed collision matrix
+ */
+tesseract::common::AllowedCollisionMatrix
+generateAllowedCollisionMatrix(const tesseract::scene_graph::SceneGraph& scene_graph,
+                               const tesseract::collision::DiscreteContactManager& manager,
+                               const AllowedCollisionMatrixGeneratorConfig& config,
+                               tesseract::common::TaskExecutor& executor);
+
+}  // namespace tesseract::environment
+
+#endif  // TESSERACT_ENVIRONMENT_ALLOWED_COLLISION_MATRIX_GENERATOR_H
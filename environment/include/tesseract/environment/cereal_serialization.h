@@ -3,6 +3,7 @@
 
 #include <tesseract/environment/commands.h>
 #include <tesseract/environment/environment.h>
+#include <tesseract/environment/environment_delta.h>
 
 #include <tesseract/common/cereal_serialization.h>
 #include <tesseract/geometry/cereal_serialization.h>
@@ -58,7 +59,7 @@ void serialize(Archive& ar, AddSceneGraphCommand& obj)
 }
 
 template <class Archive>
-void serialize(Archive& ar, AddTrajectoryLinkCommand& obj)
+void serialize(Archive& ar, AddTrajectoryLinkCommand& obj, const std::uint32_t version)
 {
   ar(cereal::base_class<Command>(&obj));
   ar(cereal::make_nvp("link_name", obj.link_name_));
@@ -66,6 +67,10 @@ void serialize(Archive& ar, AddTrajectoryLinkCommand& obj)
   ar(cereal::make_nvp("trajectory", obj.trajectory_));
   ar(cereal::make_nvp("replace_allowed", obj.replace_allowed_));
   ar(cereal::make_nvp("method", obj.method_));
+
+  // The resolution was added in version 1, older archives keep the default resolution
+  if (version >= 1)
+    ar(cereal::make_nvp("resolution", obj.resolution_));
 }
 
 template <class Archive>
@@ -242,8 +247,21 @@ void serialize(Archive& ar, Environment& obj)
   }
 }
 
+template <class Archive>
+void serialize(Archive& ar, EnvironmentDelta& obj)
+{
+  ar(cereal::make_nvp("from_revision", obj.from_revision));
+  ar(cereal::make_nvp("to_revision", obj.to_revision));
+  ar(cereal::make_nvp("full", obj.full));
+  ar(cereal::make_nvp("commands", obj.commands));
+  ar(cereal::make_nvp("joints", obj.joints));
+  ar(cereal::make_nvp("floating_joints", obj.floating_joints));
+}
+
 }  // namespace tesseract::environment
 
+CEREAL_CLASS_VERSION(tesseract::environment::AddTrajectoryLinkCommand, 1)
+
 // On Windows the cereal polymorphic-type registration must be in the header,
 // for other platforms registration is in the cpp.
 #ifdef _WIN32
@@ -70,6 +70,16 @@ public:
      * into a single convex hull, represented as one unified collision object.
      */
     GLOBAL_CONVEX_HULL,
+
+    /**
+     * @brief Rasterizes the collision geometry of all active links across all trajectory states
+     * into a single octree at the provided resolution, represented as one collision object.
+     * @details Each collision object is approximated by its convex hull and every voxel intersecting it is occupied,
+     * so the result is conservative. Consecutive states with the same joints are interpolated so no hull vertex moves
+     * more than the resolution between samples, which includes the volume swept between the states. A smaller
+     * resolution is more accurate but results in more voxels.
+     */
+    SWEPT_VOLUME_OCTREE,
   };
 
   AddTrajectoryLinkCommand();
@@ -94,18 +104,21 @@ public:
    * @param trajectory The trajectory to used for generating link
    * @param replace_allowed If true then if the link exists it will be replaced, otherwise if false it will fail.
    * @param method Specifies how the trajectory is represented as a collision object in the environment.
+   * @param resolution The voxel size used by Method::SWEPT_VOLUME_OCTREE, otherwise it is ignored.
    */
   AddTrajectoryLinkCommand(std::string link_name,
                            std::string parent_link_name,
                            tesseract::common::JointTrajectory trajectory,
                            bool replace_allowed = false,
-                           Method method = Method::PER_STATE_OBJECTS);
+                           Method method = Method::PER_STATE_OBJECTS,
+                           double resolution = 0.02);
 
   const std::string& getLinkName() const;
   const std::string& getParentLinkName() const;
   const tesseract::common::JointTrajectory& getTrajectory() const;
   bool replaceAllowed() const;
   AddTrajectoryLinkCommand::Method getMethod() const;
+  double getResolution() const;
 
   bool operator==(const AddTrajectoryLinkCommand& rhs) const;
   bool operator!=(const AddTrajectoryLinkCommand& rhs) const;
@@ -116,6 +129,7 @@ private:
   tesseract::common::JointTrajectory trajectory_;
   bool replace_allowed_{ false };
   Method method_{ Method::PER_STATE_OBJECTS };
+  double resolution_{ 0.02 };
 
   template <class Archive>
   friend void ::tesseract::environment::serialize(Archive& ar, AddTrajectoryLinkCommand& obj);
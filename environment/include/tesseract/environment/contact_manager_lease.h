@@ -0,0 +1,109 @@
+/**
+ * @file contact_manager_lease.h
+ * @brief A contact manager leased from the pool of an environment
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_CONTACT_MANAGER_LEASE_H
+#define TESSERACT_ENVIRONMENT_CONTACT_MANAGER_LEASE_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+#include <memory>
+#include <utility>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/collision/fwd.h>
+
+namespace tesseract::environment
+{
+/**
+ * @brief Exclusive access to a contact manager owned by the pool of an environment
+ * @details The manager is returned to the pool when the lease is destroyed or released. The caller may change the
+ * transforms of the active collision objects, these are reset the next time the manager is leased. Any other change
+ * to the manager must be reverted before the lease is released.
+ */
+template <typename ManagerType>
+class ContactManagerLease
+{
+public:
+  ContactManagerLease() = default;
+
+  /**
+   * @brief Create a lease
+   * @param manager The leased manager
+   * @param release_fn The function called when the lease is released
+   */
+  ContactManagerLease(std::shared_ptr<ManagerType> manager, std::function<void()> release_fn)
+    : manager_(std::move(manager)), release_fn_(std::move(release_fn))
+  {
+  }
+
+  ~ContactManagerLease() { release(); }
+  ContactManagerLease(const ContactManagerLease&) = delete;
+  ContactManagerLease& operator=(const ContactManagerLease&) = delete;
+  ContactManagerLease(ContactManagerLease&& other) noexcept
+    : manager_(std::move(other.manager_)), release_fn_(std::move(other.release_fn_))
+  {
+    other.release_fn_ = nullptr;
+  }
+  ContactManagerLease& operator=(ContactManagerLease&& other) noexcept
+  {
+    if (this != &other)
+    {
+      release();
+      manager_ = std::move(other.manager_);
+      release_fn_ = std::move(other.release_fn_);
+      other.release_fn_ = nullptr;
+    }
+    return *this;
+  }
+
+  /** @brief Get the leased manager, nullptr if the lease is empty */
+  ManagerType* get() const { return manager_.get(); }
+  ManagerType& operator*() const { return *manager_; }
+  ManagerType* operator->() const { return manager_.get(); }
+
+  /** @brief Check if the lease holds a manager */
+  explicit operator bool() const { return (manager_ != nullptr); }
+
+  /** @brief Return the manager to the pool, afterwards the lease is empty */
+  void release()
+  {
+    manager_ = nullptr;
+    if (release_fn_)
+    {
+      std::function<void()> release_fn;
+      std::swap(release_fn, release_fn_);
+      release_fn();
+    }
+  }
+
+private:
+  std::shared_ptr<ManagerType> manager_;
+  std::function<void()> release_fn_;
+};
+
+using DiscreteContactManagerLease = ContactManagerLease<tesseract::collision::DiscreteContactManager>;
+using ContinuousContactManagerLease = ContactManagerLease<tesseract::collision::ContinuousContactManager>;
+
+}  // namespace tesseract::environment
+
+#endif  // TESSERACT_ENVIRONMENT_CONTACT_MANAGER_LEASE_H
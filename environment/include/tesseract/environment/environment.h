@@ -44,6 +44,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract/kinematics/fwd.h>
 #include <tesseract/collision/fwd.h>
 #include <tesseract/environment/fwd.h>
+#include <tesseract/environment/contact_manager_lease.h>
 
 #include <filesystem>
 #include <tesseract/common/eigen_types.h>
@@ -596,6 +597,23 @@ public:
   std::unique_ptr<tesseract::collision::ContinuousContactManager>
   getContinuousContactManager(const std::string& name) const;
 
+  /**
+   * @brief Lease a discrete contact manager from the pool of the environment
+   * @details Unlike getDiscreteContactManager() a manager is only cloned if every pooled manager is leased. A pooled
+   * manager is synchronized with the collision objects which changed since it was returned and the transforms of the
+   * current state which changed, plus the transforms of the active links. This is thread safe so each thread of a
+   * planner can hold its own lease.
+   * @return The lease, empty if the active discrete contact manager could not be created
+   */
+  DiscreteContactManagerLease leaseDiscreteContactManager() const;
+
+  /**
+   * @brief Lease a continuous contact manager from the pool of the environment
+   * @details See leaseDiscreteContactManager()
+   * @return The lease, empty if the active continuous contact manager could not be created
+   */
+  ContinuousContactManagerLease leaseContinuousContactManager() const;
+
   /** @brief Get the environment collision margin data */
   tesseract::common::CollisionMarginData getCollisionMarginData() const;
 
@@ -0,0 +1,119 @@
+/**
+ * @file environment_delta.h
+ * @brief Delta synchronization of environments
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_ENVIRONMENT_DELTA_H
+#define TESSERACT_ENVIRONMENT_ENVIRONMENT_DELTA_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/environment/fwd.h>
+#include <tesseract/common/eigen_types.h>
+
+namespace tesseract::environment
+{
+/**
+ * @brief The default maximum number of squashed commands in a delta before a full delta is returned instead
+ * @details A full delta carries the whole scene graph, so it is only cheaper than replaying the squashed commands when
+ * the history since from_revision is long, for example after many links have been added and removed.
+ */
+static constexpr std::size_t ENVIRONMENT_DELTA_MAX_COMMANDS{ 1000 };
+
+/**
+ * @brief The changes required to bring a copy of an environment from one revision to another
+ * @details If full is false the commands are applied on top of a copy which is at from_revision, otherwise the copy is
+ * reinitialized with the commands. In both cases the state is set afterwards.
+ */
+struct EnvironmentDelta
+{
+  /** @brief The revision the delta is computed from */
+  int from_revision{ 0 };
+
+  /** @brief The revision of the source environment when the delta was computed */
+  int to_revision{ 0 };
+
+  /** @brief Indicate if the commands reconstruct the environment instead of being applied on top of from_revision */
+  bool full{ false };
+
+  /** @brief The squashed commands */
+  std::vector<std::shared_ptr<const Command>> commands;
+
+  /** @brief The joint values of the source environment */
+  std::unordered_map<std::string, double> joints;
+
+  /** @brief The floating joint values of the source environment */
+  tesseract::common::TransformMap floating_joints;
+
+  bool operator==(const EnvironmentDelta& rhs) const;
+  bool operator!=(const EnvironmentDelta& rhs) const;
+};
+
+/**
+ * @brief Remove commands which are superseded by a later command
+ * @details The following are squashed, everything else is kept in order:
+ *   - Joint position, velocity and acceleration limits of the same joint
+ *   - Joint origins of the same joint
+ *   - Link collision enabled and link visibility of the same link
+ *   - Active discrete and continuous contact managers
+ *   - Default collision margins and pair collision margins replaced by a later command
+ *
+ * Commands which change the structure of the scene graph (adding, removing or moving links and joints, replacing
+ * joints, adding scene graphs and trajectory links) are barriers, commands are never squashed across them.
+ * @param commands The commands
+ * @return The squashed commands which result in the same environment when applied
+ */
+std::vector<std::shared_ptr<const Command>> squashCommands(const std::vector<std::shared_ptr<const Command>>& commands);
+
+/**
+ * @brief Compute the delta between a revision of the environment and its current revision
+ * @details If the revision is not available in the command history (older than the init revision or newer than the
+ * current revision) or the squashed commands exceed max_commands, a full delta is returned using
+ * getEnvironmentSnapshotCommands() so the cost of applying it does not depend on the length of the history.
+ * @param env The source environment, it must be initialized
+ * @param from_revision The revision of the copy being synchronized
+ * @param max_commands The maximum number of commands before falling back to a full delta, see
+ * ENVIRONMENT_DELTA_MAX_COMMANDS
+ * @return The delta
+ */
+EnvironmentDelta getEnvironmentDelta(const Environment& env,
+                                     int from_revision,
+                                     std::size_t max_commands = ENVIRONMENT_DELTA_MAX_COMMANDS);
+
+/**
+ * @brief Apply a delta to a copy of the environment
+ * @details Because the commands are squashed the revision of the copy does not match to_revision after applying the
+ * delta, the caller should store to_revision and use it as from_revision when requesting the next delta.
+ * @param env The copy of the environment, unless the delta is full it must be at from_revision of the source
+ * @param delta The delta
+ * @return True if successful, otherwise false
+ */
+bool applyEnvironmentDelta(Environment& env, const EnvironmentDelta& delta);
+
+}  // namespace tesseract::environment
+
+#endif  // TESSERACT_ENVIRONMENT_ENVIRONMENT_DELTA_H
@@ -0,0 +1,93 @@
+/**
+ * @file environment_snapshot.h
+ * @brief Binary snapshot of a fully resolved environment
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_ENVIRONMENT_SNAPSHOT_H
+#define TESSERACT_ENVIRONMENT_ENVIRONMENT_SNAPSHOT_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/environment/fwd.h>
+
+namespace tesseract::environment
+{
+/** @brief The version of the environment snapshot format, this is incremented whenever the format changes */
+static constexpr std::uint32_t ENVIRONMENT_SNAPSHOT_VERSION{ 2 };
+
+/**
+ * @brief Get the commands which reconstruct the current configuration of the environment
+ * @details Instead of the command history this contains a single AddSceneGraphCommand with the current scene graph
+ * (links, joints, geometry and allowed collision matrix) followed by the kinematics information, contact manager
+ * plugins, active contact managers and collision margins. Applying these results in the same environment as
+ * replaying the full command history but the history itself is not preserved.
+ * @param env The environment, it must be initialized
+ * @return The commands
+ */
+std::vector<std::shared_ptr<const Command>> getEnvironmentSnapshotCommands(const Environment& env);
+
+/**
+ * @brief Save a binary snapshot of the environment
+ * @details The snapshot contains the commands from getEnvironmentSnapshotCommands(), the resource locator, the name and
+ * the current state. Geometry is stored as vertex and face buffers so loading does not parse any URDF, SRDF or mesh
+ * files.
+ *
+ * The snapshot starts with a header of the identifier "TESSENVS" (8 bytes), the byte order mark 0x01020304 (uint32) and
+ * ENVIRONMENT_SNAPSHOT_VERSION (uint32), followed by a cereal binary archive. The header and the archive use the native
+ * byte order, so a snapshot is only loaded on a host with the same byte order.
+ * @param env The environment, it must be initialized
+ * @return The snapshot data
+ */
+std::vector<std::uint8_t> toEnvironmentSnapshot(const Environment& env);
+
+/**
+ * @brief Save a binary snapshot of the environment to file
+ * @param env The environment, it must be initialized
+ * @param file_path The file path
+ * @return True if successful, otherwise false
+ */
+bool toEnvironmentSnapshotFile(const Environment& env, const std::filesystem::path& file_path);
+
+/**
+ * @brief Load an environment from a binary snapshot
+ * @details This throws if the data is not a snapshot or was created with a different snapshot version or byte order
+ * @param data The snapshot data
+ * @return The environment
+ */
+std::unique_ptr<Environment> fromEnvironmentSnapshot(const std::vector<std::uint8_t>& data);
+
+/**
+ * @brief Load an environment from a binary snapshot file
+ * @details This throws if the file could not be read, is not a snapshot or was created with a different snapshot
+ * version or byte order
+ * @param file_path The file path
+ * @return The environment
+ */
+std::unique_ptr<Environment> fromEnvironmentSnapshotFile(const std::filesystem::path& file_path);
+
+}  // namespace tesseract::environment
+
+#endif  // TESSERACT_ENVIRONMENT_ENVIRONMENT_SNAPSHOT_H
@@ -0,0 +1,221 @@
+/**
+ * @file reachability_map.h
+ * @brief Cartesian reachability map of a kinematic group
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_ENVIRONMENT_REACHABILITY_MAP_H
+#define TESSERACT_ENVIRONMENT_REACHABILITY_MAP_H
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+#include <Eigen/Geometry>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/environment/fwd.h>
+#include <tesseract/common/fwd.h>
+#include <tesseract/common/eigen_types.h>
+
+namespace tesseract::environment
+{
+/** @brief The version of the reachability map format, this is incremented whenever the format changes */
+static constexpr std::uint32_t REACHABILITY_MAP_VERSION{ 1 };
+
+/** @brief The configuration used to create a reachability map */
+struct ReachabilityMapConfig
+{
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  /** @brief The name of the kinematic group */
+  std::string group_name;
+
+  /** @brief The name of the inverse kinematics solver, if empty the default solver of the group is used */
+  std::string ik_solver_name;
+
+  /** @brief The frame the grid and orientations are defined in, if empty the base link of the group is used */
+  std::string working_frame;
+
+  /** @brief The tip link, if empty the first tip link of the inverse kinematics solver is used */
+  std::string tip_link_name;
+
+  /** @brief The minimum corner of the grid, this is the center of the first voxel */
+  Eigen::Vector3d min_position{ -1, -1, -1 };
+
+  /** @brief The maximum corner of the grid, the last voxel is the last one which does not exceed it */
+  Eigen::Vector3d max_position{ 1, 1, 1 };
+
+  /** @brief The size of a voxel */
+  double resolution{ 0.1 };
+
+  /** @brief The orientations of the tip link sampled at every voxel, see generateReachabilityOrientations() */
+  tesseract::common::AlignedVector<Eigen::Quaterniond> orientations;
+
+  /** @brief Indicate if solutions are checked for collision using the active discrete contact manager */
+  bool check_collision{ false };
+};
+
+/**
+ * @brief A dense map of inverse kinematics results over a voxel grid and a set of orientations
+ * @details For every voxel and orientation the number of valid solutions and the best manipulability (volume of the
+ * velocity manipulability ellipsoid) of the valid solutions is stored. Poses are relative to the working frame.
+ */
+class ReachabilityMap
+{
+public:
+  // LCOV_EXCL_START
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+  // LCOV_EXCL_STOP
+
+  ReachabilityMap() = default;
+
+  /**
+   * @brief Create an empty map
+   * @param working_frame The frame the grid and orientations are defined in
+   * @param tip_link_name The tip link
+   * @param min_position The center of the first voxel
+   * @param resolution The size of a voxel
+   * @param dimensions The number of voxels along each axis
+   * @param orientations The orientations sampled at every voxel
+   */
+  ReachabilityMap(std::string working_frame,
+                  std::string tip_link_name,
+                  const Eigen::Vector3d& min_position,
+                  double resolution,
+                  const std::array<std::size_t, 3>& dimensions,
+                  tesseract::common::AlignedVector<Eigen::Quaterniond> orientations);
+
+  const std::string& getWorkingFrame() const;
+  const std::string& getTipLinkName() const;
+  const Eigen::Vector3d& getMinPosition() const;
+  double getResolution() const;
+  const std::array<std::size_t, 3>& getDimensions() const;
+  const tesseract::common::AlignedVector<Eigen::Quaterniond>& getOrientations() const;
+
+  /** @brief Get the number of voxels */
+  std::size_t getVoxelCount() const;
+
+  /** @brief Get the number of orientations sampled at every voxel */
+  std::size_t getOrientationCount() const;
+
+  /** @brief Get the index of a voxel from its grid coordinates */
+  std::size_t getVoxelIndex(std::size_t x, std::size_t y, std::size_t z) const;
+
+  /**
+   * @brief Find the voxel containing a position
+   * @param position The position relative to the working frame
+   * @return The index of the voxel, empty if the position is outside of the grid
+   */
+  std::optional<std::size_t> findVoxel(const Eigen::Vector3d& position) const;
+
+  /** @brief Find the orientation with the smallest angular distance to a rotation */
+  std::size_t findOrientation(const Eigen::Quaterniond& orientation) const;
+
+  /** @brief Get the center of a voxel relative to the working frame */
+  Eigen::Vector3d getVoxelCenter(std::size_t voxel) const;
+
+  /** @brief Get the number of valid solutions of a voxel and orientation */
+  std::uint16_t getSolutionCount(std::size_t voxel, std::size_t orientation) const;
+
+  /** @brief Get the best manipulability of the valid solutions of a voxel and orientation, zero if unreachable */
+  float getManipulability(std::size_t voxel, std::size_t orientation) const;
+
+  /** @brief Set the result of a voxel and orientation */
+  void setResult(std::size_t voxel, std::size_t orientation, std::uint16_t solution_count, float manipulability);
+
+  /** @brief Get the fraction of orientations of a voxel which have a valid solution */
+  double getReachability(std::size_t voxel) const;
+
+  /**
+   * @brief Check if a pose is reachable using the nearest voxel and orientation
+   * @param pose The pose of the tip link relative to the working frame
+   * @return True if the nearest voxel and orientation has a valid solution, false if not or outside of the grid
+   */
+  bool isReachable(const Eigen::Isometry3d& pose) const;
+
+  /**
+   * @brief Save the map in a compact binary format
+   * @details The data is written in the byte order of the machine
+   * @param file_path The file path
+   * @return True if successful, otherwise false
+   */
+  bool saveFile(const std::filesystem::path& file_path) const;
+
+  /**
+   * @brief Load a map saved with saveFile()
+   * @details This throws if the file could not be read, is not a reachability map or was created with a different
+   * version
+   * @param file_path The file path
+   * @return The map
+   */
+  static ReachabilityMap loadFile(const std::filesystem::path& file_path);
+
+  bool operator==(const ReachabilityMap& rhs) const;
+  bool operator!=(const ReachabilityMap& rhs) const;
+
+private:
+  std::string working_frame_;
+  std::string tip_link_name_;
+  Eigen::Vector3d min_position_{ Eigen::Vector3d::Zero() };
+  double resolution_{ 0 };
+  std::array<std::size_t, 3> dimensions_{ 0, 0, 0 };
+  tesseract::common::AlignedVector<Eigen::Quaterniond> orientations_;
+
+  /** @brief The number of valid solutions indexed by voxel * orientation count + orientation */
+  std::vector<std::uint16_t> solution_counts_;
+
+  /** @brief The best manipulability indexed by voxel * orientation count + orientation */
+  std::vector<float> manipulability_;
+};
+
+/**
+ * @brief Generate a set of orientations which are approximately uniformly distributed
+ * @details The z-axis of the orientations is distributed over the sphere using a Fibonacci lattice and each one is
+ * rotated about its z-axis in equal steps.
+ * @param approach_count The number of z-axis directions
+ * @param rotation_count The number of rotations about each z-axis
+ * @return The orientations
+ */
+tesseract::common::AlignedVector<Eigen::Quaterniond> generateReachabilityOrientations(std::size_t approach_count,
+                                                                                      std::size_t rotation_count = 1);
+
+/**
+ * @brief Create the reachability map of a kinematic group
+ * @details Inverse kinematics is solved for every voxel and orientation in parallel, each task uses its own copy of
+ * the kinematic group and leases a contact manager from the environment when collision checking is enabled. The seed
+ * is the current state of the environment and the other links remain in the current state.
+ * @param env The environment
+ * @param config The configuration
+ * @param executor The executor used to run the tasks
+ * @return The reachability map
+ */
+ReachabilityMap createReachabilityMap(const Environment& env,
+                                      const ReachabilityMapConfig& config,
+                                      tesseract::common::TaskExecutor& executor);
+
+}  // namespace tesseract::environment
+
+#endif  // TESSERACT_ENVIRONMENT_REACHABILITY_MAP_H
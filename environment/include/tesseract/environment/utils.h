@@ -26,7 +26,11 @@
 
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstddef>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -34,11 +38,19 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract/collision/fwd.h>
 #include <tesseract/state_solver/fwd.h>
 #include <tesseract/kinematics/fwd.h>
+#include <tesseract/common/fwd.h>
 
 #include <tesseract/common/eigen_types.h>
 
 namespace tesseract::environment
 {
+/**
+ * @brief The Cartesian motion bounds of each link, per unit motion of each joint
+ * @details For a joint space motion dq the Cartesian motion of every point on the links collision geometry is bounded
+ * by bounds.dot(dq.cwiseAbs()). Links which are not moved by the joints are not included.
+ */
+using LinkMotionBounds = std::unordered_map<std::string, Eigen::VectorXd>;
+
 /**
  * @brief Get the active Link Names Recursively
  *
@@ -55,6 +67,19 @@ void getActiveLinkNamesRecursive(std::vector<std::string>& active_links,
                                  const std::string& current_link,
                                  bool active);
 
+/**
+ * @brief Calculate the Cartesian motion bounds of the links moved by the provided joints
+ * @details The bounds are derived from the extents of the kinematic chain, so they are valid for any configuration. For
+ * a revolute joint the bound is the distance from the joint origin to the farthest point of the links collision
+ * geometry assuming every joint in between is fully extended. For a prismatic joint the bound is one. Mimic joints are
+ * accounted for in the bounds of the joint they mimic.
+ * @param scene_graph The scene graph
+ * @param joint_names The joint names corresponding to the trajectory values (must be in same order)
+ * @return The motion bounds for every link with collision geometry moved by the joints
+ */
+LinkMotionBounds calcLinkMotionBounds(const tesseract::scene_graph::SceneGraph& scene_graph,
+                                      const std::vector<std::string>& joint_names);
+
 /**
  * @brief Should perform a continuous collision check between two states only passing along the contact_request to the
  * manager
@@ -130,6 +155,52 @@ checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
                 const tesseract::common::TrajArray& traj,
                 const tesseract::collision::CollisionCheckConfig& config);
 
+/**
+ * @brief The clones of a discrete contact manager used by checkTrajectory
+ * @details The parallel checkTrajectory uses a clone per task and ADAPTIVE_LVS_DISCRETE checks the extended collision
+ * margins on a clone. Keeping the pool between calls means the clones are created once instead of for every
+ * trajectory. The clones are made from the manager passed to checkTrajectory and only the transforms of its active
+ * collision objects are changed, so the pool must be cleared when anything else in the manager changes, like its
+ * collision objects, the transforms of the other objects or the collision margins. This is thread safe.
+ */
+class DiscreteContactManagerPool
+{
+public:
+  using Ptr = std::shared_ptr<DiscreteContactManagerPool>;
+  using ConstPtr = std::shared_ptr<const DiscreteContactManagerPool>;
+
+  DiscreteContactManagerPool();
+  ~DiscreteContactManagerPool();
+  DiscreteContactManagerPool(const DiscreteContactManagerPool&) = delete;
+  DiscreteContactManagerPool& operator=(const DiscreteContactManagerPool&) = delete;
+  DiscreteContactManagerPool(DiscreteContactManagerPool&&) = delete;
+  DiscreteContactManagerPool& operator=(DiscreteContactManagerPool&&) = delete;
+
+  /**
+   * @brief Get a clone from the pool
+   * @param manager The manager which is cloned if the pool has no clone of a manager with the same name
+   * @return The clone
+   */
+  std::unique_ptr<tesseract::collision::DiscreteContactManager>
+  acquire(const tesseract::collision::DiscreteContactManager& manager);
+
+  /**
+   * @brief Return a clone to the pool
+   * @param clone The clone
+   */
+  void release(std::unique_ptr<tesseract::collision::DiscreteContactManager> clone);
+
+  /** @brief Remove all clones */
+  void clear();
+
+  /** @brief Get the number of clones in the pool, clones which are acquired are not counted */
+  std::size_t size() const;
+
+private:
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<tesseract::collision::DiscreteContactManager>> clones_;
+};
+
 /**
  * @brief Should perform a discrete collision check over the trajectory and stop on first collision.
  * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory, except the last
@@ -139,6 +210,10 @@ checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
  * @param joint_names JointNames corresponding to the values in traj (must be in same order)
  * @param traj The joint values at each time step
  * @param config CollisionCheckConfig used to specify collision check settings
+ * @param link_motion_bounds The link motion bounds used by ADAPTIVE_LVS_DISCRETE, see calcLinkMotionBounds. If empty
+ * ADAPTIVE_LVS_DISCRETE checks every substep like LVS_DISCRETE.
+ * @param pool The clones of the manager kept between calls, if nullptr the clone used by ADAPTIVE_LVS_DISCRETE is only
+ * used for this call
  * @return ContactTrajectoryResults containing contact step/substep locations and joint values.
  */
 tesseract::collision::ContactTrajectoryResults
@@ -147,7 +222,9 @@ checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
                 const tesseract::scene_graph::StateSolver& state_solver,
                 const std::vector<std::string>& joint_names,
                 const tesseract::common::TrajArray& traj,
-                const tesseract::collision::CollisionCheckConfig& config);
+                const tesseract::collision::CollisionCheckConfig& config,
+                const LinkMotionBounds& link_motion_bounds = {},
+                DiscreteContactManagerPool* pool = nullptr);
 
 /**
  * @brief Should perform a discrete collision check over the trajectory and stop on first collision.
@@ -157,6 +234,10 @@ checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
  * @param manip The kinematic joint group
  * @param traj The joint values at each time step
  * @param config CollisionCheckConfig used to specify collision check settings
+ * @param link_motion_bounds The link motion bounds used by ADAPTIVE_LVS_DISCRETE, see calcLinkMotionBounds. If empty
+ * ADAPTIVE_LVS_DISCRETE checks every substep like LVS_DISCRETE.
+ * @param pool The clones of the manager kept between calls, if nullptr the clone used by ADAPTIVE_LVS_DISCRETE is only
+ * used for this call
  * @return ContactTrajectoryResults containing contact step/substep locations and joint values.
  */
 tesseract::collision::ContactTrajectoryResults
@@ -164,7 +245,65 @@ checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
                 tesseract::collision::DiscreteContactManager& manager,
                 const tesseract::kinematics::JointGroup& manip,
                 const tesseract::common::TrajArray& traj,
-                const tesseract::collision::CollisionCheckConfig& config);
+                const tesseract::collision::CollisionCheckConfig& config,
+                const LinkMotionBounds& link_motion_bounds = {},
+                DiscreteContactManagerPool* pool = nullptr);
+
+/**
+ * @brief Perform a discrete collision check over the trajectory in parallel
+ * @details The states, or the segments for LVS_DISCRETE and ADAPTIVE_LVS_DISCRETE, are checked in parallel, each task
+ * using a clone of the contact manager. Clones are pooled so at most one is created per concurrently running task, and
+ * a DiscreteContactManagerPool passed by the caller keeps them for the next call. The results are identical to the
+ * serial checkTrajectory, if the exit condition is FIRST the states after the first collision are canceled. If the
+ * executor has no worker threads or the trajectory has less than three states the serial checkTrajectory is used.
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory, except the last
+ * which is the end state. The length should be the same size as the input trajectory.
+ * @param manager A discrete contact manager, it is only cloned and not modified unless the serial check is used
+ * @param state_solver The environment state solver
+ * @param joint_names JointNames corresponding to the values in traj (must be in same order)
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param executor The executor used to run the tasks
+ * @param link_motion_bounds The link motion bounds used by ADAPTIVE_LVS_DISCRETE, see calcLinkMotionBounds. If empty
+ * ADAPTIVE_LVS_DISCRETE checks every substep like LVS_DISCRETE.
+ * @param pool The clones of the manager kept between calls, if nullptr the clones are only used for this call
+ * @return ContactTrajectoryResults containing contact step/substep locations and joint values.
+ */
+tesseract::collision::ContactTrajectoryResults
+checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
+                tesseract::collision::DiscreteContactManager& manager,
+                const tesseract::scene_graph::StateSolver& state_solver,
+                const std::vector<std::string>& joint_names,
+                const tesseract::common::TrajArray& traj,
+                const tesseract::collision::CollisionCheckConfig& config,
+                tesseract::common::TaskExecutor& executor,
+                const LinkMotionBounds& link_motion_bounds = {},
+                DiscreteContactManagerPool* pool = nullptr);
+
+/**
+ * @brief Perform a discrete collision check over the trajectory in parallel
+ * @details See the state solver overload for details
+ * @param contacts A vector of ContactMap where each index corresponds to a segment in the trajectory, except the last
+ * which is the end state. The length should be the same size as the input trajectory.
+ * @param manager A discrete contact manager, it is only cloned and not modified unless the serial check is used
+ * @param manip The kinematic joint group
+ * @param traj The joint values at each time step
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param executor The executor used to run the tasks
+ * @param link_motion_bounds The link motion bounds used by ADAPTIVE_LVS_DISCRETE, see calcLinkMotionBounds. If empty
+ * ADAPTIVE_LVS_DISCRETE checks every substep like LVS_DISCRETE.
+ * @param pool The clones of the manager kept between calls, if nullptr the clones are only used for this call
+ * @return ContactTrajectoryResults containing contact step/substep locations and joint values.
+ */
+tesseract::collision::ContactTrajectoryResults
+checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
+                tesseract::collision::DiscreteContactManager& manager,
+                const tesseract::kinematics::JointGroup& manip,
+                const tesseract::common::TrajArray& traj,
+                const tesseract::collision::CollisionCheckConfig& config,
+                tesseract::common::TaskExecutor& executor,
+                const LinkMotionBounds& link_motion_bounds = {},
+                DiscreteContactManagerPool* pool = nullptr);
 
 }  // namespace tesseract::environment
 #endif  // TESSERACT_ENVIRONMENT_CORE_UTILS_H
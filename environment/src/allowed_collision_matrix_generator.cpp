@@ -0,0 +1,209 @@
+/**
+ * @file allowed_collision_matrix_generator.cpp
+ * @brief Generate the allowed collision matrix of a scene graph by sampling random states
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/environment/allowed_collision_matrix_generator.h>
+#include <tesseract/scene_graph/graph.h>
+#include <tesseract/scene_graph/link.h>
+#include <tesseract/scene_graph/joint.h>
+#include <tesseract/scene_graph/scene_state.h>
+#include <tesseract/state_solver/ofkt/ofkt_state_solver.h>
+#include <tesseract/collision/discrete_contact_manager.h>
+#include <tesseract/collision/types.h>
+#include <tesseract/common/contact_allowed_validator.h>
+#include <tesseract/common/collision_margin_data.h>
+#include <tesseract/common/kinematic_limits.h>
+#include <tesseract/common/task_pool.h>
+#include <tesseract/common/utils.h>
+
+namespace tesseract::environment
+{
+namespace
+{
+using LinkPairCounts = std::unordered_map<tesseract::common::LinkNamesPair, std::size_t>;
+
+/**
+ * @brief Add the link pairs in collision to the allowed collision matrix
+ * @param acm The allowed collision matrix
+ * @param results The contact results
+ * @param reason The reason
+ */
+void addAllowedCollisions(tesseract::common::AllowedCollisionMatrix& acm,
+                          const tesseract::collision::ContactResultMap& results,
+                          const std::string& reason)
+{
+  for (const auto& pair : results)
+  {
+    if (!pair.second.empty())
+      acm.addAllowedCollision(pair.first.first, pair.first.second, reason);
+  }
+}
+}  // namespace
+
+tesseract::common::AllowedCollisionMatrix
+generateAllowedCollisionMatrix(const tesseract::scene_graph::SceneGraph& scene_graph,
+                               const tesseract::collision::DiscreteContactManager& manager,
+                               const AllowedCollisionMatrixGeneratorConfig& config,
+                               tesseract::common::TaskExecutor& executor)
+{
+  if (config.always_in_collision_fraction <= 0 || config.always_in_collision_fraction > 1)
+    throw std::runtime_error("generateAllowedCollisionMatrix: The always in collision fraction must be in (0, 1]!");
+
+  std::vector<std::string> link_names;
+  for (const auto& link : scene_graph.getLinks())
+  {
+    if (!link->collision.empty())
+      link_names.push_back(link->getName());
+  }
+  std::sort(link_names.begin(), link_names.end());
+
+  tesseract::common::AllowedCollisionMatrix acm;
+  if (config.disable_adjacent)
+  {
+    const std::size_t link_count = scene_graph.getLinks().size();
+    for (const auto& link_name : link_names)
+    {
+      // Walk up through links without collision geometry, the count guards against cycles
+      std::string parent_link_name = link_name;
+      for (std::size_t i = 0; i < link_count; ++i)
+      {
+        const auto joints = scene_graph.getInboundJoints(parent_link_name);
+        if (joints.empty())
+          break;
+
+        parent_link_name = joints.front()->parent_link_name;
+        if (!scene_graph.getLink(parent_link_name)->collision.empty())
+        {
+          if (parent_link_name != link_name)
+            acm.addAllowedCollision(link_name, parent_link_name, "Adjacent");
+          break;
+        }
+      }
+    }
+  }
+
+  tesseract::collision::DiscreteContactManager::UPtr prototype = manager.clone();
+  for (const auto& link_name : link_names)
+  {
+    if (prototype->hasCollisionObject(link_name))
+    {
+      prototype->enableCollisionObject(link_name);
+      continue;
+    }
+
+    const auto link = scene_graph.getLink(link_name);
+    tesseract::collision::CollisionShapesConst shapes;
+    tesseract::common::VectorIsometry3d shape_poses;
+    for (const auto& collision : link->collision)
+    {
+      shapes.push_back(collision->geometry);
+      shape_poses.push_back(collision->origin);
+    }
+    prototype->addCollisionObject(link_name, 0, shapes, shape_poses, true);
+  }
+  prototype->setActiveCollisionObjects(link_names);
+  prototype->setCollisionMarginData(tesseract::common::CollisionMarginData(config.contact_distance));
+  prototype->setContactAllowedValidator(std::make_shared<tesseract::common::ACMContactAllowedValidator>(acm));
+
+  // Only the existence of a contact is needed
+  tesseract::collision::ContactRequest request(tesseract::collision::ContactTestType::CLOSEST);
+  request.calculate_penetration = false;
+  request.calculate_distance = false;
+
+  tesseract::scene_graph::OFKTStateSolver state_solver(scene_graph);
+  if (config.disable_default)
+  {
+    tesseract::collision::ContactResultMap results;
+    prototype->setCollisionObjectsTransform(state_solver.getState().link_transforms);
+    prototype->contactTest(results, request);
+    addAllowedCollisions(acm, results, "Default");
+    prototype->setContactAllowedValidator(std::make_shared<tesseract::common::ACMContactAllowedValidator>(acm));
+  }
+
+  if ((!config.disable_always && !config.disable_never) || config.sample_count == 0)
+    return acm;
+
+  const std::vector<std::string> joint_names = state_solver.getActiveJointNames();
+  const Eigen::MatrixX2d joint_limits = state_solver.getLimits().joint_limits;
+
+  std::mutex mutex;
+  LinkPairCounts counts;
+  auto check_samples = [&](std::size_t begin, std::size_t end) {
+    tesseract::collision::DiscreteContactManager::UPtr contact_manager = prototype->clone();
+    tesseract::collision::ContactResultMap results;
+    LinkPairCounts block_counts;
+    Eigen::VectorXd joint_values;
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      {  // The random number generator is shared, so only drawing the joint values is serialized
+        std::unique_lock<std::mutex> lock(mutex);
+        joint_values = tesseract::common::generateRandomNumber(joint_limits);
+      }
+
+      contact_manager->setCollisionObjectsTransform(state_solver.getState(joint_names, joint_values).link_transforms);
+      results.clear();
+      contact_manager->contactTest(results, request);
+      for (const auto& pair : results)
+      {
+        if (!pair.second.empty())
+          ++block_counts[pair.first];
+      }
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    for (const auto& count : block_counts)
+      counts[count.first] += count.second;
+  };
+  tesseract::common::parallelFor(executor, config.sample_count, check_samples, 16);
+
+  const double always_threshold = config.always_in_collision_fraction * static_cast<double>(config.sample_count);
+  const auto always_count = static_cast<std::size_t>(std::ceil(always_threshold));
+  tesseract::common::LinkNamesPair key;
+  for (std::size_t i = 0; i < link_names.size(); ++i)
+  {
+    for (std::size_t j = i + 1; j < link_names.size(); ++j)
+    {
+      if (acm.isCollisionAllowed(link_names[i], link_names[j]))
+        continue;
+
+      tesseract::common::makeOrderedLinkPair(key, link_names[i], link_names[j]);
+      auto found = counts.find(key);
+      const std::size_t count = (found == counts.end()) ? 0 : found->second;
+      if (config.disable_never && count == 0)
+        acm.addAllowedCollision(link_names[i], link_names[j], "Never");
+      else if (config.disable_always && count >= always_count)
+        acm.addAllowedCollision(link_names[i], link_names[j], "Always");
+    }
+  }
+
+  return acm;
+}
+
+}  // namespace tesseract::environment
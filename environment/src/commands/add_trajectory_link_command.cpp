@@ -35,13 +35,15 @@ AddTrajectoryLinkCommand::AddTrajectoryLinkCommand(std::string link_name,
                                                    std::string parent_link_name,
                                                    tesseract::common::JointTrajectory trajectory,
                                                    bool replace_allowed,
-                                                   Method method)
+                                                   Method method,
+                                                   double resolution)
   : Command(CommandType::ADD_TRAJECTORY_LINK)
   , link_name_(std::move(link_name))
   , parent_link_name_(std::move(parent_link_name))
   , trajectory_(std::move(trajectory))
   , replace_allowed_(replace_allowed)
   , method_(method)
+  , resolution_(resolution)
 {
 }
 
@@ -50,6 +52,7 @@ const std::string& AddTrajectoryLinkCommand::getParentLinkName() const { return
 const tesseract::common::JointTrajectory& AddTrajectoryLinkCommand::getTrajectory() const { return trajectory_; }
 bool AddTrajectoryLinkCommand::replaceAllowed() const { return replace_allowed_; }
 AddTrajectoryLinkCommand::Method AddTrajectoryLinkCommand::getMethod() const { return method_; }
+double AddTrajectoryLinkCommand::getResolution() const { return resolution_; }
 
 bool AddTrajectoryLinkCommand::operator==(const AddTrajectoryLinkCommand& rhs) const
 {
@@ -60,6 +63,7 @@ bool AddTrajectoryLinkCommand::operator==(const AddTrajectoryLinkCommand& rhs) c
   equal &= (trajectory_ == rhs.trajectory_);
   equal &= (replace_allowed_ == rhs.replace_allowed_);
   equal &= (method_ == rhs.method_);
+  equal &= tesseract::common::almostEqualRelativeAndAbs(resolution_, rhs.resolution_);
   return equal;
 }
 bool AddTrajectoryLinkCommand::operator!=(const AddTrajectoryLinkCommand& rhs) const { return !operator==(rhs); }
@@ -0,0 +1,145 @@
+/**
+ * @file create_allowed_collision_matrix.cpp
+ * @brief Generate the allowed collision matrix of a URDF and save it as an SRDF
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/environment/allowed_collision_matrix_generator.h>
+#include <tesseract/scene_graph/graph.h>
+#include <tesseract/urdf/urdf_parser.h>
+#include <tesseract/srdf/srdf_model.h>
+#include <tesseract/collision/bullet/bullet_discrete_bvh_manager.h>
+#include <tesseract/common/resource_locator.h>
+#include <tesseract/common/task_pool.h>
+
+namespace
+{
+const size_t ERROR_IN_COMMAND_LINE = 1;
+const size_t SUCCESS = 0;
+const size_t ERROR_UNHANDLED_EXCEPTION = 2;
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::string urdf;
+  std::string srdf;
+  std::string output;
+  tesseract::environment::AllowedCollisionMatrixGeneratorConfig config;
+  std::size_t thread_count{ std::thread::hardware_concurrency() };
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help,h", "Print help messages")(
+      "urdf,u", po::value<std::string>(&urdf)->required(), "File path or package url of the URDF.")(
+      "srdf,s", po::value<std::string>(&srdf), "File path or package url of an SRDF to update.")(
+      "output,o", po::value<std::string>(&output)->required(), "File path to save the SRDF.")(
+      "samples,n", po::value<std::size_t>(&config.sample_count), "The number of random states to sample.")(
+      "always", po::value<double>(&config.always_in_collision_fraction), "The fraction of samples considered always.")(
+      "distance,d", po::value<double>(&config.contact_distance), "The distance considered in collision.")(
+      "threads,t", po::value<std::size_t>(&thread_count), "The number of worker threads.");
+
+  po::variables_map vm;
+  try
+  {
+    po::store(po::parse_command_line(argc, argv, desc), vm);  // can throw
+
+    /** --help option */
+    if (vm.count("help") != 0U)
+    {
+      std::cout << "Basic Command Line Parameter App\n" << desc << "\n";
+      return SUCCESS;
+    }
+
+    po::notify(vm);  // throws on error, so do after help in case
+                     // there are any problems
+  }
+  catch (po::error& e)
+  {
+    std::cerr << "ERROR: " << e.what() << "\n\n";
+    std::cerr << desc << "\n";
+    return ERROR_IN_COMMAND_LINE;
+  }
+
+  // The resource locator only handles urls and absolute paths
+  auto to_url = [](const std::string& path) {
+    return (path.find("://") == std::string::npos) ? std::filesystem::absolute(path).string() : path;
+  };
+
+  tesseract::common::GeneralResourceLocator locator;
+  auto urdf_resource = locator.locateResource(to_url(urdf));
+  if (urdf_resource == nullptr)
+  {
+    CONSOLE_BRIDGE_logError("Failed to locate the URDF!");
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  try
+  {
+    auto scene_graph = tesseract::urdf::parseURDFFile(urdf_resource->getFilePath(), locator);
+
+    tesseract::srdf::SRDFModel srdf_model;
+    srdf_model.name = scene_graph->getName();
+    if (!srdf.empty())
+    {
+      auto srdf_resource = locator.locateResource(to_url(srdf));
+      if (srdf_resource == nullptr)
+      {
+        CONSOLE_BRIDGE_logError("Failed to locate the SRDF!");
+        return ERROR_UNHANDLED_EXCEPTION;
+      }
+
+      srdf_model.initFile(*scene_graph, srdf_resource->getFilePath(), locator);
+    }
+
+    tesseract::collision::BulletDiscreteBVHManager manager;
+    tesseract::common::TaskPool executor(thread_count);
+    const auto start = std::chrono::steady_clock::now();
+    tesseract::common::AllowedCollisionMatrix acm =
+        tesseract::environment::generateAllowedCollisionMatrix(*scene_graph, manager, config, executor);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Generated " << acm.getAllAllowedCollisions().size() << " disabled collisions from "
+              << config.sample_count << " samples in " << elapsed.count() << " seconds\n";
+
+    srdf_model.acm.insertAllowedCollisionMatrix(acm);
+    if (!srdf_model.saveToFile(output))
+    {
+      CONSOLE_BRIDGE_logError("Failed to write SRDF to file!");
+      return ERROR_UNHANDLED_EXCEPTION;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("Failed to create allowed collision matrix: %s", e.what());
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  return 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file create_reachability_map.cpp
+ * @brief This loads a URDF and SRDF and generates the reachability map of a kinematic group
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/environment/environment.h>
+#include <tesseract/environment/reachability_map.h>
+#include <tesseract/common/resource_locator.h>
+#include <tesseract/common/task_pool.h>
+
+namespace
+{
+const size_t ERROR_IN_COMMAND_LINE = 1;
+const size_t SUCCESS = 0;
+const size_t ERROR_UNHANDLED_EXCEPTION = 2;
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::string urdf;
+  std::string srdf;
+  std::string output;
+  tesseract::environment::ReachabilityMapConfig config;
+  std::vector<double> min_position{ -1, -1, -1 };
+  std::vector<double> max_position{ 1, 1, 1 };
+  std::size_t approach_count{ 32 };
+  std::size_t rotation_count{ 4 };
+  std::size_t thread_count{ std::thread::hardware_concurrency() };
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help,h", "Print help messages")(
+      "urdf,u", po::value<std::string>(&urdf)->required(), "File path or package url of the URDF.")(
+      "srdf,s", po::value<std::string>(&srdf)->required(), "File path or package url of the SRDF.")(
+      "group,g", po::value<std::string>(&config.group_name)->required(), "The name of the kinematic group.")(
+      "output,o", po::value<std::string>(&output)->required(), "File path to save the reachability map.")(
+      "ik-solver", po::value<std::string>(&config.ik_solver_name), "The inverse kinematics solver, default of group.")(
+      "working-frame", po::value<std::string>(&config.working_frame), "The grid frame, base link of the group.")(
+      "tip-link", po::value<std::string>(&config.tip_link_name), "The tip link, first tip link of the solver.")(
+      "min", po::value<std::vector<double>>(&min_position)->multitoken(), "The minimum corner of the grid (x y z).")(
+      "max", po::value<std::vector<double>>(&max_position)->multitoken(), "The maximum corner of the grid (x y z).")(
+      "resolution,r", po::value<double>(&config.resolution), "The size of a voxel.")(
+      "approaches", po::value<std::size_t>(&approach_count), "The number of tool z-axis directions per voxel.")(
+      "rotations", po::value<std::size_t>(&rotation_count), "The number of rotations about each tool z-axis.")(
+      "collision,c", po::bool_switch(&config.check_collision), "Check the solutions for collision.")(
+      "threads,t", po::value<std::size_t>(&thread_count), "The number of worker threads.");
+
+  po::variables_map vm;
+  try
+  {
+    po::store(po::parse_command_line(argc, argv, desc), vm);  // can throw
+
+    /** --help option */
+    if (vm.count("help") != 0U)
+    {
+      std::cout << "Basic Command Line Parameter App\n" << desc << "\n";
+      return SUCCESS;
+    }
+
+    po::notify(vm);  // throws on error, so do after help in case
+                     // there are any problems
+
+    if (min_position.size() != 3 || max_position.size() != 3)
+      throw po::error("The min and max positions require three values");
+  }
+  catch (po::error& e)
+  {
+    std::cerr << "ERROR: " << e.what() << "\n\n";
+    std::cerr << desc << "\n";
+    return ERROR_IN_COMMAND_LINE;
+  }
+
+  // The resource locator only handles urls and absolute paths
+  auto to_url = [](const std::string& path) {
+    return (path.find("://") == std::string::npos) ? std::filesystem::absolute(path).string() : path;
+  };
+
+  auto locator = std::make_shared<tesseract::common::GeneralResourceLocator>();
+  auto urdf_resource = locator->locateResource(to_url(urdf));
+  auto srdf_resource = locator->locateResource(to_url(srdf));
+  if (urdf_resource == nullptr || srdf_resource == nullptr)
+  {
+    CONSOLE_BRIDGE_logError("Failed to locate the URDF or SRDF!");
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  tesseract::environment::Environment env;
+  if (!env.init(urdf_resource->getFilePath(), srdf_resource->getFilePath(), locator))
+  {
+    CONSOLE_BRIDGE_logError("Failed to initialize the environment!");
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  config.min_position = Eigen::Vector3d(min_position[0], min_position[1], min_position[2]);
+  config.max_position = Eigen::Vector3d(max_position[0], max_position[1], max_position[2]);
+  config.orientations = tesseract::environment::generateReachabilityOrientations(approach_count, rotation_count);
+
+  try
+  {
+    tesseract::common::TaskPool executor(thread_count);
+    const auto start = std::chrono::steady_clock::now();
+    tesseract::environment::ReachabilityMap map = tesseract::environment::createReachabilityMap(env, config, executor);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::size_t reachable{ 0 };
+    for (std::size_t i = 0; i < map.getVoxelCount(); ++i)
+      reachable += (map.getReachability(i) > 0) ? 1 : 0;
+
+    std::cout << "Generated " << map.getVoxelCount() << " voxels with " << map.getOrientationCount()
+              << " orientations in " << elapsed.count() << " seconds, " << reachable << " voxels are reachable\n";
+
+    if (!map.saveFile(output))
+    {
+      CONSOLE_BRIDGE_logError("Failed to write reachability map to file!");
+      return ERROR_UNHANDLED_EXCEPTION;
+    }
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("Failed to create reachability map: %s", e.what());
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  return 0;
+}
@@ -29,6 +29,7 @@
 #include <tesseract/environment/commands.h>
 
 #include <tesseract/geometry/utils.h>
+#include <tesseract/geometry/impl/octree.h>
 
 #include <tesseract/scene_graph/graph.h>
 #include <tesseract/scene_graph/link.h>
@@ -62,9 +63,14 @@
 
 #include <tesseract/collision/contact_managers_plugin_factory.h>
 #include <tesseract/common/collision_margin_data.h>
+#include <tesseract/common/task_pool.h>
 
 #include <console_bridge/console.h>
+#include <octomap/OcTree.h>
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 namespace tesseract::environment
@@ -91,6 +97,203 @@ void getCollisionObject(std::vector<std::shared_ptr<const tesseract::geometry::G
   }
 }
 
+/** @brief A convex region of a collision object used to rasterize the swept volume of a trajectory */
+struct SweptVolumeRegion
+{
+  /** @brief The convex hull vertices in the link frame */
+  tesseract::common::VectorVector3d vertices;
+
+  /**
+   * @brief The outward facing hull planes (normal, offset) in the link frame
+   * @details If empty the hull is degenerate and the axis aligned bounding box of the vertices is used instead
+   */
+  std::vector<Eigen::Vector4d, Eigen::aligned_allocator<Eigen::Vector4d>> planes;
+};
+
+/**
+ * @brief Create the convex region of a set of vertices
+ * @param vertices The vertices in the link frame
+ * @return The convex region
+ */
+SweptVolumeRegion createSweptVolumeRegion(const tesseract::common::VectorVector3d& vertices)
+{
+  SweptVolumeRegion region;
+  Eigen::VectorXi faces;
+  int num_faces{ -1 };
+  if (vertices.size() >= 4)
+    num_faces = tesseract::collision::createConvexHull(region.vertices, faces, vertices);
+
+  if (num_faces < 4)
+  {
+    region.vertices = vertices;
+    return region;
+  }
+
+  Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+  for (const auto& v : region.vertices)
+    centroid += v;
+  centroid /= static_cast<double>(region.vertices.size());
+
+  for (Eigen::Index i = 0; i < faces.size(); i += faces[i] + 1)
+  {
+    const Eigen::Vector3d& v0 = region.vertices[static_cast<std::size_t>(faces[i + 1])];
+    const Eigen::Vector3d& v1 = region.vertices[static_cast<std::size_t>(faces[i + 2])];
+    const Eigen::Vector3d& v2 = region.vertices[static_cast<std::size_t>(faces[i + 3])];
+    Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
+    if (normal.norm() < std::numeric_limits<double>::epsilon())
+      continue;
+
+    normal.normalize();
+    if (normal.dot(centroid - v0) > 0)
+      normal = -normal;
+
+    region.planes.emplace_back(normal.x(), normal.y(), normal.z(), normal.dot(v0));
+  }
+
+  return region;
+}
+
+/**
+ * @brief The maximum number of voxels tested when rasterizing the swept volume of a trajectory
+ * @details This is the sum of the voxels in the bounding boxes of every region of every state, which bounds both the
+ * run time and the memory of the rasterization.
+ */
+static constexpr std::size_t MAX_SWEPT_VOLUME_VOXELS{ 100000000 };
+
+/** @brief The voxel key bounds of a convex region at one state of a trajectory */
+struct SweptVolumeRegionKeys
+{
+  octomap::OcTreeKey min_key;
+  octomap::OcTreeKey max_key;
+};
+
+/**
+ * @brief Get the largest distance a vertex of the convex regions of the active links moves between two states
+ * @param link_regions The convex regions of every link with collision geometry
+ * @param link_regions_index The index into link_regions of every link with collision geometry
+ * @param active_link_names The active links of both states
+ * @param transforms0 The transforms of the active links at the first state
+ * @param transforms1 The transforms of the active links at the second state
+ * @return The largest distance a vertex moves
+ */
+double getSweptVolumeMotion(const std::vector<std::vector<SweptVolumeRegion>>& link_regions,
+                            const std::unordered_map<std::string, std::size_t>& link_regions_index,
+                            const std::vector<std::string>& active_link_names,
+                            const tesseract::common::VectorIsometry3d& transforms0,
+                            const tesseract::common::VectorIsometry3d& transforms1)
+{
+  double motion{ 0 };
+  for (std::size_t j = 0; j < active_link_names.size(); ++j)
+  {
+    auto it = link_regions_index.find(active_link_names[j]);
+    if (it == link_regions_index.end())
+      continue;
+
+    for (const auto& region : link_regions[it->second])
+    {
+      for (const auto& v : region.vertices)
+        motion = std::max(motion, ((transforms1[j] * v) - (transforms0[j] * v)).norm());
+    }
+  }
+
+  return motion;
+}
+
+/**
+ * @brief Get the voxel key bounds of a convex region
+ * @param bounds The voxel key bounds
+ * @param octree The octree defining the voxel grid
+ * @param region The convex region
+ * @param transform The transform of the region relative to the octree
+ * @param padding The distance the region is extended by
+ * @return False if the region exceeds the octree bounds
+ */
+bool getSweptVolumeRegionKeys(SweptVolumeRegionKeys& bounds,
+                              const octomap::OcTree& octree,
+                              const SweptVolumeRegion& region,
+                              const Eigen::Isometry3d& transform,
+                              double padding)
+{
+  Eigen::Vector3d min_point = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d max_point = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+  for (const auto& v : region.vertices)
+  {
+    const Eigen::Vector3d p = transform * v;
+    min_point = min_point.cwiseMin(p);
+    max_point = max_point.cwiseMax(p);
+  }
+  min_point.array() -= padding;
+  max_point.array() += padding;
+
+  return (octree.coordToKeyChecked(octomap::point3d(static_cast<float>(min_point.x()),
+                                                    static_cast<float>(min_point.y()),
+                                                    static_cast<float>(min_point.z())),
+                                   bounds.min_key) &&
+          octree.coordToKeyChecked(octomap::point3d(static_cast<float>(max_point.x()),
+                                                    static_cast<float>(max_point.y()),
+                                                    static_cast<float>(max_point.z())),
+                                   bounds.max_key));
+}
+
+/** @brief Get the number of voxels within voxel key bounds */
+std::size_t getSweptVolumeRegionVoxelCount(const SweptVolumeRegionKeys& bounds)
+{
+  std::size_t count{ 1 };
+  for (unsigned i = 0; i < 3; ++i)
+    count *= static_cast<std::size_t>(bounds.max_key[i] - bounds.min_key[i]) + 1;
+
+  return count;
+}
+
+/**
+ * @brief Add the keys of all voxels intersecting a convex region
+ * @details A voxel is considered intersecting if its center is within half the voxel diagonal plus the padding of every
+ * hull plane, so the result is conservative.
+ * @param keys The voxel keys
+ * @param octree The octree defining the voxel grid
+ * @param region The convex region
+ * @param transform The transform of the region relative to the octree
+ * @param bounds The voxel key bounds of the region, see getSweptVolumeRegionKeys()
+ * @param padding The distance the region is extended by
+ */
+void rasterizeSweptVolumeRegion(octomap::KeySet& keys,
+                                const octomap::OcTree& octree,
+                                const SweptVolumeRegion& region,
+                                const Eigen::Isometry3d& transform,
+                                const SweptVolumeRegionKeys& bounds,
+                                double padding)
+{
+  std::vector<Eigen::Vector4d, Eigen::aligned_allocator<Eigen::Vector4d>> planes;
+  planes.reserve(region.planes.size());
+  for (const auto& plane : region.planes)
+  {
+    const Eigen::Vector3d normal = transform.linear() * plane.head<3>();
+    planes.emplace_back(normal.x(), normal.y(), normal.z(), plane[3] + normal.dot(transform.translation()));
+  }
+
+  const double half_diagonal = (0.5 * std::sqrt(3.0) * octree.getResolution()) + padding;
+  octomap::OcTreeKey key;
+  for (unsigned x = bounds.min_key[0]; x <= bounds.max_key[0]; ++x)
+  {
+    key[0] = static_cast<octomap::key_type>(x);
+    for (unsigned y = bounds.min_key[1]; y <= bounds.max_key[1]; ++y)
+    {
+      key[1] = static_cast<octomap::key_type>(y);
+      for (unsigned z = bounds.min_key[2]; z <= bounds.max_key[2]; ++z)
+      {
+        key[2] = static_cast<octomap::key_type>(z);
+        const Eigen::Vector3d center(octree.keyToCoord(key[0]), octree.keyToCoord(key[1]), octree.keyToCoord(key[2]));
+        const bool inside = std::all_of(planes.begin(), planes.end(), [&center, half_diagonal](const auto& plane) {
+          return (plane.template head<3>().dot(center) - plane[3]) <= half_diagonal;
+        });
+
+        if (inside)
+          keys.insert(key);
+      }
+    }
+  }
+}
+
 std::vector<std::shared_ptr<const Command>>
 getInitCommands(const tesseract::scene_graph::SceneGraph& scene_graph,
                 const std::shared_ptr<const tesseract::srdf::SRDFModel>& srdf_model = nullptr)
@@ -137,6 +340,202 @@ getInitCommands(const tesseract::scene_graph::SceneGraph& scene_graph,
   return commands;
 }
 
+/**
+ * @brief The contact managers leased to threads by an environment
+ * @details Entries removed from the pool while leased are destroyed when their lease is released
+ */
+template <typename ManagerType>
+struct ContactManagerPool
+{
+  struct Entry
+  {
+    std::unique_ptr<ManagerType> manager;
+    bool leased{ false };
+
+    /** @brief The revision of the environment the collision objects are synchronized with */
+    int revision{ 0 };
+
+    /** @brief The timestamp of the state the transforms are synchronized with */
+    std::chrono::system_clock::time_point state_timestamp;
+
+    /** @brief The link transforms of the state the transforms are synchronized with */
+    tesseract::common::TransformMap link_transforms;
+  };
+
+  std::mutex mutex;
+  std::vector<std::shared_ptr<Entry>> entries;
+
+  void clear()
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    entries.clear();
+  }
+};
+
+/**
+ * @brief Synchronize the collision objects, active objects and margins of a contact manager with another one
+ * @details Objects are only added or removed if they differ, the geometries are compared by pointer.
+ * @param manager The contact manager to synchronize
+ * @param source The contact manager to synchronize with
+ * @return The names of the collision objects which were added, their transforms must be set
+ */
+template <typename ManagerType>
+std::vector<std::string> syncContactManager(ManagerType& manager, const ManagerType& source)
+{
+  auto poses_equal = [](const Eigen::Isometry3d& pose1, const Eigen::Isometry3d& pose2) {
+    return pose1.matrix() == pose2.matrix();
+  };
+
+  const std::vector<std::string> names = manager.getCollisionObjects();
+  for (const auto& name : names)
+  {
+    if (!source.hasCollisionObject(name))
+      manager.removeCollisionObject(name);
+  }
+
+  std::vector<std::string> added;
+  for (const auto& name : source.getCollisionObjects())
+  {
+    const auto& shapes = source.getCollisionObjectGeometries(name);
+    const auto& shape_poses = source.getCollisionObjectGeometriesTransforms(name);
+    const bool enabled = source.isCollisionObjectEnabled(name);
+    if (manager.hasCollisionObject(name))
+    {
+      const auto& current_poses = manager.getCollisionObjectGeometriesTransforms(name);
+      if (manager.getCollisionObjectGeometries(name) == shapes &&
+          std::equal(current_poses.begin(), current_poses.end(), shape_poses.begin(), shape_poses.end(), poses_equal))
+      {
+        if (enabled && !manager.isCollisionObjectEnabled(name))
+          manager.enableCollisionObject(name);
+        else if (!enabled && manager.isCollisionObjectEnabled(name))
+          manager.disableCollisionObject(name);
+
+        continue;
+      }
+
+      manager.removeCollisionObject(name);
+    }
+
+    manager.addCollisionObject(name, 0, shapes, shape_poses, enabled);
+    added.push_back(name);
+  }
+
+  if (manager.getActiveCollisionObjects() != source.getActiveCollisionObjects())
+    manager.setActiveCollisionObjects(source.getActiveCollisionObjects());
+
+  if (!(manager.getCollisionMarginData() == source.getCollisionMarginData()))
+    manager.setCollisionMarginData(source.getCollisionMarginData());
+
+  return added;
+}
+
+void setCollisionObjectTransform(tesseract::collision::DiscreteContactManager& manager,
+                                 const std::string& name,
+                                 const Eigen::Isometry3d& pose,
+                                 bool /*active*/)
+{
+  manager.setCollisionObjectsTransform(name, pose);
+}
+
+/**
+ * @brief Sets the transforms of the collision objects of a discrete contact manager by index
+ * @details The link of every collision object is looked up by name once and stored as its position in the iteration
+ * order of the link transforms. The link transforms of the states keep their iteration order while the links are
+ * unchanged, so later updates read the transforms by position and only compare the link names with the collision
+ * objects. When they differ, because links or collision objects were added or removed, the positions are rebuilt. The
+ * buffers are reused between updates.
+ */
+class DiscreteCollisionObjectTransforms
+{
+public:
+  /**
+   * @brief Set the transforms of the collision objects of the manager
+   * @param manager The contact manager
+   * @param link_transforms The link transforms of the state
+   */
+  void apply(tesseract::collision::DiscreteContactManager& manager,
+             const tesseract::common::TransformMap& link_transforms)
+  {
+    const std::vector<std::string>& names = manager.getCollisionObjects();
+
+    entries_.clear();
+    for (const auto& entry : link_transforms)
+      entries_.push_back(&entry);
+
+    if (!isValid(names))
+      rebuild(names, link_transforms);
+
+    for (std::size_t i = 0; i < indices_.size(); ++i)
+      poses_[i] = entries_[positions_[i]]->second;
+
+    manager.setCollisionObjectsTransform(indices_, poses_);
+  }
+
+private:
+  /** @brief The indices of the collision objects with a link transform */
+  std::vector<std::size_t> indices_;
+
+  /** @brief The position of the link transform of each collision object in the iteration order of the transforms */
+  std::vector<std::size_t> positions_;
+
+  /** @brief Indicate if every collision object had a link transform when the positions were built */
+  bool complete_{ false };
+
+  /** @brief The link transforms in iteration order, filled by every update */
+  std::vector<const tesseract::common::TransformMap::value_type*> entries_;
+
+  /** @brief The poses of the collision objects passed to the contact manager */
+  tesseract::common::VectorIsometry3d poses_;
+
+  bool isValid(const std::vector<std::string>& names) const
+  {
+    if (!complete_ || names.size() != indices_.size())
+      return false;
+
+    for (std::size_t i = 0; i < indices_.size(); ++i)
+    {
+      if (positions_[i] >= entries_.size() || entries_[positions_[i]]->first != names[indices_[i]])
+        return false;
+    }
+
+    return true;
+  }
+
+  void rebuild(const std::vector<std::string>& names, const tesseract::common::TransformMap& link_transforms)
+  {
+    std::unordered_map<const tesseract::common::TransformMap::value_type*, std::size_t> entry_positions;
+    entry_positions.reserve(entries_.size());
+    for (std::size_t i = 0; i < entries_.size(); ++i)
+      entry_positions.emplace(entries_[i], i);
+
+    indices_.clear();
+    positions_.clear();
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+      auto it = link_transforms.find(names[i]);
+      if (it == link_transforms.end())
+        continue;
+
+      indices_.push_back(i);
+      positions_.push_back(entry_positions.at(&(*it)));
+    }
+
+    complete_ = (indices_.size() == names.size());
+    poses_.resize(indices_.size());
+  }
+};
+
+void setCollisionObjectTransform(tesseract::collision::ContinuousContactManager& manager,
+                                 const std::string& name,
+                                 const Eigen::Isometry3d& pose,
+                                 bool active)
+{
+  if (active)
+    manager.setCollisionObjectsTransform(name, pose, pose);
+  else
+    manager.setCollisionObjectsTransform(name, pose);
+}
+
 struct Environment::Implementation
 {
   ~Implementation() = default;
@@ -237,6 +636,12 @@ struct Environment::Implementation
   mutable std::unique_ptr<tesseract::collision::DiscreteContactManager> discrete_manager{ nullptr };
   mutable std::shared_mutex discrete_manager_mutex;
 
+  /**
+   * @brief Sets the transforms of the discrete contact manager collision objects, guarded by discrete_manager_mutex
+   * @note This is intentionally not serialized it will auto updated
+   */
+  DiscreteCollisionObjectTransforms discrete_manager_transforms;
+
   /**
    * @brief The continuous contact manager object
    * @note This is intentionally not serialized it will auto updated
@@ -244,6 +649,22 @@ struct Environment::Implementation
   mutable std::unique_ptr<tesseract::collision::ContinuousContactManager> continuous_manager{ nullptr };
   mutable std::shared_mutex continuous_manager_mutex;
 
+  /**
+   * @brief The discrete contact managers leased to threads
+   * @note This is intentionally not serialized it will auto updated
+   */
+  std::shared_ptr<ContactManagerPool<tesseract::collision::DiscreteContactManager>> discrete_manager_pool{
+    std::make_shared<ContactManagerPool<tesseract::collision::DiscreteContactManager>>()
+  };
+
+  /**
+   * @brief The continuous contact managers leased to threads
+   * @note This is intentionally not serialized it will auto updated
+   */
+  std::shared_ptr<ContactManagerPool<tesseract::collision::ContinuousContactManager>> continuous_manager_pool{
+    std::make_shared<ContactManagerPool<tesseract::collision::ContinuousContactManager>>()
+  };
+
   /**
    * @brief A cache of group joint names to provide faster access
    * @details This will cleared when environment changes
@@ -331,6 +752,21 @@ struct Environment::Implementation
 
   void clearCachedContinuousContactManager() const;
 
+  DiscreteContactManagerLease leaseDiscreteContactManager() const;
+
+  ContinuousContactManagerLease leaseContinuousContactManager() const;
+
+  /**
+   * @brief Lease a contact manager from a pool
+   * @details The calling function should be locking the mutex of the source manager
+   * @param pool The pool
+   * @param source The cached contact manager
+   * @return The lease
+   */
+  template <typename ManagerType>
+  ContactManagerLease<ManagerType> leaseContactManager(const std::shared_ptr<ContactManagerPool<ManagerType>>& pool,
+                                                       const ManagerType& source) const;
+
   bool setActiveDiscreteContactManagerHelper(const std::string& name);
 
   bool setActiveContinuousContactManagerHelper(const std::string& name);
@@ -608,11 +1044,13 @@ void Environment::Implementation::clear()
   {
     std::unique_lock<std::shared_mutex> lock(discrete_manager_mutex);
     discrete_manager = nullptr;
+    discrete_manager_pool->clear();
   }
 
   {
     std::unique_lock<std::shared_mutex> lock(continuous_manager_mutex);
     continuous_manager = nullptr;
+    continuous_manager_pool->clear();
   }
 
   {
@@ -656,7 +1094,7 @@ void Environment::Implementation::currentStateChanged()
 
   std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex);
   if (discrete_manager != nullptr)
-    discrete_manager->setCollisionObjectsTransform(current_state.link_transforms);
+    discrete_manager_transforms.apply(*discrete_manager, current_state.link_transforms);
 
   std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex);
   if (continuous_manager != nullptr)
@@ -912,12 +1350,146 @@ void Environment::Implementation::clearCachedDiscreteContactManager() const
 {
   std::unique_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex);
   discrete_manager = nullptr;
+  discrete_manager_pool->clear();
 }
 
 void Environment::Implementation::clearCachedContinuousContactManager() const
 {
   std::unique_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex);
   continuous_manager = nullptr;
+  continuous_manager_pool->clear();
+}
+
+DiscreteContactManagerLease Environment::Implementation::leaseDiscreteContactManager() const
+{
+  {
+    std::shared_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex);
+    if (discrete_manager)
+      return leaseContactManager(discrete_manager_pool, *discrete_manager);
+  }
+
+  // Create the cached manager
+  if (getDiscreteContactManager() == nullptr)
+    return {};
+
+  std::shared_lock<std::shared_mutex> discrete_lock(discrete_manager_mutex);
+  if (discrete_manager == nullptr)
+    return {};
+
+  return leaseContactManager(discrete_manager_pool, *discrete_manager);
+}
+
+ContinuousContactManagerLease Environment::Implementation::leaseContinuousContactManager() const
+{
+  {
+    std::shared_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex);
+    if (continuous_manager)
+      return leaseContactManager(continuous_manager_pool, *continuous_manager);
+  }
+
+  // Create the cached manager
+  if (getContinuousContactManager() == nullptr)
+    return {};
+
+  std::shared_lock<std::shared_mutex> continuous_lock(continuous_manager_mutex);
+  if (continuous_manager == nullptr)
+    return {};
+
+  return leaseContactManager(continuous_manager_pool, *continuous_manager);
+}
+
+template <typename ManagerType>
+ContactManagerLease<ManagerType>
+Environment::Implementation::leaseContactManager(const std::shared_ptr<ContactManagerPool<ManagerType>>& pool,
+                                                 const ManagerType& source) const
+{
+  using Entry = typename ContactManagerPool<ManagerType>::Entry;
+
+  std::shared_ptr<Entry> entry;
+  {  // Prefer an idle manager which is synchronized with the current revision
+    std::unique_lock<std::mutex> lock(pool->mutex);
+    for (const auto& e : pool->entries)
+    {
+      if (e->leased)
+        continue;
+
+      entry = e;
+      if (e->revision == revision)
+        break;
+    }
+
+    if (entry == nullptr)
+    {
+      entry = std::make_shared<Entry>();
+      pool->entries.push_back(entry);
+    }
+
+    entry->leased = true;
+  }
+
+  if (entry->manager == nullptr || entry->manager->getName() != source.getName())
+  {
+    // The cached manager is synchronized with the current state
+    entry->manager = source.clone();
+    entry->revision = revision;
+    entry->state_timestamp = current_state_timestamp;
+    entry->link_transforms = current_state.link_transforms;
+  }
+  else
+  {
+    ManagerType& manager = *entry->manager;
+    const std::vector<std::string>& active = source.getActiveCollisionObjects();
+    auto is_active = [&active](const std::string& name) {
+      return (std::find(active.begin(), active.end(), name) != active.end());
+    };
+
+    std::vector<std::string> added;
+    if (entry->revision != revision)
+    {
+      added = syncContactManager(manager, source);
+      entry->revision = revision;
+    }
+
+    // Only links which moved since the manager was synchronized are updated
+    if (entry->state_timestamp != current_state_timestamp)
+    {
+      for (const auto& tf : current_state.link_transforms)
+      {
+        auto it = entry->link_transforms.find(tf.first);
+        if (it == entry->link_transforms.end() || it->second.matrix() != tf.second.matrix())
+          setCollisionObjectTransform(manager, tf.first, tf.second, is_active(tf.first));
+      }
+
+      entry->state_timestamp = current_state_timestamp;
+      entry->link_transforms = current_state.link_transforms;
+    }
+
+    for (const auto& name : added)
+    {
+      auto it = current_state.link_transforms.find(name);
+      if (it != current_state.link_transforms.end())
+        setCollisionObjectTransform(manager, name, it->second, is_active(name));
+    }
+
+    // The previous lease may have moved the active links
+    for (const auto& name : active)
+    {
+      auto it = current_state.link_transforms.find(name);
+      if (it != current_state.link_transforms.end())
+        setCollisionObjectTransform(manager, name, it->second, true);
+    }
+  }
+
+  std::weak_ptr<ContactManagerPool<ManagerType>> weak_pool = pool;
+  auto release_fn = [weak_pool, entry]() {
+    if (auto locked_pool = weak_pool.lock())
+    {
+      std::unique_lock<std::mutex> lock(locked_pool->mutex);
+      entry->leased = false;
+    }
+  };
+
+  return { std::shared_ptr<ManagerType>(entry, entry->manager.get()), release_fn };
 }
 
 bool Environment::Implementation::setActiveDiscreteContactManagerHelper(const std::string& name)
@@ -938,6 +1510,7 @@ bool Environment::Implementation::setActiveDiscreteContactManagerHelper(const st
 
   // The calling function should be locking discrete_manager_mutex_
   discrete_manager = std::move(manager);
+  discrete_manager_pool->clear();
 
   return true;
 }
@@ -961,6 +1534,7 @@ bool Environment::Implementation::setActiveContinuousContactManagerHelper(const
 
   // The calling function should be locking continuous_manager_mutex_
   continuous_manager = std::move(manager);
+  continuous_manager_pool->clear();
 
   return true;
 }
@@ -992,7 +1566,7 @@ Environment::Implementation::getDiscreteContactManagerHelper(const std::string&
 
   manager->setCollisionMarginData(collision_margin_data);
 
-  manager->setCollisionObjectsTransform(current_state.link_transforms);
+  DiscreteCollisionObjectTransforms().apply(*manager, current_state.link_transforms);
 
   return manager;
 }
@@ -1323,14 +1897,32 @@ bool Environment::Implementation::applyAddTrajectoryLinkCommand(const AddTraject
     return false;
   }
 
-  auto state_solver_clone = state_solver->clone();
+  switch (cmd->getMethod())
+  {
+    case AddTrajectoryLinkCommand::Method::PER_STATE_OBJECTS:
+    case AddTrajectoryLinkCommand::Method::PER_STATE_CONVEX_HULL:
+    case AddTrajectoryLinkCommand::Method::GLOBAL_CONVEX_HULL:
+    case AddTrajectoryLinkCommand::Method::GLOBAL_PER_LINK_CONVEX_HULL:
+      break;
+    case AddTrajectoryLinkCommand::Method::SWEPT_VOLUME_OCTREE:
+    {
+      if (!(cmd->getResolution() > 0))
+      {
+        CONSOLE_BRIDGE_logWarn("Tried to add trajectory link (%s) with a resolution which is not greater than zero.",
+                               cmd->getLinkName().c_str());
+        return false;
+      }
+      break;
+    }
+    default:
+      throw std::runtime_error("Environment, unhandled AddTrajectoryLinkCommand::Method type!");
+  }
 
-  auto traj_link = std::make_shared<tesseract::scene_graph::Link>(cmd->getLinkName());
+  // Validate the trajectory and find the active links of each state
+  std::vector<std::vector<std::string>> active_link_name_sets;
+  std::vector<std::size_t> state_active_link_set;
+  state_active_link_set.reserve(traj.size());
   std::vector<std::string> joint_names;
-  std::vector<std::string> active_link_names;
-  std::unordered_map<std::string, std::vector<tesseract::scene_graph::Collision::Ptr>> link_collision_geom;
-  std::vector<std::vector<tesseract::scene_graph::Collision::Ptr>> per_state_collision_geom;
-  per_state_collision_geom.reserve(traj.size());
   for (const auto& state : traj)
   {
     if (state.joint_names.empty())
@@ -1352,11 +1944,10 @@ bool Environment::Implementation::applyAddTrajectoryLinkCommand(const AddTraject
       return false;
     }
 
-    tesseract::scene_graph::SceneState scene_state = state_solver_clone->getState(state.joint_names, state.position);
     if (joint_names.empty() || !tesseract::common::isIdentical(state.joint_names, joint_names, false))
     {
       joint_names = state.joint_names;
-      active_link_names = scene_graph->getJointChildrenNames(joint_names);
+      std::vector<std::string> active_link_names = scene_graph->getJointChildrenNames(joint_names);
 
       if (std::find(active_link_names.begin(), active_link_names.end(), cmd->getParentLinkName()) !=
           active_link_names.end())
@@ -1365,32 +1956,66 @@ bool Environment::Implementation::applyAddTrajectoryLinkCommand(const AddTraject
                                cmd->getLinkName().c_str());
         return false;
       }
+
+      active_link_name_sets.push_back(std::move(active_link_names));
     }
 
-    std::vector<tesseract::scene_graph::Collision::Ptr> state_collision_geom;
-    Eigen::Isometry3d parent_link_tf_inv = scene_state.link_transforms[cmd->getParentLinkName()].inverse();  // NOLINT
-    for (const auto& link_name : active_link_names)
+    state_active_link_set.push_back(active_link_name_sets.size() - 1);
+  }
+
+  tesseract::common::TaskExecutor& executor = tesseract::common::getGlobalTaskExecutor();
+
+  // Compute the active link transforms relative to the parent link for every state in parallel
+  std::vector<tesseract::common::VectorIsometry3d> state_link_transforms(traj.size());
+  tesseract::common::parallelFor(executor, traj.size(), [&](std::size_t begin, std::size_t end) {
+    auto state_solver_clone = state_solver->clone();
+    for (std::size_t i = begin; i < end; ++i)
     {
-      Eigen::Isometry3d link_transform = parent_link_tf_inv * scene_state.link_transforms[link_name];
-      auto link = scene_graph->getLink(link_name);
-      assert(link != nullptr);
+      const auto& state = traj[i];
+      tesseract::scene_graph::SceneState scene_state = state_solver_clone->getState(state.joint_names, state.position);
+      const Eigen::Isometry3d parent_link_tf_inv = scene_state.link_transforms.at(cmd->getParentLinkName()).inverse();
+      const std::vector<std::string>& active_link_names = active_link_name_sets[state_active_link_set[i]];
+
+      tesseract::common::VectorIsometry3d& link_transforms = state_link_transforms[i];
+      link_transforms.reserve(active_link_names.size());
+      for (const auto& link_name : active_link_names)
+        link_transforms.emplace_back(parent_link_tf_inv * scene_state.link_transforms.at(link_name));
+    }
+  });
 
-      auto clone = link->clone(link_name + "_clone");
+  auto traj_link = std::make_shared<tesseract::scene_graph::Link>(cmd->getLinkName());
+  std::vector<std::string> collision_link_names;
+  for (std::size_t i = 0; i < traj.size(); ++i)
+  {
+    const std::vector<std::string>& active_link_names = active_link_name_sets[state_active_link_set[i]];
+    for (std::size_t j = 0; j < active_link_names.size(); ++j)
+    {
+      auto link = scene_graph->getLink(active_link_names[j]);
+      assert(link != nullptr);
 
-      for (auto& vis_clone : clone.visual)
+      const Eigen::Isometry3d& link_transform = state_link_transforms[i][j];
+      for (const auto& visual : link->visual)
       {
+        auto vis_clone = std::make_shared<tesseract::scene_graph::Visual>(*visual);
         vis_clone->origin = link_transform * vis_clone->origin;
         traj_link->visual.push_back(vis_clone);
       }
 
-      for (auto& col_clone : clone.collision)
+      if (!link->collision.empty() &&
+          std::find(collision_link_names.begin(), collision_link_names.end(), link->getName()) ==
+              collision_link_names.end())
+        collision_link_names.push_back(link->getName());
+
+      if (cmd->getMethod() == AddTrajectoryLinkCommand::Method::PER_STATE_OBJECTS)
       {
-        col_clone->origin = link_transform * col_clone->origin;
-        link_collision_geom[link_name].push_back(col_clone);
-        state_collision_geom.push_back(col_clone);
+        for (const auto& collision : link->collision)
+        {
+          auto col_clone = std::make_shared<tesseract::scene_graph::Collision>(*collision);
+          col_clone->origin = link_transform * col_clone->origin;
+          traj_link->collision.push_back(col_clone);
+        }
       }
     }
-    per_state_collision_geom.push_back(state_collision_geom);
   }
 
   // Utility function to create convex hull
@@ -1399,8 +2024,6 @@ bool Environment::Implementation::applyAddTrajectoryLinkCommand(const AddTraject
         std::make_shared<tesseract::common::VectorVector3d>();
     std::shared_ptr<Eigen::VectorXi> ch_faces = std::make_shared<Eigen::VectorXi>();
     int ch_num_faces = tesseract::collision::createConvexHull(*ch_vertices, *ch_faces, vertices);
-    auto convex_mesh = std::make_shared<tesseract::geometry::ConvexMesh>(
-        ch_vertices, ch_faces, ch_num_faces, nullptr, Eigen::Vector3d(1, 1, 1));
 
     auto col_obj = std::make_shared<tesseract::scene_graph::Collision>();
     col_obj->geometry = std::make_shared<tesseract::geometry::ConvexMesh>(
@@ -1409,71 +2032,338 @@ bool Environment::Implementation::applyAddTrajectoryLinkCommand(const AddTraject
     return col_obj;
   };
 
-  switch (cmd->getMethod())
+  if (cmd->getMethod() == AddTrajectoryLinkCommand::Method::SWEPT_VOLUME_OCTREE)
   {
-    case AddTrajectoryLinkCommand::Method::PER_STATE_OBJECTS:
+    // Approximate every collision object by its convex hull once
+    std::vector<std::vector<SweptVolumeRegion>> link_regions(collision_link_names.size());
+    std::unordered_map<std::string, std::size_t> link_regions_index;
+    for (std::size_t i = 0; i < collision_link_names.size(); ++i)
+      link_regions_index[collision_link_names[i]] = i;
+
+    std::atomic<bool> valid_vertices{ true };
+    tesseract::common::parallelFor(executor, collision_link_names.size(), [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        auto link = scene_graph->getLink(collision_link_names[i]);
+        for (const auto& col_obj : link->collision)
+        {
+          tesseract::common::VectorVector3d vertices =
+              tesseract::geometry::extractVertices(*col_obj->geometry, col_obj->origin);
+          if (vertices.empty())
+          {
+            valid_vertices = false;
+            return;
+          }
+          link_regions[i].push_back(createSweptVolumeRegion(vertices));
+        }
+      }
+    });
+
+    if (!valid_vertices)
+      return false;
+
+    // Interpolate the joint positions between consecutive states with the same joints, so no hull vertex moves more
+    // than the resolution between samples and thin obstacles between the states are part of the swept volume
+    std::vector<std::size_t> state_sample_counts(traj.size(), 1);
+    tesseract::common::parallelFor(executor, traj.size() - 1, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        if (state_active_link_set[i] != state_active_link_set[i + 1])
+          continue;
+
+        const double motion = getSweptVolumeMotion(link_regions,
+                                                   link_regions_index,
+                                                   active_link_name_sets[state_active_link_set[i]],
+                                                   state_link_transforms[i],
+                                                   state_link_transforms[i + 1]);
+        const double substeps = std::ceil(motion / cmd->getResolution());
+        if (substeps > 1)
+          state_sample_counts[i] =
+              static_cast<std::size_t>(std::min(substeps, static_cast<double>(MAX_SWEPT_VOLUME_VOXELS + 1)));
+      }
+    });
+
+    // Every sample occupies at least one voxel
+    std::vector<std::size_t> state_sample_offsets(traj.size() + 1, 0);
+    for (std::size_t i = 0; i < traj.size(); ++i)
+      state_sample_offsets[i + 1] =
+          std::min(state_sample_offsets[i] + state_sample_counts[i], MAX_SWEPT_VOLUME_VOXELS + 1);
+
+    if (state_sample_offsets.back() > MAX_SWEPT_VOLUME_VOXELS)
     {
-      for (const auto& pair : link_collision_geom)
-        traj_link->collision.insert(traj_link->collision.end(), pair.second.begin(), pair.second.end());
-      break;
+      CONSOLE_BRIDGE_logError("Tried to add trajectory link (%s) with a swept volume of more than %zu voxels, increase "
+                              "the resolution.",
+                              cmd->getLinkName().c_str(),
+                              MAX_SWEPT_VOLUME_VOXELS);
+      return false;
     }
-    case AddTrajectoryLinkCommand::Method::PER_STATE_CONVEX_HULL:
-    {
-      for (const auto& state_collision_geom : per_state_collision_geom)
+
+    // Compute the active link transforms of the samples, the first sample of every state is the state itself
+    const std::size_t sample_count = state_sample_offsets.back();
+    std::vector<tesseract::common::VectorIsometry3d> sample_link_transforms(sample_count);
+    std::vector<std::size_t> sample_active_link_set(sample_count);
+    tesseract::common::parallelFor(executor, traj.size(), [&](std::size_t begin, std::size_t end) {
+      auto state_solver_clone = state_solver->clone();
+      for (std::size_t i = begin; i < end; ++i)
       {
-        tesseract::common::VectorVector3d vertices;
-        for (const auto& col_obj : state_collision_geom)
+        const std::size_t offset = state_sample_offsets[i];
+        sample_link_transforms[offset] = state_link_transforms[i];
+        sample_active_link_set[offset] = state_active_link_set[i];
+        if (state_sample_counts[i] < 2)
+          continue;
+
+        // The joints of the next state are the same but not necessarily in the same order
+        const auto& state = traj[i];
+        const auto& next_state = traj[i + 1];
+        Eigen::VectorXd next_position(state.position.size());
+        for (std::size_t k = 0; k < state.joint_names.size(); ++k)
         {
-          tesseract::common::VectorVector3d cov =
-              tesseract::geometry::extractVertices(*col_obj->geometry, col_obj->origin);
-          if (cov.empty())
-            return false;
-          vertices.insert(vertices.end(), cov.begin(), cov.end());
+          auto it = std::find(next_state.joint_names.begin(), next_state.joint_names.end(), state.joint_names[k]);
+          next_position(static_cast<Eigen::Index>(k)) =
+              next_state.position(std::distance(next_state.joint_names.begin(), it));
         }
 
-        traj_link->collision.push_back(createCollision(vertices));
+        const std::vector<std::string>& active_link_names = active_link_name_sets[state_active_link_set[i]];
+        for (std::size_t k = 1; k < state_sample_counts[i]; ++k)
+        {
+          const double t = static_cast<double>(k) / static_cast<double>(state_sample_counts[i]);
+          const Eigen::VectorXd position = state.position + (t * (next_position - state.position));
+          tesseract::scene_graph::SceneState scene_state = state_solver_clone->getState(state.joint_names, position);
+          const Eigen::Isometry3d parent_link_tf_inv =
+              scene_state.link_transforms.at(cmd->getParentLinkName()).inverse();
+
+          tesseract::common::VectorIsometry3d& link_transforms = sample_link_transforms[offset + k];
+          link_transforms.reserve(active_link_names.size());
+          for (const auto& link_name : active_link_names)
+            link_transforms.emplace_back(parent_link_tf_inv * scene_state.link_transforms.at(link_name));
+          sample_active_link_set[offset + k] = state_active_link_set[i];
+        }
       }
-      break;
+    });
+
+    // Every point of a link between two samples is within half the motion between the samples of one of them, so the
+    // regions are extended by half of the largest motion between consecutive samples
+    double max_sample_motion{ 0 };
+    std::mutex max_sample_motion_mutex;
+    tesseract::common::parallelFor(executor, traj.size(), [&](std::size_t begin, std::size_t end) {
+      double local_max_sample_motion{ 0 };
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        if ((i + 1) == traj.size() || state_active_link_set[i] != state_active_link_set[i + 1])
+          continue;
+
+        const std::vector<std::string>& active_link_names = active_link_name_sets[state_active_link_set[i]];
+        for (std::size_t s = state_sample_offsets[i]; s < state_sample_offsets[i + 1]; ++s)
+          local_max_sample_motion = std::max(local_max_sample_motion,
+                                             getSweptVolumeMotion(link_regions,
+                                                                  link_regions_index,
+                                                                  active_link_names,
+                                                                  sample_link_transforms[s],
+                                                                  sample_link_transforms[s + 1]));
+      }
+
+      std::scoped_lock lock(max_sample_motion_mutex);
+      max_sample_motion = std::max(max_sample_motion, local_max_sample_motion);
+    });
+    const double padding = 0.5 * max_sample_motion;
+
+    // Compute the voxel bounds of the regions of every sample, so the swept volume is checked before rasterizing
+    auto octree = std::make_shared<octomap::OcTree>(cmd->getResolution());
+    std::vector<std::vector<SweptVolumeRegionKeys>> sample_region_keys(sample_count);
+    std::vector<std::size_t> sample_voxel_counts(sample_count, 0);
+    std::atomic<bool> within_bounds{ true };
+    tesseract::common::parallelFor(executor, sample_count, [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end && within_bounds; ++i)
+      {
+        const std::vector<std::string>& active_link_names = active_link_name_sets[sample_active_link_set[i]];
+        for (std::size_t j = 0; j < active_link_names.size(); ++j)
+        {
+          auto it = link_regions_index.find(active_link_names[j]);
+          if (it == link_regions_index.end())
+            continue;
+
+          for (const auto& region : link_regions[it->second])
+          {
+            SweptVolumeRegionKeys bounds;
+            if (!getSweptVolumeRegionKeys(bounds, *octree, region, sample_link_transforms[i][j], padding))
+            {
+              within_bounds = false;
+              return;
+            }
+
+            sample_voxel_counts[i] =
+                std::min(sample_voxel_counts[i] + getSweptVolumeRegionVoxelCount(bounds), MAX_SWEPT_VOLUME_VOXELS + 1);
+            sample_region_keys[i].push_back(bounds);
+          }
+        }
+      }
+    });
+
+    if (!within_bounds)
+    {
+      CONSOLE_BRIDGE_logError("Tried to add trajectory link (%s) with a swept volume which exceeds the octree bounds.",
+                              cmd->getLinkName().c_str());
+      return false;
     }
-    case AddTrajectoryLinkCommand::Method::GLOBAL_CONVEX_HULL:
+
+    std::size_t voxel_count{ 0 };
+    for (const auto& count : sample_voxel_counts)
+      voxel_count = std::min(voxel_count + count, MAX_SWEPT_VOLUME_VOXELS + 1);
+
+    if (voxel_count > MAX_SWEPT_VOLUME_VOXELS)
     {
-      tesseract::common::VectorVector3d vertices;
-      for (const auto& pair : link_collision_geom)
+      CONSOLE_BRIDGE_logError("Tried to add trajectory link (%s) with a swept volume of more than %zu voxels, increase "
+                              "the resolution.",
+                              cmd->getLinkName().c_str(),
+                              MAX_SWEPT_VOLUME_VOXELS);
+      return false;
+    }
+
+    // Rasterize the regions of every sample in parallel
+    octomap::KeySet keys;
+    std::mutex keys_mutex;
+    tesseract::common::parallelFor(executor, sample_count, [&](std::size_t begin, std::size_t end) {
+      octomap::KeySet local_keys;
+      for (std::size_t i = begin; i < end; ++i)
       {
-        for (const auto& col_obj : pair.second)
+        std::size_t k{ 0 };
+        const std::vector<std::string>& active_link_names = active_link_name_sets[sample_active_link_set[i]];
+        for (std::size_t j = 0; j < active_link_names.size(); ++j)
         {
-          tesseract::common::VectorVector3d cov =
-              tesseract::geometry::extractVertices(*col_obj->geometry, col_obj->origin);
-          if (cov.empty())
-            return false;
-          vertices.insert(vertices.end(), cov.begin(), cov.end());
+          auto it = link_regions_index.find(active_link_names[j]);
+          if (it == link_regions_index.end())
+            continue;
+
+          for (const auto& region : link_regions[it->second])
+            rasterizeSweptVolumeRegion(
+                local_keys, *octree, region, sample_link_transforms[i][j], sample_region_keys[i][k++], padding);
         }
       }
 
-      traj_link->collision.push_back(createCollision(vertices));
-      break;
-    }
-    case AddTrajectoryLinkCommand::Method::GLOBAL_PER_LINK_CONVEX_HULL:
+      std::scoped_lock lock(keys_mutex);
+      keys.insert(local_keys.begin(), local_keys.end());
+    });
+
+    if (!keys.empty())
     {
-      for (const auto& pair : link_collision_geom)
+      for (const auto& key : keys)
+        octree->updateNode(key, true, true);
+
+      octree->updateInnerOccupancy();
+      tesseract::geometry::Octree::prune(*octree);
+
+      auto col_obj = std::make_shared<tesseract::scene_graph::Collision>();
+      col_obj->geometry =
+          std::make_shared<tesseract::geometry::Octree>(octree, tesseract::geometry::OctreeSubType::BOX, true);
+      col_obj->origin = Eigen::Isometry3d::Identity();
+      traj_link->collision.push_back(col_obj);
+    }
+  }
+  else if (cmd->getMethod() != AddTrajectoryLinkCommand::Method::PER_STATE_OBJECTS)
+  {
+    // Reduce the collision geometry of each link to its convex hull vertices once, so only these are transformed
+    std::unordered_map<std::string, std::size_t> link_hull_index;
+    for (std::size_t i = 0; i < collision_link_names.size(); ++i)
+      link_hull_index[collision_link_names[i]] = i;
+
+    std::vector<tesseract::common::VectorVector3d> link_hull_vertices(collision_link_names.size());
+    std::atomic<bool> valid_vertices{ true };
+    tesseract::common::parallelFor(executor, collision_link_names.size(), [&](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
       {
+        auto link = scene_graph->getLink(collision_link_names[i]);
         tesseract::common::VectorVector3d vertices;
-        for (const auto& col_obj : pair.second)
+        for (const auto& col_obj : link->collision)
         {
           tesseract::common::VectorVector3d cov =
               tesseract::geometry::extractVertices(*col_obj->geometry, col_obj->origin);
           if (cov.empty())
-            return false;
+          {
+            valid_vertices = false;
+            return;
+          }
           vertices.insert(vertices.end(), cov.begin(), cov.end());
         }
 
-        traj_link->collision.push_back(createCollision(vertices));
+        Eigen::VectorXi ch_faces;
+        if (vertices.size() < 4 ||
+            tesseract::collision::createConvexHull(link_hull_vertices[i], ch_faces, vertices) < 0)
+          link_hull_vertices[i] = vertices;
       }
+    });
 
-      break;
+    if (!valid_vertices)
+      return false;
+
+    // Append the link hull vertices of a state transformed into the parent link frame
+    auto appendStateVertices = [&](tesseract::common::VectorVector3d& vertices, std::size_t state_index) {
+      const std::vector<std::string>& active_link_names = active_link_name_sets[state_active_link_set[state_index]];
+      for (std::size_t j = 0; j < active_link_names.size(); ++j)
+      {
+        auto it = link_hull_index.find(active_link_names[j]);
+        if (it == link_hull_index.end())
+          continue;
+
+        const Eigen::Isometry3d& link_transform = state_link_transforms[state_index][j];
+        for (const auto& v : link_hull_vertices[it->second])
+          vertices.emplace_back(link_transform * v);
+      }
+    };
+
+    if (cmd->getMethod() == AddTrajectoryLinkCommand::Method::PER_STATE_CONVEX_HULL)
+    {
+      std::vector<tesseract::scene_graph::Collision::Ptr> state_collisions(traj.size());
+      tesseract::common::parallelFor(executor, traj.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          tesseract::common::VectorVector3d vertices;
+          appendStateVertices(vertices, i);
+          if (!vertices.empty())
+            state_collisions[i] = createCollision(vertices);
+        }
+      });
+
+      for (const auto& state_collision : state_collisions)
+      {
+        if (state_collision != nullptr)
+          traj_link->collision.push_back(state_collision);
+      }
+    }
+    else if (cmd->getMethod() == AddTrajectoryLinkCommand::Method::GLOBAL_CONVEX_HULL)
+    {
+      tesseract::common::VectorVector3d vertices;
+      for (std::size_t i = 0; i < traj.size(); ++i)
+        appendStateVertices(vertices, i);
+
+      if (!vertices.empty())
+        traj_link->collision.push_back(createCollision(vertices));
+    }
+    else
+    {
+      std::vector<tesseract::scene_graph::Collision::Ptr> link_collisions(collision_link_names.size());
+      tesseract::common::parallelFor(executor, collision_link_names.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+          tesseract::common::VectorVector3d vertices;
+          for (std::size_t j = 0; j < traj.size(); ++j)
+          {
+            const std::vector<std::string>& active_link_names = active_link_name_sets[state_active_link_set[j]];
+            auto it = std::find(active_link_names.begin(), active_link_names.end(), collision_link_names[i]);
+            if (it == active_link_names.end())
+              continue;
+
+            const Eigen::Isometry3d& link_transform =
+                state_link_transforms[j][static_cast<std::size_t>(std::distance(active_link_names.begin(), it))];
+            for (const auto& v : link_hull_vertices[i])
+              vertices.emplace_back(link_transform * v);
+          }
+
+          link_collisions[i] = createCollision(vertices);
+        }
+      });
+
+      traj_link->collision.insert(traj_link->collision.end(), link_collisions.begin(), link_collisions.end());
     }
-    default:
-      throw std::runtime_error("Environment, unhandled AddTrajectoryLinkCommand::Method type!");
   }
 
   auto traj_joint = std::make_shared<tesseract::scene_graph::Joint>("joint_" + cmd->getLinkName());
@@ -2792,6 +3682,18 @@ void Environment::clearCachedContinuousContactManager() const
   std::as_const<Implementation>(*impl_).clearCachedContinuousContactManager();
 }
 
+DiscreteContactManagerLease Environment::leaseDiscreteContactManager() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return std::as_const<Implementation>(*impl_).leaseDiscreteContactManager();
+}
+
+ContinuousContactManagerLease Environment::leaseContinuousContactManager() const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return std::as_const<Implementation>(*impl_).leaseContinuousContactManager();
+}
+
 tesseract::common::CollisionMarginData Environment::getCollisionMarginData() const
 {
   std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -0,0 +1,299 @@
+/**
+ * @file environment_delta.cpp
+ * @brief Delta synchronization of environments
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_set>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/environment/environment_delta.h>
+#include <tesseract/environment/environment_snapshot.h>
+#include <tesseract/environment/environment.h>
+#include <tesseract/environment/commands.h>
+#include <tesseract/scene_graph/scene_state.h>
+#include <tesseract/common/utils.h>
+
+namespace tesseract::environment
+{
+namespace
+{
+/**
+ * @brief Remove the joints which are changed by a later command from a limits map
+ * @param limits The limits of the earlier command
+ * @param joints The joints changed by later commands, the joints of this command are added
+ * @return The remaining limits
+ */
+template <typename LimitsType>
+LimitsType filterLimits(const LimitsType& limits, std::unordered_set<std::string>& joints)
+{
+  LimitsType remaining;
+  for (const auto& limit : limits)
+  {
+    if (joints.find(limit.first) == joints.end())
+      remaining.insert(limit);
+  }
+
+  for (const auto& limit : limits)
+    joints.insert(limit.first);
+
+  return remaining;
+}
+
+/**
+ * @brief Squash a joint limits command
+ * @param cmd The command
+ * @param joints The joints changed by later commands, the joints of this command are added
+ * @return The command if unchanged, a new command with the remaining limits or nullptr if fully superseded
+ */
+template <typename CommandType>
+std::shared_ptr<const Command> squashLimitsCommand(const std::shared_ptr<const Command>& cmd,
+                                                   std::unordered_set<std::string>& joints)
+{
+  const auto& limits = std::static_pointer_cast<const CommandType>(cmd)->getLimits();
+  auto remaining = filterLimits(limits, joints);
+  if (remaining.empty())
+    return nullptr;
+
+  if (remaining.size() == limits.size())
+    return cmd;
+
+  return std::make_shared<CommandType>(std::move(remaining));
+}
+
+/**
+ * @brief Check if a command changes the structure of the scene graph
+ * @details These commands can add, remove or rename the links and joints referred to by other commands, so commands
+ * are never squashed across them
+ */
+bool isStructuralCommand(CommandType type)
+{
+  switch (type)
+  {
+    case CommandType::ADD_LINK:
+    case CommandType::MOVE_LINK:
+    case CommandType::MOVE_JOINT:
+    case CommandType::REMOVE_LINK:
+    case CommandType::REMOVE_JOINT:
+    case CommandType::REPLACE_JOINT:
+    case CommandType::ADD_SCENE_GRAPH:
+    case CommandType::ADD_TRAJECTORY_LINK:
+      return true;
+    default:
+      return false;
+  }
+}
+}  // namespace
+
+bool EnvironmentDelta::operator==(const EnvironmentDelta& rhs) const
+{
+  auto isometry_equal = [](const Eigen::Isometry3d& iso_1, const Eigen::Isometry3d& iso_2) {
+    return iso_1.isApprox(iso_2, 1e-5);
+  };
+
+  using namespace tesseract::common;
+  bool equal = true;
+  equal &= from_revision == rhs.from_revision;
+  equal &= to_revision == rhs.to_revision;
+  equal &= full == rhs.full;
+  equal &= commands.size() == rhs.commands.size();
+  if (!equal)
+    return equal;
+
+  for (std::size_t i = 0; i < commands.size(); ++i)
+  {
+    equal &= *(commands[i]) == *(rhs.commands[i]);
+    if (!equal)
+      return equal;
+  }
+
+  equal &= isIdenticalMap<std::unordered_map<std::string, double>, double>(joints, rhs.joints);
+  equal &= isIdenticalMap<TransformMap, Eigen::Isometry3d>(floating_joints, rhs.floating_joints, isometry_equal);
+  return equal;
+}
+bool EnvironmentDelta::operator!=(const EnvironmentDelta& rhs) const { return !operator==(rhs); }
+
+Commands squashCommands(const Commands& commands)
+{
+  std::unordered_set<std::string> position_limit_joints;
+  std::unordered_set<std::string> velocity_limit_joints;
+  std::unordered_set<std::string> acceleration_limit_joints;
+  std::unordered_set<std::string> origin_joints;
+  std::unordered_set<std::string> collision_enabled_links;
+  std::unordered_set<std::string> visibility_links;
+  bool discrete_manager_set{ false };
+  bool continuous_manager_set{ false };
+  bool default_margin_set{ false };
+  bool pair_margins_replaced{ false };
+
+  // Walk backwards so every command knows if it is superseded by a later one
+  Commands squashed;
+  squashed.reserve(commands.size());
+  for (auto it = commands.rbegin(); it != commands.rend(); ++it)
+  {
+    const std::shared_ptr<const Command>& cmd = *it;
+    if (isStructuralCommand(cmd->getType()))
+    {
+      // Earlier commands are only superseded by the commands up to this one
+      position_limit_joints.clear();
+      velocity_limit_joints.clear();
+      acceleration_limit_joints.clear();
+      origin_joints.clear();
+      collision_enabled_links.clear();
+      visibility_links.clear();
+      discrete_manager_set = false;
+      continuous_manager_set = false;
+      default_margin_set = false;
+      pair_margins_replaced = false;
+      squashed.push_back(cmd);
+      continue;
+    }
+
+    switch (cmd->getType())
+    {
+      case CommandType::CHANGE_JOINT_POSITION_LIMITS:
+      {
+        if (auto result = squashLimitsCommand<ChangeJointPositionLimitsCommand>(cmd, position_limit_joints))
+          squashed.push_back(result);
+        break;
+      }
+      case CommandType::CHANGE_JOINT_VELOCITY_LIMITS:
+      {
+        if (auto result = squashLimitsCommand<ChangeJointVelocityLimitsCommand>(cmd, velocity_limit_joints))
+          squashed.push_back(result);
+        break;
+      }
+      case CommandType::CHANGE_JOINT_ACCELERATION_LIMITS:
+      {
+        if (auto result = squashLimitsCommand<ChangeJointAccelerationLimitsCommand>(cmd, acceleration_limit_joints))
+          squashed.push_back(result);
+        break;
+      }
+      case CommandType::CHANGE_JOINT_ORIGIN:
+      {
+        const auto& joint_name = std::static_pointer_cast<const ChangeJointOriginCommand>(cmd)->getJointName();
+        if (origin_joints.insert(joint_name).second)
+          squashed.push_back(cmd);
+        break;
+      }
+      case CommandType::CHANGE_LINK_COLLISION_ENABLED:
+      {
+        const auto& link_name = std::static_pointer_cast<const ChangeLinkCollisionEnabledCommand>(cmd)->getLinkName();
+        if (collision_enabled_links.insert(link_name).second)
+          squashed.push_back(cmd);
+        break;
+      }
+      case CommandType::CHANGE_LINK_VISIBILITY:
+      {
+        const auto& link_name = std::static_pointer_cast<const ChangeLinkVisibilityCommand>(cmd)->getLinkName();
+        if (visibility_links.insert(link_name).second)
+          squashed.push_back(cmd);
+        break;
+      }
+      case CommandType::SET_ACTIVE_DISCRETE_CONTACT_MANAGER:
+      {
+        if (!discrete_manager_set)
+          squashed.push_back(cmd);
+        discrete_manager_set = true;
+        break;
+      }
+      case CommandType::SET_ACTIVE_CONTINUOUS_CONTACT_MANAGER:
+      {
+        if (!continuous_manager_set)
+          squashed.push_back(cmd);
+        continuous_manager_set = true;
+        break;
+      }
+      case CommandType::CHANGE_COLLISION_MARGINS:
+      {
+        using tesseract::common::CollisionMarginPairOverrideType;
+        auto margin_cmd = std::static_pointer_cast<const ChangeCollisionMarginsCommand>(cmd);
+        const bool has_default = margin_cmd->getDefaultCollisionMargin().has_value();
+        const bool has_pairs = !margin_cmd->getCollisionMarginPairData().empty();
+        const bool replace =
+            (margin_cmd->getCollisionMarginPairOverrideType() == CollisionMarginPairOverrideType::REPLACE);
+
+        // Pair margins are only superseded by a later replace, a later modify depends on the earlier pairs
+        const bool default_superseded = !has_default || default_margin_set;
+        const bool pairs_superseded = !has_pairs || pair_margins_replaced;
+        if (!default_superseded || !pairs_superseded)
+          squashed.push_back(cmd);
+
+        default_margin_set |= has_default;
+        pair_margins_replaced |= (has_pairs && replace);
+        break;
+      }
+      default:
+        squashed.push_back(cmd);
+    }
+  }
+
+  std::reverse(squashed.begin(), squashed.end());
+  return squashed;
+}
+
+EnvironmentDelta getEnvironmentDelta(const Environment& env, int from_revision, std::size_t max_commands)
+{
+  if (!env.isInitialized())
+    throw std::runtime_error("Environment Delta: The environment is not initialized!");
+
+  // Read the history once, the revision always matches the number of commands in the history
+  const Commands history = env.getCommandHistory();
+
+  EnvironmentDelta delta;
+  delta.from_revision = from_revision;
+  delta.to_revision = static_cast<int>(history.size());
+
+  const bool available = (from_revision >= env.getInitRevision() && from_revision <= delta.to_revision);
+  if (available)
+    delta.commands = squashCommands(Commands(history.begin() + from_revision, history.end()));
+
+  if (!available || delta.commands.size() > max_commands)
+  {
+    delta.full = true;
+    delta.commands = getEnvironmentSnapshotCommands(env);
+  }
+
+  tesseract::scene_graph::SceneState state = env.getState();
+  delta.joints = std::move(state.joints);
+  delta.floating_joints = std::move(state.floating_joints);
+  return delta;
+}
+
+bool applyEnvironmentDelta(Environment& env, const EnvironmentDelta& delta)
+{
+  if (delta.full)
+  {
+    if (!env.init(delta.commands))
+      return false;
+  }
+  else if (!delta.commands.empty() && !env.applyCommands(delta.commands))
+  {
+    return false;
+  }
+
+  env.setState(delta.joints, delta.floating_joints);
+  return true;
+}
+
+}  // namespace tesseract::environment
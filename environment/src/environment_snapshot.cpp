@@ -0,0 +1,188 @@
+/**
+ * @file environment_snapshot.cpp
+ * @brief Binary snapshot of a fully resolved environment
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <exception>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <cereal/archives/binary.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/environment/environment_snapshot.h>
+#include <tesseract/environment/environment.h>
+#include <tesseract/environment/commands.h>
+#include <tesseract/environment/cereal_serialization.h>
+#include <tesseract/collision/discrete_contact_manager.h>
+#include <tesseract/collision/continuous_contact_manager.h>
+#include <tesseract/scene_graph/graph.h>
+#include <tesseract/scene_graph/scene_state.h>
+#include <tesseract/srdf/kinematics_information.h>
+#include <tesseract/common/collision_margin_data.h>
+#include <tesseract/common/plugin_info.h>
+#include <tesseract/common/resource_locator.h>
+
+namespace tesseract::environment
+{
+namespace
+{
+/** @brief The identifier written at the start of every snapshot */
+constexpr std::array<char, 8> SNAPSHOT_MAGIC{ 'T', 'E', 'S', 'S', 'E', 'N', 'V', 'S' };
+
+/** @brief The byte order mark written after the identifier, it reads as 0x04030201 on a host of the other byte order */
+constexpr std::uint32_t SNAPSHOT_BYTE_ORDER_MARK{ 0x01020304 };
+
+void writeSnapshot(std::ostream& os, const Environment& env)
+{
+  const std::uint32_t byte_order_mark{ SNAPSHOT_BYTE_ORDER_MARK };
+  const std::uint32_t version{ ENVIRONMENT_SNAPSHOT_VERSION };
+  os.write(SNAPSHOT_MAGIC.data(), SNAPSHOT_MAGIC.size());
+  os.write(reinterpret_cast<const char*>(&byte_order_mark), sizeof(byte_order_mark));  // NOLINT
+  os.write(reinterpret_cast<const char*>(&version), sizeof(version));                  // NOLINT
+
+  const tesseract::scene_graph::SceneState state = env.getState();
+  {  // Must be scoped because all data is not written until the archive goes out of scope
+    cereal::BinaryOutputArchive oa(os);
+    oa(cereal::make_nvp("name", env.getName()));
+    oa(cereal::make_nvp("resource_locator", env.getResourceLocator()));
+    oa(cereal::make_nvp("commands", getEnvironmentSnapshotCommands(env)));
+    oa(cereal::make_nvp("joints", state.joints));
+    oa(cereal::make_nvp("floating_joints", state.floating_joints));
+  }
+}
+
+std::unique_ptr<Environment> readSnapshot(std::istream& is)
+{
+  std::array<char, 8> magic{};
+  std::uint32_t byte_order_mark{ 0 };
+  std::uint32_t version{ 0 };
+  is.read(magic.data(), magic.size());
+  is.read(reinterpret_cast<char*>(&byte_order_mark), sizeof(byte_order_mark));  // NOLINT
+  is.read(reinterpret_cast<char*>(&version), sizeof(version));                  // NOLINT
+  if (!is || magic != SNAPSHOT_MAGIC)
+    throw std::runtime_error("Environment Snapshot: The data is not an environment snapshot!");
+
+  // The binary archive uses the native byte order, so the snapshot can not be read on a host with the other one
+  if (byte_order_mark == 0x04030201)
+    throw std::runtime_error("Environment Snapshot: The snapshot was saved on a host with a different byte order!");
+
+  if (byte_order_mark != SNAPSHOT_BYTE_ORDER_MARK)
+    throw std::runtime_error("Environment Snapshot: The snapshot has an invalid byte order mark!");
+
+  if (version != ENVIRONMENT_SNAPSHOT_VERSION)
+    throw std::runtime_error("Environment Snapshot: Unsupported snapshot version " + std::to_string(version) +
+                             ", expected " + std::to_string(ENVIRONMENT_SNAPSHOT_VERSION) + "!");
+
+  std::string name;
+  std::shared_ptr<const tesseract::common::ResourceLocator> resource_locator;
+  Commands commands;
+  std::unordered_map<std::string, double> joints;
+  tesseract::common::TransformMap floating_joints;
+  try
+  {
+    cereal::BinaryInputArchive ia(is);
+    ia(cereal::make_nvp("name", name));
+    ia(cereal::make_nvp("resource_locator", resource_locator));
+    ia(cereal::make_nvp("commands", commands));
+    ia(cereal::make_nvp("joints", joints));
+    ia(cereal::make_nvp("floating_joints", floating_joints));
+  }
+  catch (...)
+  {
+    std::throw_with_nested(std::runtime_error("Environment Snapshot: Failed to read the snapshot!"));
+  }
+
+  auto env = std::make_unique<Environment>();
+  if (!env->init(commands))
+    throw std::runtime_error("Environment Snapshot: Failed to initialize the environment from the snapshot!");
+
+  env->setName(name);
+  env->setResourceLocator(resource_locator);
+  env->setState(joints, floating_joints);
+  return env;
+}
+}  // namespace
+
+Commands getEnvironmentSnapshotCommands(const Environment& env)
+{
+  if (!env.isInitialized())
+    throw std::runtime_error("Environment Snapshot: The environment is not initialized!");
+
+  Commands commands;
+  commands.push_back(std::make_shared<AddSceneGraphCommand>(*env.getSceneGraph()));
+  commands.push_back(std::make_shared<AddContactManagersPluginInfoCommand>(env.getContactManagersPluginInfo()));
+  commands.push_back(std::make_shared<AddKinematicsInformationCommand>(env.getKinematicsInformation()));
+
+  if (auto manager = env.getDiscreteContactManager())
+    commands.push_back(std::make_shared<SetActiveDiscreteContactManagerCommand>(manager->getName()));
+
+  if (auto manager = env.getContinuousContactManager())
+    commands.push_back(std::make_shared<SetActiveContinuousContactManagerCommand>(manager->getName()));
+
+  const tesseract::common::CollisionMarginData margin_data = env.getCollisionMarginData();
+  commands.push_back(
+      std::make_shared<ChangeCollisionMarginsCommand>(margin_data.getDefaultCollisionMargin(),
+                                                      margin_data.getCollisionMarginPairData(),
+                                                      tesseract::common::CollisionMarginPairOverrideType::REPLACE));
+
+  return commands;
+}
+
+std::vector<std::uint8_t> toEnvironmentSnapshot(const Environment& env)
+{
+  std::stringstream ss;
+  writeSnapshot(ss, env);
+  const std::string data = ss.str();
+  return { data.begin(), data.end() };
+}
+
+bool toEnvironmentSnapshotFile(const Environment& env, const std::filesystem::path& file_path)
+{
+  std::ofstream os(file_path, std::ios_base::binary);
+  if (!os)
+    return false;
+
+  writeSnapshot(os, env);
+  return static_cast<bool>(os);
+}
+
+std::unique_ptr<Environment> fromEnvironmentSnapshot(const std::vector<std::uint8_t>& data)
+{
+  std::stringstream ss;
+  ss.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));  // NOLINT
+  return readSnapshot(ss);
+}
+
+std::unique_ptr<Environment> fromEnvironmentSnapshotFile(const std::filesystem::path& file_path)
+{
+  std::ifstream is(file_path, std::ios_base::binary);
+  if (!is)
+    throw std::runtime_error("Environment Snapshot: Failed to open file '" + file_path.string() + "'!");
+
+  return readSnapshot(is);
+}
+
+}  // namespace tesseract::environment
@@ -0,0 +1,426 @@
+/**
+ * @file reachability_map.cpp
+ * @brief Cartesian reachability map of a kinematic group
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/environment/reachability_map.h>
+#include <tesseract/environment/environment.h>
+#include <tesseract/kinematics/kinematic_group.h>
+#include <tesseract/kinematics/inverse_kinematics.h>
+#include <tesseract/kinematics/utils.h>
+#include <tesseract/collision/discrete_contact_manager.h>
+#include <tesseract/collision/types.h>
+#include <tesseract/common/task_pool.h>
+#include <tesseract/common/utils.h>
+
+namespace tesseract::environment
+{
+namespace
+{
+/** @brief The identifier written at the start of every reachability map */
+constexpr std::array<char, 8> REACHABILITY_MAP_MAGIC{ 'T', 'E', 'S', 'S', 'R', 'M', 'A', 'P' };
+
+template <typename T>
+void writeValue(std::ostream& os, const T& value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));  // NOLINT
+}
+
+template <typename T>
+T readValue(std::istream& is)
+{
+  T value{};
+  is.read(reinterpret_cast<char*>(&value), sizeof(T));  // NOLINT
+  return value;
+}
+
+void writeString(std::ostream& os, const std::string& value)
+{
+  writeValue(os, static_cast<std::uint64_t>(value.size()));
+  os.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+std::string readString(std::istream& is)
+{
+  std::string value(readValue<std::uint64_t>(is), '\0');
+  is.read(value.data(), static_cast<std::streamsize>(value.size()));
+  return value;
+}
+
+template <typename T>
+void writeVector(std::ostream& os, const std::vector<T>& values)
+{
+  os.write(reinterpret_cast<const char*>(values.data()),  // NOLINT
+           static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+template <typename T>
+void readVector(std::istream& is, std::vector<T>& values)
+{
+  is.read(reinterpret_cast<char*>(values.data()),  // NOLINT
+          static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+}  // namespace
+
+ReachabilityMap::ReachabilityMap(std::string working_frame,
+                                 std::string tip_link_name,
+                                 const Eigen::Vector3d& min_position,
+                                 double resolution,
+                                 const std::array<std::size_t, 3>& dimensions,
+                                 tesseract::common::AlignedVector<Eigen::Quaterniond> orientations)
+  : working_frame_(std::move(working_frame))
+  , tip_link_name_(std::move(tip_link_name))
+  , min_position_(min_position)
+  , resolution_(resolution)
+  , dimensions_(dimensions)
+  , orientations_(std::move(orientations))
+{
+  if (resolution_ <= 0)
+    throw std::runtime_error("ReachabilityMap, the resolution must be greater than zero!");
+
+  const std::size_t size = getVoxelCount() * orientations_.size();
+  solution_counts_.resize(size, 0);
+  manipulability_.resize(size, 0);
+}
+
+const std::string& ReachabilityMap::getWorkingFrame() const { return working_frame_; }
+const std::string& ReachabilityMap::getTipLinkName() const { return tip_link_name_; }
+const Eigen::Vector3d& ReachabilityMap::getMinPosition() const { return min_position_; }
+double ReachabilityMap::getResolution() const { return resolution_; }
+const std::array<std::size_t, 3>& ReachabilityMap::getDimensions() const { return dimensions_; }
+const tesseract::common::AlignedVector<Eigen::Quaterniond>& ReachabilityMap::getOrientations() const
+{
+  return orientations_;
+}
+
+std::size_t ReachabilityMap::getVoxelCount() const { return dimensions_[0] * dimensions_[1] * dimensions_[2]; }
+
+std::size_t ReachabilityMap::getOrientationCount() const { return orientations_.size(); }
+
+std::size_t ReachabilityMap::getVoxelIndex(std::size_t x, std::size_t y, std::size_t z) const
+{
+  return (((z * dimensions_[1]) + y) * dimensions_[0]) + x;
+}
+
+std::optional<std::size_t> ReachabilityMap::findVoxel(const Eigen::Vector3d& position) const
+{
+  std::array<std::size_t, 3> coord{};
+  for (Eigen::Index i = 0; i < 3; ++i)
+  {
+    const double value = std::round((position[i] - min_position_[i]) / resolution_);
+    if (value < 0 || value >= static_cast<double>(dimensions_[static_cast<std::size_t>(i)]))
+      return std::nullopt;
+
+    coord[static_cast<std::size_t>(i)] = static_cast<std::size_t>(value);
+  }
+
+  return getVoxelIndex(coord[0], coord[1], coord[2]);
+}
+
+std::size_t ReachabilityMap::findOrientation(const Eigen::Quaterniond& orientation) const
+{
+  // The angular distance is smallest where the absolute dot product of the quaternions is largest
+  std::size_t index{ 0 };
+  double best{ -1 };
+  for (std::size_t i = 0; i < orientations_.size(); ++i)
+  {
+    const double dot = std::abs(orientations_[i].dot(orientation));
+    if (dot > best)
+    {
+      best = dot;
+      index = i;
+    }
+  }
+  return index;
+}
+
+Eigen::Vector3d ReachabilityMap::getVoxelCenter(std::size_t voxel) const
+{
+  const std::size_t x = voxel % dimensions_[0];
+  const std::size_t y = (voxel / dimensions_[0]) % dimensions_[1];
+  const std::size_t z = voxel / (dimensions_[0] * dimensions_[1]);
+  const Eigen::Vector3d coord(static_cast<double>(x), static_cast<double>(y), static_cast<double>(z));
+  return min_position_ + (resolution_ * coord);
+}
+
+std::uint16_t ReachabilityMap::getSolutionCount(std::size_t voxel, std::size_t orientation) const
+{
+  return solution_counts_.at((voxel * orientations_.size()) + orientation);
+}
+
+float ReachabilityMap::getManipulability(std::size_t voxel, std::size_t orientation) const
+{
+  return manipulability_.at((voxel * orientations_.size()) + orientation);
+}
+
+void ReachabilityMap::setResult(std::size_t voxel,
+                                std::size_t orientation,
+                                std::uint16_t solution_count,
+                                float manipulability)
+{
+  const std::size_t index = (voxel * orientations_.size()) + orientation;
+  solution_counts_.at(index) = solution_count;
+  manipulability_.at(index) = manipulability;
+}
+
+double ReachabilityMap::getReachability(std::size_t voxel) const
+{
+  if (orientations_.empty())
+    return 0;
+
+  const auto begin = solution_counts_.begin() + static_cast<long>(voxel * orientations_.size());
+  const auto count = std::count_if(
+      begin, begin + static_cast<long>(orientations_.size()), [](std::uint16_t value) { return value > 0; });
+  return static_cast<double>(count) / static_cast<double>(orientations_.size());
+}
+
+bool ReachabilityMap::isReachable(const Eigen::Isometry3d& pose) const
+{
+  std::optional<std::size_t> voxel = findVoxel(pose.translation());
+  if (!voxel.has_value() || orientations_.empty())
+    return false;
+
+  return (getSolutionCount(voxel.value(), findOrientation(Eigen::Quaterniond(pose.rotation()))) > 0);
+}
+
+bool ReachabilityMap::saveFile(const std::filesystem::path& file_path) const
+{
+  std::ofstream os(file_path, std::ios_base::binary);
+  if (!os)
+    return false;
+
+  os.write(REACHABILITY_MAP_MAGIC.data(), REACHABILITY_MAP_MAGIC.size());
+  writeValue(os, REACHABILITY_MAP_VERSION);
+  writeString(os, working_frame_);
+  writeString(os, tip_link_name_);
+  for (Eigen::Index i = 0; i < 3; ++i)
+    writeValue(os, min_position_[i]);
+
+  writeValue(os, resolution_);
+  for (std::size_t dimension : dimensions_)
+    writeValue(os, static_cast<std::uint64_t>(dimension));
+
+  writeValue(os, static_cast<std::uint64_t>(orientations_.size()));
+  for (const auto& orientation : orientations_)
+  {
+    for (Eigen::Index i = 0; i < 4; ++i)
+      writeValue(os, orientation.coeffs()[i]);
+  }
+
+  writeVector(os, solution_counts_);
+  writeVector(os, manipulability_);
+  return static_cast<bool>(os);
+}
+
+ReachabilityMap ReachabilityMap::loadFile(const std::filesystem::path& file_path)
+{
+  std::ifstream is(file_path, std::ios_base::binary);
+  if (!is)
+    throw std::runtime_error("ReachabilityMap: Failed to open file '" + file_path.string() + "'!");
+
+  std::array<char, 8> magic{};
+  is.read(magic.data(), magic.size());
+  const auto version = readValue<std::uint32_t>(is);
+  if (!is || magic != REACHABILITY_MAP_MAGIC)
+    throw std::runtime_error("ReachabilityMap: The file is not a reachability map!");
+
+  if (version != REACHABILITY_MAP_VERSION)
+    throw std::runtime_error("ReachabilityMap: Unsupported version " + std::to_string(version) + ", expected " +
+                             std::to_string(REACHABILITY_MAP_VERSION) + "!");
+
+  ReachabilityMap map;
+  map.working_frame_ = readString(is);
+  map.tip_link_name_ = readString(is);
+  for (Eigen::Index i = 0; i < 3; ++i)
+    map.min_position_[i] = readValue<double>(is);
+
+  map.resolution_ = readValue<double>(is);
+  for (std::size_t& dimension : map.dimensions_)
+    dimension = static_cast<std::size_t>(readValue<std::uint64_t>(is));
+
+  const auto orientation_count = static_cast<std::size_t>(readValue<std::uint64_t>(is));
+  if (!is)
+    throw std::runtime_error("ReachabilityMap: Failed to read the header!");
+
+  map.orientations_.resize(orientation_count);
+  for (auto& orientation : map.orientations_)
+  {
+    for (Eigen::Index i = 0; i < 4; ++i)
+      orientation.coeffs()[i] = readValue<double>(is);
+  }
+
+  const std::size_t size = map.getVoxelCount() * orientation_count;
+  map.solution_counts_.resize(size);
+  map.manipulability_.resize(size);
+  readVector(is, map.solution_counts_);
+  readVector(is, map.manipulability_);
+  if (!is)
+    throw std::runtime_error("ReachabilityMap: Failed to read the data!");
+
+  return map;
+}
+
+bool ReachabilityMap::operator==(const ReachabilityMap& rhs) const
+{
+  bool equal = true;
+  equal &= working_frame_ == rhs.working_frame_;
+  equal &= tip_link_name_ == rhs.tip_link_name_;
+  equal &= min_position_.isApprox(rhs.min_position_, 1e-8);
+  equal &= tesseract::common::almostEqualRelativeAndAbs(resolution_, rhs.resolution_);
+  equal &= dimensions_ == rhs.dimensions_;
+  equal &= orientations_.size() == rhs.orientations_.size();
+  if (!equal)
+    return equal;
+
+  for (std::size_t i = 0; i < orientations_.size(); ++i)
+    equal &= orientations_[i].isApprox(rhs.orientations_[i], 1e-8);
+
+  equal &= solution_counts_ == rhs.solution_counts_;
+  equal &= manipulability_ == rhs.manipulability_;
+  return equal;
+}
+bool ReachabilityMap::operator!=(const ReachabilityMap& rhs) const { return !operator==(rhs); }
+
+tesseract::common::AlignedVector<Eigen::Quaterniond> generateReachabilityOrientations(std::size_t approach_count,
+                                                                                      std::size_t rotation_count)
+{
+  tesseract::common::AlignedVector<Eigen::Quaterniond> orientations;
+  orientations.reserve(approach_count * rotation_count);
+
+  const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+  for (std::size_t i = 0; i < approach_count; ++i)
+  {
+    // Spherical Fibonacci lattice, a single direction points along the positive z-axis
+    const double z =
+        (approach_count == 1) ? 1.0 : 1.0 - ((2.0 * static_cast<double>(i)) / static_cast<double>(approach_count - 1));
+    const double radius = std::sqrt(std::max(0.0, 1.0 - (z * z)));
+    const double theta = golden_angle * static_cast<double>(i);
+    const Eigen::Vector3d z_axis(radius * std::cos(theta), radius * std::sin(theta), z);
+    const Eigen::Quaterniond approach = Eigen::Quaterniond::FromTwoVectors(Eigen::Vector3d::UnitZ(), z_axis);
+
+    for (std::size_t j = 0; j < rotation_count; ++j)
+    {
+      const double angle = (2.0 * M_PI * static_cast<double>(j)) / static_cast<double>(rotation_count);
+      orientations.emplace_back(approach * Eigen::AngleAxisd(angle, Eigen::Vector3d::UnitZ()));
+    }
+  }
+
+  return orientations;
+}
+
+ReachabilityMap createReachabilityMap(const Environment& env,
+                                      const ReachabilityMapConfig& config,
+                                      tesseract::common::TaskExecutor& executor)
+{
+  if (config.resolution <= 0)
+    throw std::runtime_error("createReachabilityMap, the resolution must be greater than zero!");
+
+  if (config.orientations.empty())
+    throw std::runtime_error("createReachabilityMap, at least one orientation is required!");
+
+  if ((config.max_position.array() < config.min_position.array()).any())
+    throw std::runtime_error("createReachabilityMap, the max position must not be less than the min position!");
+
+  std::shared_ptr<const tesseract::kinematics::KinematicGroup> kin_group =
+      env.getKinematicGroup(config.group_name, config.ik_solver_name);
+
+  const std::string working_frame = config.working_frame.empty() ? kin_group->getBaseLinkName() : config.working_frame;
+  const std::string tip_link_name =
+      config.tip_link_name.empty() ? kin_group->getInverseKinematics().getTipLinkNames().front() : config.tip_link_name;
+
+  std::array<std::size_t, 3> dimensions{};
+  for (Eigen::Index i = 0; i < 3; ++i)
+  {
+    const double extent = (config.max_position[i] - config.min_position[i]) / config.resolution;
+    dimensions[static_cast<std::size_t>(i)] = static_cast<std::size_t>(std::floor(extent + 1e-9)) + 1;
+  }
+
+  ReachabilityMap map(
+      working_frame, tip_link_name, config.min_position, config.resolution, dimensions, config.orientations);
+
+  const Eigen::VectorXd seed = env.getCurrentJointValues(kin_group->getJointNames());
+  const std::size_t orientation_count = config.orientations.size();
+  tesseract::common::parallelFor(executor, map.getVoxelCount(), [&](std::size_t begin, std::size_t end) {
+    // Solvers may not be thread safe so every task uses its own copy of the kinematic group
+    const tesseract::kinematics::KinematicGroup local_kin_group(*kin_group);
+    DiscreteContactManagerLease lease;
+    if (config.check_collision)
+    {
+      lease = env.leaseDiscreteContactManager();
+      if (!lease)
+        throw std::runtime_error("createReachabilityMap, failed to get the discrete contact manager!");
+    }
+
+    const tesseract::collision::ContactRequest request(tesseract::collision::ContactTestType::FIRST);
+    tesseract::collision::ContactResultMap contacts;
+    tesseract::kinematics::IKSolutions solutions;
+    for (std::size_t voxel = begin; voxel < end; ++voxel)
+    {
+      const Eigen::Vector3d center = map.getVoxelCenter(voxel);
+      for (std::size_t o = 0; o < orientation_count; ++o)
+      {
+        Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+        pose.translation() = center;
+        pose.linear() = config.orientations[o].toRotationMatrix();
+
+        solutions.clear();
+        local_kin_group.calcInvKin(
+            solutions, tesseract::kinematics::KinGroupIKInput(pose, working_frame, tip_link_name), seed);
+
+        std::size_t solution_count{ 0 };
+        double manipulability{ 0 };
+        for (const auto& solution : solutions)
+        {
+          if (lease)
+          {
+            lease->setCollisionObjectsTransform(local_kin_group.calcFwdKin(solution));
+            contacts.clear();
+            lease->contactTest(contacts, request);
+            if (!contacts.empty())
+              continue;
+          }
+
+          ++solution_count;
+          const Eigen::MatrixXd jacobian = local_kin_group.calcJacobian(solution, tip_link_name);
+          manipulability = std::max(manipulability, tesseract::kinematics::calcManipulability(jacobian).m.volume);
+        }
+
+        map.setResult(voxel,
+                      o,
+                      static_cast<std::uint16_t>(
+                          std::min<std::size_t>(solution_count, std::numeric_limits<std::uint16_t>::max())),
+                      static_cast<float>(manipulability));
+      }
+    }
+  });
+
+  return map;
+}
+
+}  // namespace tesseract::environment
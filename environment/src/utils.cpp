@@ -24,17 +24,24 @@
 
 #include <tesseract/collision/utils.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/environment/utils.h>
 #include <tesseract/scene_graph/graph.h>
 #include <tesseract/scene_graph/joint.h>
+#include <tesseract/scene_graph/link.h>
 #include <tesseract/state_solver/state_solver.h>
 #include <tesseract/kinematics/joint_group.h>
 #include <tesseract/collision/discrete_contact_manager.h>
 #include <tesseract/collision/continuous_contact_manager.h>
+#include <tesseract/collision/bounding_spheres.h>
+#include <tesseract/common/task_pool.h>
 
 namespace tesseract::environment
 {
@@ -72,6 +79,91 @@ void getActiveLinkNamesRecursive(std::vector<std::string>& active_links,
   }
 }
 
+LinkMotionBounds calcLinkMotionBounds(const tesseract::scene_graph::SceneGraph& scene_graph,
+                                      const std::vector<std::string>& joint_names)
+{
+  std::unordered_map<std::string, Eigen::Index> joint_indices;
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    auto joint = scene_graph.getJoint(joint_names[i]);
+    if (joint == nullptr)
+      throw std::runtime_error("calcLinkMotionBounds, joint '" + joint_names[i] + "' does not exist!");
+
+    if (joint->type != tesseract::scene_graph::JointType::REVOLUTE &&
+        joint->type != tesseract::scene_graph::JointType::CONTINUOUS &&
+        joint->type != tesseract::scene_graph::JointType::PRISMATIC &&
+        joint->type != tesseract::scene_graph::JointType::FIXED)
+      throw std::runtime_error("calcLinkMotionBounds, joint '" + joint_names[i] + "' has an unsupported type!");
+
+    joint_indices[joint_names[i]] = static_cast<Eigen::Index>(i);
+  }
+
+  LinkMotionBounds link_motion_bounds;
+  for (const auto& link : scene_graph.getLinks())
+  {
+    if (link->collision.empty())
+      continue;
+
+    // The distance from the link origin to the farthest point of its collision geometry
+    double reach{ 0 };
+    for (const auto& collision : link->collision)
+    {
+      const tesseract::collision::BoundingSphere sphere =
+          tesseract::collision::computeBoundingSphere(*collision->geometry);
+      reach = std::max(reach, (collision->origin * sphere.center).norm() + sphere.radius);
+    }
+
+    // Walk up the chain, the child link frame is the joint frame so the reach is the lever arm of each joint
+    Eigen::VectorXd bounds = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size()));
+    bool moved{ false };
+    std::string current_link = link->getName();
+    std::vector<std::shared_ptr<const tesseract::scene_graph::Joint>> inbound_joints =
+        scene_graph.getInboundJoints(current_link);
+    while (!inbound_joints.empty())
+    {
+      const auto& joint = inbound_joints.front();
+      double bound{ 0 };
+      if (joint->type == tesseract::scene_graph::JointType::REVOLUTE ||
+          joint->type == tesseract::scene_graph::JointType::CONTINUOUS)
+        bound = reach;
+      else if (joint->type == tesseract::scene_graph::JointType::PRISMATIC)
+        bound = 1;
+
+      auto it = joint_indices.find(joint->getName());
+      if (it != joint_indices.end())
+      {
+        bounds(it->second) += bound;
+        moved = true;
+      }
+      else if (joint->mimic != nullptr)
+      {
+        it = joint_indices.find(joint->mimic->joint_name);
+        if (it != joint_indices.end())
+        {
+          bounds(it->second) += std::abs(joint->mimic->multiplier) * bound;
+          moved = true;
+        }
+      }
+
+      reach += joint->parent_to_joint_origin_transform.translation().norm();
+      if (joint->type == tesseract::scene_graph::JointType::PRISMATIC)
+        reach += (joint->limits != nullptr) ? std::max(std::abs(joint->limits->lower), std::abs(joint->limits->upper)) :
+                                              std::numeric_limits<double>::infinity();
+      else if (joint->type == tesseract::scene_graph::JointType::FLOATING ||
+               joint->type == tesseract::scene_graph::JointType::PLANAR)
+        reach = std::numeric_limits<double>::infinity();
+
+      current_link = joint->parent_link_name;
+      inbound_joints = scene_graph.getInboundJoints(current_link);
+    }
+
+    if (moved)
+      link_motion_bounds[link->getName()] = bounds;
+  }
+
+  return link_motion_bounds;
+}
+
 void checkTrajectorySegment(tesseract::collision::ContactResultMap& contact_results,
                             tesseract::collision::ContinuousContactManager& manager,
                             const tesseract::common::TransformMap& state0,
@@ -152,8 +244,353 @@ void printDiscreteDebugInfo(const std::vector<std::string>& joint_names,
   CONSOLE_BRIDGE_logDebug(ss.str().c_str());
 }
 
+namespace
+{
+/** @brief Sum the motion bound of a link over the joint motion, joints which do not move are skipped */
+double calcLinkMotion(const Eigen::VectorXd& bounds, const Eigen::VectorXd& delta)
+{
+  double motion{ 0 };
+  for (Eigen::Index i = 0; i < delta.size(); ++i)
+  {
+    if (std::abs(delta(i)) > 0)
+      motion += bounds(i) * std::abs(delta(i));
+  }
+  return motion;
+}
+
+/**
+ * @brief Performs the discrete state checks of the LVS trajectory checks using conservative advancement
+ * @details When link motion bounds are provided each state is checked for the closest distance of each pair on a clone
+ * of the manager whose collision margins are extended by a lookahead distance. The clearance to the original collision
+ * margin and the link motion bounds determine how many substeps are guaranteed to be collision free. Only if a pair is
+ * within the original collision margin the state is checked again on the manager with its original margins and the
+ * contact request, so the contacts are identical to checking every substep and the margins of the manager are never
+ * changed.
+ *
+ * If no link motion bounds are provided every state is checked with checkTrajectoryState and no substeps are skipped.
+ */
+class ConservativeAdvancementChecker
+{
+public:
+  ConservativeAdvancementChecker(tesseract::collision::DiscreteContactManager& manager,
+                                 const tesseract::collision::CollisionCheckConfig& config,
+                                 const LinkMotionBounds& link_motion_bounds,
+                                 const tesseract::common::TrajArray& traj,
+                                 DiscreteContactManagerPool* pool)
+    : manager_(manager)
+    , pool_(pool)
+    , contact_request_(config.contact_request)
+    , lookahead_request_(config.contact_request)
+    , margin_data_(manager.getCollisionMarginData())
+  {
+    if (link_motion_bounds.empty())
+      return;
+
+    for (const auto& link_name : manager_.getActiveCollisionObjects())
+    {
+      auto it = link_motion_bounds.find(link_name);
+      if (it == link_motion_bounds.end())
+        continue;
+
+      if (it->second.size() != traj.cols())
+        throw std::runtime_error("checkTrajectory, link motion bounds size does not match the trajectory!");
+
+      link_bounds_[link_name] = &it->second;
+    }
+
+    // The lookahead is the largest motion of any link over a single segment which gets subdivided
+    for (tesseract::common::TrajArray::Index i = 0; i < traj.rows() - 1; ++i)
+    {
+      const Eigen::VectorXd delta = traj.row(i + 1) - traj.row(i);
+      if (delta.norm() <= config.longest_valid_segment_length)
+        continue;
+
+      for (const auto& link_bounds : link_bounds_)
+      {
+        const double motion = calcLinkMotion(*link_bounds.second, delta);
+        if (std::isfinite(motion))
+          lookahead_ = std::max(lookahead_, motion);
+      }
+    }
+
+    if (lookahead_ > 0)
+    {
+      lookahead_request_.type = tesseract::collision::ContactTestType::CLOSEST;
+      lookahead_margin_data_ = margin_data_;
+      lookahead_margin_data_.incrementMargins(lookahead_);
+      lookahead_manager_ = (pool_ != nullptr) ? pool_->acquire(manager_) : manager_.clone();
+      lookahead_manager_->setCollisionMarginData(lookahead_margin_data_);
+    }
+  }
+
+  ~ConservativeAdvancementChecker()
+  {
+    if (lookahead_manager_ == nullptr || pool_ == nullptr)
+      return;
+
+    // The pooled clones must match the manager
+    lookahead_manager_->setCollisionMarginData(margin_data_);
+    pool_->release(std::move(lookahead_manager_));
+  }
+  ConservativeAdvancementChecker(const ConservativeAdvancementChecker&) = delete;
+  ConservativeAdvancementChecker& operator=(const ConservativeAdvancementChecker&) = delete;
+  ConservativeAdvancementChecker(ConservativeAdvancementChecker&&) = delete;
+  ConservativeAdvancementChecker& operator=(ConservativeAdvancementChecker&&) = delete;
+
+  /**
+   * @brief Check a state and compute the number of substeps which are guaranteed to be collision free
+   * @param contact_results The contact results to populate. It does not get cleared
+   * @param state The environment state
+   * @param segment_delta The joint motion of the segment being subdivided, empty if the state is not a substep
+   * @param segment_last_index The last substep index of the segment being subdivided
+   * @return The number of substeps to advance to the next state which must be checked, at least one
+   */
+  tesseract::common::TrajArray::Index checkState(tesseract::collision::ContactResultMap& contact_results,
+                                                 const tesseract::common::TransformMap& state,
+                                                 const Eigen::VectorXd& segment_delta = Eigen::VectorXd(),
+                                                 tesseract::common::TrajArray::Index segment_last_index = 0)
+  {
+    if (lookahead_ <= 0)
+    {
+      checkTrajectoryState(contact_results, manager_, state, contact_request_);
+      return 1;
+    }
+
+    lookahead_results_.clear();
+    checkTrajectoryState(lookahead_results_, *lookahead_manager_, state, lookahead_request_);
+
+    // The fraction of the segment which can be advanced, in the worst case two links move towards each other
+    double fraction = std::numeric_limits<double>::infinity();
+    double max_motion{ 0 };
+    double second_max_motion{ 0 };
+    if (segment_delta.size() > 0)
+    {
+      for (const auto& link_bounds : link_bounds_)
+      {
+        const double motion = calcLinkMotion(*link_bounds.second, segment_delta);
+        if (motion > max_motion)
+        {
+          second_max_motion = max_motion;
+          max_motion = motion;
+        }
+        else if (motion > second_max_motion)
+        {
+          second_max_motion = motion;
+        }
+      }
+
+      if ((max_motion + second_max_motion) > 0)
+        fraction = lookahead_ / (max_motion + second_max_motion);
+    }
+
+    for (const auto& pair : lookahead_results_)
+    {
+      const double margin = margin_data_.getCollisionMargin(pair.first.first, pair.first.second);
+      for (const auto& result : pair.second)
+      {
+        const double clearance = result.distance - margin;
+        if (clearance <= 0)
+        {
+          // In contact so check again using the original collision margins and contact request
+          checkTrajectoryState(contact_results, manager_, state, contact_request_);
+          return 1;
+        }
+
+        if (segment_delta.size() > 0)
+        {
+          const double motion = getLinkMotion(pair.first.first, segment_delta) +
+                                getLinkMotion(pair.first.second, segment_delta);
+          if (motion > 0)
+            fraction = std::min(fraction, clearance / motion);
+        }
+      }
+    }
+
+    // Every substep closer than the clearance cannot be in collision
+    const double substeps = std::floor(fraction * static_cast<double>(segment_last_index));
+    if (!(substeps >= 1))
+      return 1;
+
+    if (substeps >= static_cast<double>(segment_last_index))
+      return std::max<tesseract::common::TrajArray::Index>(segment_last_index, 1);
+
+    return static_cast<tesseract::common::TrajArray::Index>(substeps);
+  }
+
+private:
+  tesseract::collision::DiscreteContactManager& manager_;
+  DiscreteContactManagerPool* pool_;
+  std::unique_ptr<tesseract::collision::DiscreteContactManager> lookahead_manager_;
+  const tesseract::collision::ContactRequest& contact_request_;
+  tesseract::collision::ContactRequest lookahead_request_;
+  tesseract::collision::CollisionMarginData margin_data_;
+  tesseract::collision::CollisionMarginData lookahead_margin_data_;
+  tesseract::collision::ContactResultMap lookahead_results_;
+  std::unordered_map<std::string, const Eigen::VectorXd*> link_bounds_;
+  double lookahead_{ 0 };
+
+  double getLinkMotion(const std::string& link_name, const Eigen::VectorXd& delta) const
+  {
+    auto it = link_bounds_.find(link_name);
+    return (it == link_bounds_.end()) ? 0 : calcLinkMotion(*it->second, delta);
+  }
+};
+}  // namespace
+
 using CalcStateFn = std::function<tesseract::common::TransformMap(const Eigen::VectorXd& state)>;
 
+namespace
+{
+/** @brief The results of a single entry of the contacts returned by the discrete checkTrajectory */
+struct TrajectoryEntryResults
+{
+  struct Contact
+  {
+    int step{ 0 };
+    int substep{ 0 };
+    int num_substeps{ 1 };
+    Eigen::VectorXd start_state;
+    Eigen::VectorXd end_state;
+    Eigen::VectorXd substate;
+    tesseract::collision::ContactResultMap contacts;
+  };
+
+  tesseract::collision::ContactResultMap state_results;
+  std::vector<Contact> contacts;
+};
+
+/**
+ * @brief Get the number of entries of the contacts returned by the discrete checkTrajectory
+ * @details For LVS entry i is the segment starting at state i and the last entry is the end state, otherwise entry i is
+ * state i. The start state entry is left empty if it is skipped and there is no end state entry if it is skipped.
+ */
+std::size_t getTrajectoryEntryCount(const tesseract::common::TrajArray& traj,
+                                    const tesseract::collision::CollisionCheckConfig& config)
+{
+  using tesseract::collision::CollisionCheckProgramType;
+  const bool skip_end = (config.check_program_mode == CollisionCheckProgramType::ALL_EXCEPT_END ||
+                         config.check_program_mode == CollisionCheckProgramType::INTERMEDIATE_ONLY);
+  return static_cast<std::size_t>((skip_end) ? traj.rows() - 1 : traj.rows());
+}
+
+/**
+ * @brief Check a single entry of the discrete checkTrajectory, see getTrajectoryEntryCount()
+ * @param entry The entry results to populate
+ * @param checker The state checker of the contact manager
+ * @param active_links The active collision objects of the contact manager
+ * @param state_fn The function computing the link transforms of a joint state
+ * @param traj The trajectory
+ * @param config The collision check config
+ * @param step The entry index
+ * @param sub_state_results Scratch contact results which are reused between calls
+ */
+void checkTrajectoryEntry(TrajectoryEntryResults& entry,
+                          ConservativeAdvancementChecker& checker,
+                          const std::vector<std::string>& active_links,
+                          const CalcStateFn& state_fn,
+                          const tesseract::common::TrajArray& traj,
+                          const tesseract::collision::CollisionCheckConfig& config,
+                          tesseract::common::TrajArray::Index step,
+                          tesseract::collision::ContactResultMap& sub_state_results)
+{
+  using tesseract::collision::CollisionCheckProgramType;
+  const bool lvs = (config.type != tesseract::collision::CollisionEvaluatorType::DISCRETE);
+  const bool skip_start = (config.check_program_mode == CollisionCheckProgramType::ALL_EXCEPT_START ||
+                           config.check_program_mode == CollisionCheckProgramType::INTERMEDIATE_ONLY);
+  const bool stop_at_contact = (config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST ||
+                                config.exit_condition == tesseract::collision::CollisionCheckExitType::ONE_PER_STEP);
+
+  const auto addContact = [&entry, &sub_state_results](int step_number,
+                                                        int substep_number,
+                                                        int num_substeps,
+                                                        const Eigen::VectorXd& start_state,
+                                                        const Eigen::VectorXd& end_state,
+                                                        const Eigen::VectorXd& substate) {
+    entry.contacts.push_back(
+        { step_number, substep_number, num_substeps, start_state, end_state, substate, sub_state_results });
+  };
+
+  const double dist = (lvs && step < traj.rows() - 1) ? (traj.row(step + 1) - traj.row(step)).norm() : 0;
+  if (dist > config.longest_valid_segment_length)
+  {
+    int cnt = static_cast<int>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
+    tesseract::common::TrajArray subtraj(cnt, traj.cols());
+    for (tesseract::common::TrajArray::Index iVar = 0; iVar < traj.cols(); ++iVar)
+      subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, traj.row(step)(iVar), traj.row(step + 1)(iVar));
+
+    auto sub_segment_last_index = static_cast<int>(subtraj.rows() - 1);
+    tesseract::common::TrajArray::Index start_idx{ (step == 0 && skip_start) ? 1 : 0 };
+    tesseract::common::TrajArray::Index end_idx{ subtraj.rows() - 1 };
+
+    const Eigen::VectorXd segment_delta = traj.row(step + 1) - traj.row(step);
+    tesseract::common::TrajArray::Index sub_step_size{ 1 };
+    for (auto iSubStep = start_idx; iSubStep < end_idx; iSubStep += sub_step_size)
+    {
+      tesseract::common::TransformMap state = state_fn(subtraj.row(iSubStep));
+      sub_state_results.clear();
+      sub_step_size = checker.checkState(sub_state_results, state, segment_delta, sub_segment_last_index);
+      if (!sub_state_results.empty())
+      {
+        addContact(static_cast<int>(step),
+                   static_cast<int>(iSubStep),
+                   static_cast<int>(end_idx),
+                   traj.row(step),
+                   traj.row(step + 1),
+                   subtraj.row(iSubStep));
+        double segment_dt = (sub_segment_last_index > 0) ? 1.0 / static_cast<double>(sub_segment_last_index) : 0.0;
+        entry.state_results.addInterpolatedCollisionResults(
+            sub_state_results, iSubStep, sub_segment_last_index, active_links, segment_dt, true);
+
+        if (stop_at_contact)
+          break;
+      }
+    }
+  }
+  else if (!(step == 0 && skip_start))
+  {
+    tesseract::common::TransformMap state = state_fn(traj.row(step));
+    sub_state_results.clear();
+    checker.checkState(sub_state_results, state);
+    if (!sub_state_results.empty())
+    {
+      addContact(static_cast<int>(step), 0, 1, traj.row(step), traj.row(step), traj.row(step));
+      entry.state_results.addInterpolatedCollisionResults(sub_state_results, 0, 0, active_links, 0, true);
+    }
+  }
+}
+
+/**
+ * @brief Add the checked entries to the contacts and the trajectory results
+ * @details If the exit condition is FIRST the entries after the first entry in collision are ignored
+ */
+void collectTrajectoryEntries(std::vector<tesseract::collision::ContactResultMap>& contacts,
+                              tesseract::collision::ContactTrajectoryResults& traj_contacts,
+                              std::vector<TrajectoryEntryResults>& entries,
+                              const tesseract::collision::CollisionCheckConfig& config)
+{
+  contacts.clear();
+  contacts.reserve(entries.size());
+  for (auto& entry : entries)
+  {
+    for (const auto& contact : entry.contacts)
+    {
+      traj_contacts.addContact(contact.step,
+                               contact.substep,
+                               contact.num_substeps,
+                               contact.start_state,
+                               contact.end_state,
+                               contact.substate,
+                               contact.substate,
+                               contact.contacts);
+    }
+
+    contacts.push_back(std::move(entry.state_results));
+    if (config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST && !contacts.back().empty())
+      break;
+  }
+}
+}  // namespace
+
 tesseract::collision::ContactTrajectoryResults
 checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
                 tesseract::collision::ContinuousContactManager& manager,
@@ -433,10 +870,13 @@ checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
                 const CalcStateFn& state_fn,
                 const std::vector<std::string>& joint_names,
                 const tesseract::common::TrajArray& traj,
-                const tesseract::collision::CollisionCheckConfig& config)
+                const tesseract::collision::CollisionCheckConfig& config,
+                const LinkMotionBounds& link_motion_bounds,
+                DiscreteContactManagerPool* pool)
 {
   if (config.type != tesseract::collision::CollisionEvaluatorType::DISCRETE &&
-      config.type != tesseract::collision::CollisionEvaluatorType::LVS_DISCRETE)
+      config.type != tesseract::collision::CollisionEvaluatorType::LVS_DISCRETE &&
+      config.type != tesseract::collision::CollisionEvaluatorType::ADAPTIVE_LVS_DISCRETE)
     throw std::runtime_error("checkTrajectory was given an CollisionEvaluatorType that is inconsistent with the "
                              "ContactManager type");
 
@@ -526,235 +966,188 @@ checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
     return traj_contacts;
   }
 
-  if (config.type == tesseract::collision::CollisionEvaluatorType::LVS_DISCRETE)
+  // A two state trajectory whose segment is not subdivided has no intermediate states
+  if (config.type != tesseract::collision::CollisionEvaluatorType::DISCRETE &&
+      config.check_program_mode == tesseract::collision::CollisionCheckProgramType::INTERMEDIATE_ONLY &&
+      traj.rows() == 2 && (traj.row(1) - traj.row(0)).norm() <= config.longest_valid_segment_length)
+    return traj_contacts;
+
+  std::vector<TrajectoryEntryResults> entries(getTrajectoryEntryCount(traj, config));
   {
-    for (int iStep = 0; iStep < (traj.rows() - 1); ++iStep)
+    // Scoped so the lookahead clone is released before returning
+    const LinkMotionBounds no_link_motion_bounds;
+    const bool adaptive = (config.type == tesseract::collision::CollisionEvaluatorType::ADAPTIVE_LVS_DISCRETE);
+    ConservativeAdvancementChecker checker(
+        manager, config, (adaptive) ? link_motion_bounds : no_link_motion_bounds, traj, pool);
+    const std::vector<std::string>& active_links = manager.getActiveCollisionObjects();
+    for (std::size_t i = 0; i < entries.size(); ++i)
     {
-      state_results.clear();
+      checkTrajectoryEntry(entries[i],
+                           checker,
+                           active_links,
+                           state_fn,
+                           traj,
+                           config,
+                           static_cast<tesseract::common::TrajArray::Index>(i),
+                           sub_state_results);
+
+      if (config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST &&
+          !entries[i].state_results.empty())
+        break;
+    }
+  }
+  collectTrajectoryEntries(contacts, traj_contacts, entries, config);
 
-      const double dist = (traj.row(iStep + 1) - traj.row(iStep)).norm();
-      if (dist > config.longest_valid_segment_length)
-      {
-        int cnt = static_cast<int>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-        tesseract::common::TrajArray subtraj(cnt, traj.cols());
-        for (tesseract::common::TrajArray::Index iVar = 0; iVar < traj.cols(); ++iVar)
-          subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, traj.row(iStep)(iVar), traj.row(iStep + 1)(iVar));
+  if (traj_contacts && debug_logging)
+    std::cout << traj_contacts.trajectoryCollisionResultsTable().str();
 
-        auto sub_segment_last_index = static_cast<int>(subtraj.rows() - 1);
+  return traj_contacts;
+}
 
-        // Update start index based on collision check program mode
-        tesseract::common::TrajArray::Index start_idx{ 0 };
-        tesseract::common::TrajArray::Index end_idx{ subtraj.rows() - 1 };
-        if (iStep == 0)
-        {
-          if (config.check_program_mode == tesseract::collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
-              config.check_program_mode == tesseract::collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-            ++start_idx;
-        }
+tesseract::collision::ContactTrajectoryResults
+checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
+                tesseract::collision::DiscreteContactManager& manager,
+                const tesseract::scene_graph::StateSolver& state_solver,
+                const std::vector<std::string>& joint_names,
+                const tesseract::common::TrajArray& traj,
+                const tesseract::collision::CollisionCheckConfig& config,
+                const LinkMotionBounds& link_motion_bounds,
+                DiscreteContactManagerPool* pool)
+{
+  CalcStateFn state_fn = [&joint_names, &state_solver](const Eigen::VectorXd& state) {
+    return state_solver.getState(joint_names, state).link_transforms;
+  };
 
-        for (tesseract::common::TrajArray::Index iSubStep = start_idx; iSubStep < end_idx; ++iSubStep)
-        {
-          tesseract::common::TransformMap state = state_fn(subtraj.row(iSubStep));
-          sub_state_results.clear();
-          checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
-          if (!sub_state_results.empty())
-          {
-            traj_contacts.addContact(iStep,
-                                     static_cast<int>(iSubStep),
-                                     static_cast<int>(end_idx),
-                                     traj.row(iStep),
-                                     traj.row(iStep + 1),
-                                     subtraj.row(iSubStep),
-                                     subtraj.row(iSubStep),
-                                     sub_state_results);
-            double segment_dt = (sub_segment_last_index > 0) ? 1.0 / static_cast<double>(sub_segment_last_index) : 0.0;
-            state_results.addInterpolatedCollisionResults(sub_state_results,
-                                                          iSubStep,
-                                                          sub_segment_last_index,
-                                                          manager.getActiveCollisionObjects(),
-                                                          segment_dt,
-                                                          true);
-            if (config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST)
-            {
-              // Break out of substep loop and outer step loop
-              iSubStep = end_idx;  // ensure exit
-            }
-            else if (config.exit_condition == tesseract::collision::CollisionCheckExitType::ONE_PER_STEP)
-            {
-              // Stop checking further substates for this step
-              break;
-            }
-          }
-        }
-        contacts.push_back(state_results);
+  return checkTrajectory(contacts, manager, state_fn, joint_names, traj, config, link_motion_bounds, pool);
+}
 
-        if (config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST && !state_results.empty())
-          break;
-      }
-      else
-      {
-        // Special case for two state trajectory
-        if (iStep == 0 && traj.rows() == 2)
-        {
-          if (config.check_program_mode != tesseract::collision::CollisionCheckProgramType::ALL_EXCEPT_START &&
-              config.check_program_mode != tesseract::collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-          {
-            tesseract::common::TransformMap state = state_fn(traj.row(iStep));
-            sub_state_results.clear();
-            checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
-            if (!sub_state_results.empty())
-            {
-              traj_contacts.addContact(
-                  iStep, 0, 1, traj.row(iStep), traj.row(iStep), traj.row(iStep), traj.row(iStep), sub_state_results);
-              state_results.addInterpolatedCollisionResults(
-                  sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
-              if (config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST)
-              {
-                contacts.push_back(state_results);
-                break;
-              }
-            }
-            contacts.push_back(state_results);
-          }
+tesseract::collision::ContactTrajectoryResults
+checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
+                tesseract::collision::DiscreteContactManager& manager,
+                const tesseract::kinematics::JointGroup& manip,
+                const tesseract::common::TrajArray& traj,
+                const tesseract::collision::CollisionCheckConfig& config,
+                const LinkMotionBounds& link_motion_bounds,
+                DiscreteContactManagerPool* pool)
+{
+  CalcStateFn state_fn = [&manip](const Eigen::VectorXd& state) { return manip.calcFwdKin(state); };
 
-          if (config.check_program_mode != tesseract::collision::CollisionCheckProgramType::ALL_EXCEPT_END &&
-              config.check_program_mode != tesseract::collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-          {
-            // Need to add empty start state if checking the end state and start was skipped
-            if (config.check_program_mode == tesseract::collision::CollisionCheckProgramType::ALL_EXCEPT_START)
-              contacts.push_back(state_results);
-
-            state_results.clear();
-            tesseract::common::TransformMap state = state_fn(traj.row(iStep + 1));
-            sub_state_results.clear();
-            checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
-            if (!sub_state_results.empty())
-            {
-              traj_contacts.addContact(iStep + 1,
-                                       0,
-                                       1,
-                                       traj.row(iStep + 1),
-                                       traj.row(iStep + 1),
-                                       traj.row(iStep + 1),
-                                       traj.row(iStep + 1),
-                                       sub_state_results);
-              state_results.addInterpolatedCollisionResults(
-                  sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
-              if (config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST)
-              {
-                contacts.push_back(state_results);
-                break;
-              }
-            }
-            contacts.push_back(state_results);
-          }
-          break;
-        }
+  const std::vector<std::string> joint_names = manip.getJointNames();
+  return checkTrajectory(contacts, manager, state_fn, joint_names, traj, config, link_motion_bounds, pool);
+}
 
-        if (iStep == 0)
-        {
-          if (config.check_program_mode == tesseract::collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
-              config.check_program_mode == tesseract::collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-          {
-            contacts.emplace_back();
-            continue;
-          }
-        }
+DiscreteContactManagerPool::DiscreteContactManagerPool() = default;
+DiscreteContactManagerPool::~DiscreteContactManagerPool() = default;
 
-        tesseract::common::TransformMap state = state_fn(traj.row(iStep));
-        sub_state_results.clear();
-        checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
-        if (!sub_state_results.empty())
-        {
-          traj_contacts.addContact(
-              iStep, 0, 1, traj.row(iStep), traj.row(iStep), traj.row(iStep), traj.row(iStep), sub_state_results);
-          state_results.addInterpolatedCollisionResults(
-              sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
+std::unique_ptr<tesseract::collision::DiscreteContactManager>
+DiscreteContactManagerPool::acquire(const tesseract::collision::DiscreteContactManager& manager)
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!clones_.empty())
+    {
+      std::unique_ptr<tesseract::collision::DiscreteContactManager> clone = std::move(clones_.back());
+      clones_.pop_back();
+      if (clone->getName() == manager.getName())
+        return clone;
+    }
+  }
 
-          // Exit behavior
-          if (config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST)
-          {
-            contacts.push_back(state_results);
-            break;
-          }
-        }
+  return manager.clone();
+}
 
-        contacts.push_back(state_results);
-      }
-      // If last segment check the end state
-      if (iStep == (traj.rows() - 2))
-      {
-        state_results.clear();
-        if (config.check_program_mode == tesseract::collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
-            config.check_program_mode == tesseract::collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-        {
-          continue;
-        }
+void DiscreteContactManagerPool::release(std::unique_ptr<tesseract::collision::DiscreteContactManager> clone)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  clones_.push_back(std::move(clone));
+}
 
-        tesseract::common::TransformMap state = state_fn(traj.row(iStep + 1));
-        sub_state_results.clear();
-        checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
-        if (!sub_state_results.empty())
-        {
-          traj_contacts.addContact(iStep + 1,
-                                   0,
-                                   1,
-                                   traj.row(iStep + 1),
-                                   traj.row(iStep + 1),
-                                   traj.row(iStep + 1),
-                                   traj.row(iStep + 1),
-                                   sub_state_results);
-          state_results.addInterpolatedCollisionResults(
-              sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
-        }
-        contacts.push_back(state_results);
-      }
-    }
-  }
-  else
-  {
-    tesseract::common::TrajArray::Index start_idx{ 0 };
-    tesseract::common::TrajArray::Index end_idx(traj.rows());
+void DiscreteContactManagerPool::clear()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  clones_.clear();
+}
 
-    if (config.check_program_mode == tesseract::collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
-        config.check_program_mode == tesseract::collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-    {
-      contacts.emplace_back();
-      ++start_idx;
-    }
+std::size_t DiscreteContactManagerPool::size() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return clones_.size();
+}
 
-    if (config.check_program_mode == tesseract::collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
-        config.check_program_mode == tesseract::collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-      --end_idx;
+tesseract::collision::ContactTrajectoryResults
+checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
+                tesseract::collision::DiscreteContactManager& manager,
+                const CalcStateFn& state_fn,
+                const std::vector<std::string>& joint_names,
+                const tesseract::common::TrajArray& traj,
+                const tesseract::collision::CollisionCheckConfig& config,
+                tesseract::common::TaskExecutor& executor,
+                const LinkMotionBounds& link_motion_bounds,
+                DiscreteContactManagerPool* pool)
+{
+  using tesseract::collision::CollisionCheckProgramType;
+  using tesseract::collision::CollisionEvaluatorType;
 
-    for (tesseract::common::TrajArray::Index iStep = start_idx; iStep < end_idx; ++iStep)
-    {
-      state_results.clear();
+  // Checking one or two states is not worth parallelizing
+  if (executor.getThreadCount() == 0 || traj.rows() < 3 ||
+      config.check_program_mode == CollisionCheckProgramType::START_ONLY ||
+      config.check_program_mode == CollisionCheckProgramType::END_ONLY)
+    return checkTrajectory(contacts, manager, state_fn, joint_names, traj, config, link_motion_bounds, pool);
 
-      tesseract::common::TransformMap state = state_fn(traj.row(iStep));
-      sub_state_results.clear();
-      checkTrajectoryState(sub_state_results, manager, state, config.contact_request);
-      if (!sub_state_results.empty())
+  if (config.type != CollisionEvaluatorType::DISCRETE && config.type != CollisionEvaluatorType::LVS_DISCRETE &&
+      config.type != CollisionEvaluatorType::ADAPTIVE_LVS_DISCRETE)
+    throw std::runtime_error("checkTrajectory was given an CollisionEvaluatorType that is inconsistent with the "
+                             "ContactManager type");
+
+  const bool adaptive = (config.type == CollisionEvaluatorType::ADAPTIVE_LVS_DISCRETE);
+  const bool exit_first = (config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST);
+  const std::size_t entry_count = getTrajectoryEntryCount(traj, config);
+  std::vector<TrajectoryEntryResults> entries(entry_count);
+
+  // The entries after the first collision are not needed if the exit condition is FIRST
+  std::atomic<std::size_t> first_collision{ entry_count };
+
+  const LinkMotionBounds no_link_motion_bounds;
+  DiscreteContactManagerPool local_pool;
+  DiscreteContactManagerPool& manager_pool = (pool != nullptr) ? *pool : local_pool;
+  tesseract::common::parallelFor(executor, entry_count, [&](std::size_t begin, std::size_t end) {
+    std::unique_ptr<tesseract::collision::DiscreteContactManager> local_manager = manager_pool.acquire(manager);
+    {
+      // Scoped so the lookahead clone is returned to the pool before the clone of the task
+      ConservativeAdvancementChecker checker(
+          *local_manager, config, (adaptive) ? link_motion_bounds : no_link_motion_bounds, traj, &manager_pool);
+      const std::vector<std::string>& active_links = local_manager->getActiveCollisionObjects();
+      tesseract::collision::ContactResultMap sub_state_results;
+      for (std::size_t i = begin; i < end; ++i)
       {
-        traj_contacts.addContact(static_cast<int>(iStep),
-                                 0,
-                                 1,
-                                 traj.row(iStep),
-                                 traj.row(iStep),
-                                 traj.row(iStep),
-                                 traj.row(iStep),
-                                 sub_state_results);
-        state_results.addInterpolatedCollisionResults(
-            sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
-      }
-      contacts.push_back(state_results);
+        if (i > first_collision)
+          break;
 
-      if (!sub_state_results.empty() && config.exit_condition == tesseract::collision::CollisionCheckExitType::FIRST)
-        break;
+        checkTrajectoryEntry(entries[i],
+                             checker,
+                             active_links,
+                             state_fn,
+                             traj,
+                             config,
+                             static_cast<tesseract::common::TrajArray::Index>(i),
+                             sub_state_results);
+
+        if (exit_first && !entries[i].state_results.empty())
+        {
+          std::size_t current = first_collision;
+          while (i < current && !first_collision.compare_exchange_weak(current, i))
+          {
+          }
+        }
+      }
     }
-  }
+    manager_pool.release(std::move(local_manager));
+  });
 
-  if (traj_contacts && debug_logging)
+  tesseract::collision::ContactTrajectoryResults traj_contacts(joint_names, static_cast<int>(traj.rows()));
+  collectTrajectoryEntries(contacts, traj_contacts, entries, config);
+
+  if (traj_contacts && console_bridge::getLogLevel() < console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO)
     std::cout << traj_contacts.trajectoryCollisionResultsTable().str();
 
   return traj_contacts;
@@ -766,13 +1159,16 @@ checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
                 const tesseract::scene_graph::StateSolver& state_solver,
                 const std::vector<std::string>& joint_names,
                 const tesseract::common::TrajArray& traj,
-                const tesseract::collision::CollisionCheckConfig& config)
+                const tesseract::collision::CollisionCheckConfig& config,
+                tesseract::common::TaskExecutor& executor,
+                const LinkMotionBounds& link_motion_bounds,
+                DiscreteContactManagerPool* pool)
 {
   CalcStateFn state_fn = [&joint_names, &state_solver](const Eigen::VectorXd& state) {
     return state_solver.getState(joint_names, state).link_transforms;
   };
 
-  return checkTrajectory(contacts, manager, state_fn, joint_names, traj, config);
+  return checkTrajectory(contacts, manager, state_fn, joint_names, traj, config, executor, link_motion_bounds, pool);
 }
 
 tesseract::collision::ContactTrajectoryResults
@@ -780,12 +1176,15 @@ checkTrajectory(std::vector<tesseract::collision::ContactResultMap>& contacts,
                 tesseract::collision::DiscreteContactManager& manager,
                 const tesseract::kinematics::JointGroup& manip,
                 const tesseract::common::TrajArray& traj,
-                const tesseract::collision::CollisionCheckConfig& config)
+                const tesseract::collision::CollisionCheckConfig& config,
+                tesseract::common::TaskExecutor& executor,
+                const LinkMotionBounds& link_motion_bounds,
+                DiscreteContactManagerPool* pool)
 {
   CalcStateFn state_fn = [&manip](const Eigen::VectorXd& state) { return manip.calcFwdKin(state); };
 
   const std::vector<std::string> joint_names = manip.getJointNames();
-  return checkTrajectory(contacts, manager, state_fn, joint_names, traj, config);
+  return checkTrajectory(contacts, manager, state_fn, joint_names, traj, config, executor, link_motion_bounds, pool);
 }
 
 }  // namespace tesseract::environment
@@ -0,0 +1,119 @@
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <functional>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+#include <tesseract/scene_graph/graph.h>
+#include <tesseract/srdf/srdf_model.h>
+#include <tesseract/environment/environment.h>
+#include <tesseract/environment/environment_snapshot.h>
+#include <tesseract/environment/cereal_serialization.h>
+#include <tesseract/common/resource_locator.h>
+#include <tesseract/common/serialization.h>
+#include <tesseract/urdf/urdf_parser.h>
+
+using namespace tesseract::scene_graph;
+using namespace tesseract::environment;
+
+SceneGraph::Ptr getSceneGraph(const tesseract::common::ResourceLocator& locator)
+{
+  std::string path = "package://tesseract/support/urdf/lbr_iiwa_14_r820.urdf";
+
+  return tesseract::urdf::parseURDFFile(locator.locateResource(path)->getFilePath(), locator);
+}
+
+tesseract::srdf::SRDFModel::Ptr getSRDFModel(const SceneGraph& scene_graph,
+                                             const tesseract::common::ResourceLocator& locator)
+{
+  std::string path = "package://tesseract/support/urdf/lbr_iiwa_14_r820.srdf";
+
+  auto srdf = std::make_shared<tesseract::srdf::SRDFModel>();
+  srdf->initFile(scene_graph, locator.locateResource(path)->getFilePath(), locator);
+
+  return srdf;
+}
+
+/** @brief Benchmark initializing an environment by replaying its command history */
+static void BM_ENVIRONMENT_COMMAND_REPLAY(benchmark::State& state, const Environment::Ptr& env)
+{
+  const Commands commands = env->getCommandHistory();
+  for (auto _ : state)  // NOLINT
+  {
+    auto replay_env = std::make_unique<Environment>();
+    benchmark::DoNotOptimize(replay_env->init(commands));
+  }
+}
+
+/** @brief Benchmark saving an environment to a binary snapshot */
+static void BM_ENVIRONMENT_SNAPSHOT_SAVE(benchmark::State& state, const Environment::Ptr& env)
+{
+  std::vector<std::uint8_t> data;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(data = toEnvironmentSnapshot(*env));
+  }
+  state.counters["bytes"] = static_cast<double>(data.size());
+}
+
+/** @brief Benchmark loading an environment from a binary snapshot */
+static void BM_ENVIRONMENT_SNAPSHOT_LOAD(benchmark::State& state, const Environment::Ptr& env)
+{
+  const std::vector<std::uint8_t> data = toEnvironmentSnapshot(*env);
+  Environment::UPtr snapshot_env;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(snapshot_env = fromEnvironmentSnapshot(data));
+  }
+}
+
+/** @brief Benchmark a binary snapshot round trip */
+static void BM_ENVIRONMENT_SNAPSHOT_ROUND_TRIP(benchmark::State& state, const Environment::Ptr& env)
+{
+  Environment::UPtr snapshot_env;
+  for (auto _ : state)  // NOLINT
+  {
+    benchmark::DoNotOptimize(snapshot_env = fromEnvironmentSnapshot(toEnvironmentSnapshot(*env)));
+  }
+}
+
+/** @brief Benchmark a binary serialization round trip of the environment, which replays the command history */
+static void BM_ENVIRONMENT_SERIALIZATION_ROUND_TRIP(benchmark::State& state, const Environment::Ptr& env)
+{
+  using tesseract::common::Serialization;
+  Environment::Ptr serialized_env;
+  for (auto _ : state)  // NOLINT
+  {
+    std::vector<std::uint8_t> data = Serialization::toArchiveBinaryData<Environment::Ptr>(env, "Environment");
+    benchmark::DoNotOptimize(serialized_env =
+                                 Serialization::fromArchiveBinaryData<Environment::Ptr>(data, "Environment"));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  tesseract::common::GeneralResourceLocator locator;
+  SceneGraph::Ptr scene_graph = getSceneGraph(locator);
+  auto srdf = getSRDFModel(*scene_graph, locator);
+  Environment::Ptr env = std::make_shared<Environment>();
+  env->init(*scene_graph, srdf);
+  env->setResourceLocator(std::make_shared<tesseract::common::GeneralResourceLocator>());
+
+  const std::vector<std::pair<std::string, std::function<void(benchmark::State&, Environment::Ptr)>>> benchmarks{
+    { "BM_ENVIRONMENT_COMMAND_REPLAY", BM_ENVIRONMENT_COMMAND_REPLAY },
+    { "BM_ENVIRONMENT_SNAPSHOT_SAVE", BM_ENVIRONMENT_SNAPSHOT_SAVE },
+    { "BM_ENVIRONMENT_SNAPSHOT_LOAD", BM_ENVIRONMENT_SNAPSHOT_LOAD },
+    { "BM_ENVIRONMENT_SNAPSHOT_ROUND_TRIP", BM_ENVIRONMENT_SNAPSHOT_ROUND_TRIP },
+    { "BM_ENVIRONMENT_SERIALIZATION_ROUND_TRIP", BM_ENVIRONMENT_SERIALIZATION_ROUND_TRIP },
+  };
+
+  for (const auto& bm : benchmarks)
+  {
+    // NOLINTNEXTLINE
+    benchmark::RegisterBenchmark(bm.first.c_str(), bm.second, env)
+        ->UseRealTime()
+        ->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
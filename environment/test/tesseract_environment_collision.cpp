@@ -11,9 +11,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/environment/environment.h>
 #include <tesseract/environment/commands/add_link_command.h>
+#include <tesseract/environment/commands/remove_link_command.h>
 
 #include <tesseract/scene_graph/graph.h>
 #include <tesseract/scene_graph/link.h>
+#include <tesseract/scene_graph/joint.h>
 
 #include <tesseract/srdf/srdf_model.h>
 
@@ -270,6 +272,52 @@ TEST(TesseractEnvironmentCollisionUnit, runEnvironmentClearContinuousCollisionTe
   EXPECT_FALSE(collision.empty());
 }
 
+TEST(TesseractEnvironmentCollisionUnit, runEnvironmentDiscreteCollisionTransformsTest)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  Link link_3("link_n3");
+  {
+    Collision::Ptr c = std::make_shared<Collision>();
+    c->geometry = std::make_shared<tesseract::geometry::Box>(1, 1, 1);
+    c->name = "link3_collision";
+    link_3.collision.push_back(c);
+  }
+
+  Joint joint_3("joint_n3");
+  joint_3.parent_link_name = env->getRootLinkName();
+  joint_3.child_link_name = link_3.getName();
+  joint_3.type = JointType::PRISMATIC;
+  joint_3.axis = Eigen::Vector3d::UnitX();
+  joint_3.limits = std::make_shared<JointLimits>(-10, 10, 0, 1, 1, 1);
+  EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link_3, joint_3)));
+
+  ContactRequest request(ContactTestType::ALL);
+  auto checkLinkN3 = [&env, &request](double x) {
+    env->setState(std::vector<std::string>{ "joint_n3" }, Eigen::VectorXd::Constant(1, x));
+    DiscreteContactManager::Ptr manager = env->getDiscreteContactManager();
+    manager->setActiveCollisionObjects({ "link_n3" });
+    manager->applyContactManagerConfig(ContactManagerConfig(0.0));
+
+    ContactResultMap collision;
+    manager->contactTest(collision, request);
+    return collision;
+  };
+
+  // The state changes reuse the collision object positions, removing a link rebuilds them
+  EXPECT_TRUE(checkLinkN3(5).empty());
+  EXPECT_FALSE(checkLinkN3(1.5).empty());
+  EXPECT_TRUE(checkLinkN3(5).empty());
+
+  EXPECT_TRUE(env->applyCommand(std::make_shared<RemoveLinkCommand>("link_n2")));
+  EXPECT_TRUE(checkLinkN3(1.5).empty());
+  ContactResultMap collision = checkLinkN3(0);
+  EXPECT_FALSE(collision.empty());
+  EXPECT_NE(collision.find(tesseract::common::makeOrderedLinkPair("link_n1", "link_n3")), collision.end());
+  EXPECT_TRUE(checkLinkN3(5).empty());
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
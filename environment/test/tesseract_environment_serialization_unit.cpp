@@ -25,9 +25,13 @@
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstring>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/environment/environment.h>
+#include <tesseract/environment/environment_delta.h>
+#include <tesseract/environment/environment_snapshot.h>
 #include <tesseract/environment/commands.h>
 #include <tesseract/environment/cereal_serialization.h>
 
@@ -82,6 +86,237 @@ TEST(EnvironmentSerializeUnit, Environment)  // NOLINT
   testSerialization<Environment::Ptr>(env, "Environment", testSerializationComparePtrEqual<Environment::Ptr>);
 }
 
+TEST(EnvironmentSerializeUnit, EnvironmentSnapshot)  // NOLINT
+{
+  Environment::Ptr env = getEnvironment();
+  env->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(0.1));
+  env->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", false));
+  env->setState({ "joint_a1", "joint_a2" }, Eigen::Vector2d(0.5, -0.5));
+
+  const auto check = [&env](const Environment& snapshot_env) {
+    EXPECT_TRUE(snapshot_env.isInitialized());
+    EXPECT_EQ(*snapshot_env.getSceneGraph(), *env->getSceneGraph());
+    EXPECT_EQ(snapshot_env.getKinematicsInformation(), env->getKinematicsInformation());
+    EXPECT_EQ(snapshot_env.getContactManagersPluginInfo(), env->getContactManagersPluginInfo());
+    EXPECT_EQ(snapshot_env.getCollisionMarginData(), env->getCollisionMarginData());
+    EXPECT_EQ(*snapshot_env.getAllowedCollisionMatrix(), *env->getAllowedCollisionMatrix());
+    EXPECT_EQ(snapshot_env.getDiscreteContactManager()->getName(), env->getDiscreteContactManager()->getName());
+    EXPECT_EQ(snapshot_env.getContinuousContactManager()->getName(), env->getContinuousContactManager()->getName());
+    EXPECT_FALSE(snapshot_env.getLinkCollisionEnabled("link_1"));
+    EXPECT_TRUE(snapshot_env.getResourceLocator() != nullptr);
+    EXPECT_TRUE(tesseract::common::almostEqualRelativeAndAbs(snapshot_env.getCurrentJointValues(),
+                                                            env->getCurrentJointValues()));
+    EXPECT_EQ(snapshot_env.getGroupNames(), env->getGroupNames());
+  };
+
+  {  // Data
+    std::vector<std::uint8_t> data = toEnvironmentSnapshot(*env);
+    Environment::UPtr snapshot_env = fromEnvironmentSnapshot(data);
+    check(*snapshot_env);
+  }
+
+  {  // File
+    const std::string file_path = tesseract::common::getTempPath() + "environment_snapshot.bin";
+    EXPECT_TRUE(toEnvironmentSnapshotFile(*env, file_path));
+    Environment::UPtr snapshot_env = fromEnvironmentSnapshotFile(file_path);
+    check(*snapshot_env);
+  }
+
+  {  // Invalid data
+    std::vector<std::uint8_t> data = toEnvironmentSnapshot(*env);
+    data[0] = 'X';
+    EXPECT_ANY_THROW(fromEnvironmentSnapshot(data));  // NOLINT
+
+    data = toEnvironmentSnapshot(*env);
+    std::uint32_t byte_order_mark{ 0 };
+    std::uint32_t version{ 0 };
+    std::memcpy(&byte_order_mark, data.data() + 8, sizeof(byte_order_mark));
+    std::memcpy(&version, data.data() + 12, sizeof(version));
+    EXPECT_EQ(byte_order_mark, 0x01020304U);
+    EXPECT_EQ(version, ENVIRONMENT_SNAPSHOT_VERSION);
+
+    version = ENVIRONMENT_SNAPSHOT_VERSION + 1;
+    std::memcpy(data.data() + 12, &version, sizeof(version));
+    EXPECT_ANY_THROW(fromEnvironmentSnapshot(data));  // NOLINT
+
+    // A snapshot saved on a host with the other byte order
+    data = toEnvironmentSnapshot(*env);
+    std::reverse(data.begin() + 8, data.begin() + 12);
+    EXPECT_ANY_THROW(fromEnvironmentSnapshot(data));  // NOLINT
+
+    EXPECT_ANY_THROW(fromEnvironmentSnapshot({}));  // NOLINT
+    EXPECT_ANY_THROW(fromEnvironmentSnapshotFile(tesseract::common::getTempPath() + "does_not_exist.bin"));  // NOLINT
+  }
+}
+
+TEST(EnvironmentSerializeUnit, EnvironmentDeltaSquashCommands)  // NOLINT
+{
+  CollisionMarginPairData pair_margin_data;
+  pair_margin_data.setCollisionMargin("link_1", "link_2", 0.2);
+
+  Commands commands;
+  commands.push_back(std::make_shared<ChangeCollisionMarginsCommand>(0.1));
+  commands.push_back(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", false));
+  commands.push_back(std::make_shared<ChangeJointPositionLimitsCommand>(
+      std::unordered_map<std::string, std::pair<double, double>>{ { "joint_a1", { -1, 1 } },
+                                                                   { "joint_a2", { -1, 1 } } }));
+  commands.push_back(std::make_shared<ChangeCollisionMarginsCommand>(pair_margin_data));
+  commands.push_back(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", true));
+  commands.push_back(std::make_shared<ChangeJointPositionLimitsCommand>("joint_a1", -2, 2));
+  commands.push_back(std::make_shared<ChangeCollisionMarginsCommand>(0.3));
+  commands.push_back(std::make_shared<ChangeLinkVisibilityCommand>("link_1", false));
+
+  Commands squashed = squashCommands(commands);
+  ASSERT_EQ(squashed.size(), 6);
+
+  // The partially superseded limits command only keeps joint_a2
+  EXPECT_EQ(squashed[0]->getType(), CommandType::CHANGE_JOINT_POSITION_LIMITS);
+  const auto& limits = std::static_pointer_cast<const ChangeJointPositionLimitsCommand>(squashed[0])->getLimits();
+  EXPECT_EQ(limits.size(), 1);
+  EXPECT_TRUE(limits.find("joint_a2") != limits.end());
+
+  // Pair margins are kept because the later command only changes the default margin
+  EXPECT_EQ(*squashed[1], *commands[3]);
+  EXPECT_EQ(*squashed[2], *commands[4]);
+  EXPECT_EQ(*squashed[3], *commands[5]);
+  EXPECT_EQ(*squashed[4], *commands[6]);
+  EXPECT_EQ(*squashed[5], *commands[7]);
+
+  // A later replace supersedes the earlier pair margins
+  commands.push_back(std::make_shared<ChangeCollisionMarginsCommand>(
+      0.4, pair_margin_data, tesseract::common::CollisionMarginPairOverrideType::REPLACE));
+  squashed = squashCommands(commands);
+  ASSERT_EQ(squashed.size(), 5);
+  EXPECT_EQ(*squashed.back(), *commands.back());
+  for (const auto& cmd : squashed)
+  {
+    if (cmd->getType() == CommandType::CHANGE_COLLISION_MARGINS)
+      EXPECT_EQ(*cmd, *commands.back());
+  }
+
+  // Commands which are not superseded are kept in order
+  commands = { std::make_shared<RemoveLinkCommand>("link_1"), std::make_shared<RemoveLinkCommand>("link_2") };
+  squashed = squashCommands(commands);
+  ASSERT_EQ(squashed.size(), 2);
+  EXPECT_EQ(*squashed[0], *commands[0]);
+  EXPECT_EQ(*squashed[1], *commands[1]);
+
+  // Commands are not squashed across commands which change the structure of the scene graph
+  tesseract::common::JointTrajectory trajectory;
+  trajectory.push_back(tesseract::common::JointState({ "joint_a1" }, Eigen::VectorXd::Zero(1)));
+  commands = { std::make_shared<ChangeJointOriginCommand>("joint_a1", Eigen::Isometry3d::Identity()),
+               std::make_shared<AddTrajectoryLinkCommand>("traj_link", "base_link", trajectory),
+               std::make_shared<ChangeJointOriginCommand>("joint_a1",
+                                                          Eigen::Isometry3d(Eigen::Translation3d(0, 0, 1))) };
+  squashed = squashCommands(commands);
+  ASSERT_EQ(squashed.size(), 3);
+  for (std::size_t i = 0; i < commands.size(); ++i)
+    EXPECT_EQ(*squashed[i], *commands[i]);
+
+  commands = { std::make_shared<ChangeJointPositionLimitsCommand>("joint_a1", -1, 1),
+               std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", false),
+               std::make_shared<RemoveJointCommand>("joint_a1"),
+               std::make_shared<ChangeJointPositionLimitsCommand>("joint_a1", -2, 2),
+               std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", true),
+               std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", false) };
+  squashed = squashCommands(commands);
+  ASSERT_EQ(squashed.size(), 5);
+  EXPECT_EQ(*squashed[0], *commands[0]);
+  EXPECT_EQ(*squashed[1], *commands[1]);
+  EXPECT_EQ(*squashed[2], *commands[2]);
+  EXPECT_EQ(*squashed[3], *commands[3]);
+  EXPECT_EQ(*squashed[4], *commands[5]);
+}
+
+TEST(EnvironmentSerializeUnit, EnvironmentDelta)  // NOLINT
+{
+  Environment::Ptr master = getEnvironment();
+  Environment::UPtr worker = master->clone();
+  int synced_revision = master->getRevision();
+
+  // Transfer the delta through a binary archive like it would between processes
+  const auto transport = [](const EnvironmentDelta& delta) {
+    std::vector<std::uint8_t> data = Serialization::toArchiveBinaryData<EnvironmentDelta>(delta, "EnvironmentDelta");
+    return Serialization::fromArchiveBinaryData<EnvironmentDelta>(data, "EnvironmentDelta");
+  };
+
+  const auto check = [&master](const Environment& env) {
+    EXPECT_EQ(env.getCollisionMarginData(), master->getCollisionMarginData());
+    EXPECT_EQ(*env.getAllowedCollisionMatrix(), *master->getAllowedCollisionMatrix());
+    EXPECT_EQ(env.getLinkCollisionEnabled("link_1"), master->getLinkCollisionEnabled("link_1"));
+    EXPECT_EQ(*env.getSceneGraph()->getJoint("joint_a1")->limits,
+              *master->getSceneGraph()->getJoint("joint_a1")->limits);
+    EXPECT_TRUE(tesseract::common::almostEqualRelativeAndAbs(env.getCurrentJointValues(),
+                                                            master->getCurrentJointValues()));
+  };
+
+  {  // Nothing changed
+    EnvironmentDelta delta = getEnvironmentDelta(*master, synced_revision);
+    EXPECT_FALSE(delta.full);
+    EXPECT_TRUE(delta.commands.empty());
+    EXPECT_EQ(delta.to_revision, synced_revision);
+  }
+
+  {  // Incremental
+    master->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(0.1));
+    master->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(0.2));
+    master->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", false));
+    master->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", true));
+    master->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", false));
+    master->applyCommand(std::make_shared<ChangeJointPositionLimitsCommand>("joint_a1", -1, 1));
+    master->applyCommand(std::make_shared<ChangeJointPositionLimitsCommand>("joint_a1", -2, 2));
+    master->setState({ "joint_a1", "joint_a2" }, Eigen::Vector2d(0.5, -0.5));
+
+    EnvironmentDelta delta = getEnvironmentDelta(*master, synced_revision);
+    EXPECT_FALSE(delta.full);
+    EXPECT_EQ(delta.from_revision, synced_revision);
+    EXPECT_EQ(delta.to_revision, master->getRevision());
+    EXPECT_EQ(delta.commands.size(), 3);
+    testSerialization<EnvironmentDelta>(delta, "EnvironmentDelta");
+
+    EnvironmentDelta received = transport(delta);
+    EXPECT_EQ(received, delta);
+    EXPECT_TRUE(applyEnvironmentDelta(*worker, received));
+    EXPECT_EQ(worker->getRevision(), synced_revision + 3);
+    check(*worker);
+    synced_revision = received.to_revision;
+  }
+
+  {  // State only
+    master->setState({ "joint_a1" }, Eigen::VectorXd::Constant(1, -0.25));
+    EnvironmentDelta delta = getEnvironmentDelta(*master, synced_revision);
+    EXPECT_FALSE(delta.full);
+    EXPECT_TRUE(delta.commands.empty());
+    EXPECT_TRUE(applyEnvironmentDelta(*worker, transport(delta)));
+    check(*worker);
+  }
+
+  {  // Exceeds the maximum number of commands
+    master->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(0.3));
+    EnvironmentDelta delta = getEnvironmentDelta(*master, synced_revision, 0);
+    EXPECT_TRUE(delta.full);
+    EXPECT_TRUE(applyEnvironmentDelta(*worker, transport(delta)));
+    check(*worker);
+  }
+
+  {  // Revision is not available
+    auto env = std::make_shared<Environment>();
+    EnvironmentDelta delta = getEnvironmentDelta(*master, -1);
+    EXPECT_TRUE(delta.full);
+    EXPECT_TRUE(applyEnvironmentDelta(*env, transport(delta)));
+    EXPECT_TRUE(env->isInitialized());
+    EXPECT_EQ(*env->getSceneGraph(), *master->getSceneGraph());
+    check(*env);
+
+    EXPECT_TRUE(getEnvironmentDelta(*master, master->getRevision() + 1).full);
+  }
+
+  {  // Not initialized
+    Environment env;
+    EXPECT_ANY_THROW(getEnvironmentDelta(env, 0));  // NOLINT
+  }
+}
+
 TEST(EnvironmentSerializeUnit, EnvironmentAnyPoly)  // NOLINT
 {
   Environment::Ptr env = getEnvironment();
@@ -159,6 +394,10 @@ TEST(EnvironmentCommandsSerializeUnit, AddTrajectoryLinkCommand)  // NOLINT
   auto object = std::make_shared<AddTrajectoryLinkCommand>("link_name", "parent_link_name", trajectory, false, method);
   testSerialization<AddTrajectoryLinkCommand>(*object, "AddTrajectoryLinkCommand");
   testSerializationDerivedClass<Command, AddTrajectoryLinkCommand>(object, "AddTrajectoryLinkCommand");
+
+  method = AddTrajectoryLinkCommand::Method::SWEPT_VOLUME_OCTREE;
+  object = std::make_shared<AddTrajectoryLinkCommand>("link_name", "parent_link_name", trajectory, false, method, 0.1);
+  testSerialization<AddTrajectoryLinkCommand>(*object, "AddTrajectoryLinkCommand");
 }
 
 TEST(EnvironmentCommandsSerializeUnit, AddSceneGraphCommand)  // NOLINT
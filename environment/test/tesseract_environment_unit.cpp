@@ -2,10 +2,13 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <atomic>
+#include <set>
 #include <vector>
 #include <omp.h>
 #include <cmath>
 #include <fstream>
+#include <map>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -14,11 +17,14 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract/srdf/srdf_model.h>
 
 #include <tesseract/geometry/impl/box.h>
+#include <tesseract/geometry/impl/octree.h>
+#include <tesseract/geometry/impl/polygon_mesh.h>
 #include <tesseract/geometry/impl/sphere.h>
 
 #include <tesseract/common/resource_locator.h>
 #include <tesseract/common/manipulator_info.h>
 #include <tesseract/common/utils.h>
+#include <tesseract/common/task_pool.h>
 
 #include <tesseract/scene_graph/graph.h>
 #include <tesseract/scene_graph/link.h>
@@ -34,11 +40,14 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract/collision/discrete_contact_manager.h>
 #include <tesseract/collision/continuous_contact_manager.h>
 #include <tesseract/collision/types.h>
+#include <tesseract/collision/contact_manager_statistics.h>
 
 #include <tesseract/environment/environment.h>
 #include <tesseract/environment/command.h>
 #include <tesseract/environment/commands.h>
 #include <tesseract/environment/utils.h>
+#include <tesseract/environment/reachability_map.h>
+#include <tesseract/environment/allowed_collision_matrix_generator.h>
 
 using namespace tesseract::scene_graph;
 using namespace tesseract::srdf;
@@ -445,6 +454,90 @@ TEST(TesseractEnvironmentUnit, EnvInitURDFOnlyUnit)  // NOLINT
   getEnvironmentURDFOnly(EnvironmentInitType::FILEPATH);
 }
 
+/**
+ * @brief A resource locator which records every resource located while parsing
+ * @details The located resources use a copy of this locator as their parent, so resources located relative to them
+ * and the includes of YAML files are recorded too.
+ */
+class RecordingResourceLocator : public tesseract::common::ResourceLocator
+{
+public:
+  using Resources = std::map<std::string, tesseract::common::Resource::ConstPtr>;
+
+  RecordingResourceLocator(tesseract::common::ResourceLocator::ConstPtr locator, std::shared_ptr<Resources> resources)
+    : locator_(std::move(locator)), resources_(std::move(resources))
+  {
+  }
+
+  tesseract::common::Resource::Ptr locateResource(const std::string& url) const override
+  {
+    tesseract::common::Resource::Ptr resource = locator_->locateResource(url);
+    if (resource == nullptr || !resource->isFile() || !std::filesystem::exists(resource->getFilePath()))
+      return resource;
+
+    resource = std::make_shared<tesseract::common::SimpleLocatedResource>(
+        url, resource->getFilePath(), std::make_shared<RecordingResourceLocator>(*this));
+    (*resources_)[url] = resource;
+    return resource;
+  }
+
+private:
+  tesseract::common::ResourceLocator::ConstPtr locator_;
+  std::shared_ptr<Resources> resources_;
+};
+
+TEST(TesseractEnvironmentUnit, EnvInitResourceBundleUnit)  // NOLINT
+{
+  const std::string urdf_url = "package://tesseract/support/urdf/abb_irb2400.urdf";
+  const std::string srdf_url = "package://tesseract/support/urdf/abb_irb2400.srdf";
+
+  // Record every resource the URDF and SRDF depend on
+  auto resources = std::make_shared<RecordingResourceLocator::Resources>();
+  RecordingResourceLocator recording_locator(std::make_shared<tesseract::common::GeneralResourceLocator>(), resources);
+  auto scene_graph = tesseract::urdf::parseURDFFile(urdf_url, recording_locator);
+  tesseract::srdf::SRDFModel srdf_model;
+  srdf_model.initFile(*scene_graph, srdf_url, recording_locator);
+  EXPECT_EQ(resources->count(urdf_url), 1);
+  EXPECT_EQ(resources->count(srdf_url), 1);
+  EXPECT_EQ(resources->count("package://tesseract/support/urdf/abb_irb2400_plugins.yaml"), 1);
+
+  const std::string bundle_path =
+      (std::filesystem::temp_directory_path() / "tesseract_environment_unit.bundle").string();
+  tesseract::common::writeResourceBundle(bundle_path, *resources);
+
+  // The bundle locator only serves the bundle, so no other file is read
+  auto bundle_locator = std::make_shared<tesseract::common::BundleResourceLocator>(bundle_path);
+  auto env = std::make_shared<Environment>();
+  EXPECT_TRUE(env->init(std::filesystem::path(urdf_url), std::filesystem::path(srdf_url), bundle_locator));
+  EXPECT_TRUE(env->isInitialized());
+  EXPECT_EQ(env->getSceneGraph()->getLinks().size(), scene_graph->getLinks().size());
+  EXPECT_EQ(env->getGroupNames().count("manipulator"), 1);
+  EXPECT_TRUE(env->getDiscreteContactManager() != nullptr);
+
+  std::size_t mesh_count{ 0 };
+  auto check_mesh = [&mesh_count](const tesseract::geometry::Geometry::ConstPtr& geometry) {
+    auto mesh = std::dynamic_pointer_cast<const tesseract::geometry::PolygonMesh>(geometry);
+    if (mesh == nullptr)
+      return;
+
+    ++mesh_count;
+    ASSERT_TRUE(mesh->getResource() != nullptr);
+    EXPECT_FALSE(mesh->getResource()->isFile());
+  };
+
+  for (const auto& link : env->getSceneGraph()->getLinks())
+  {
+    for (const auto& visual : link->visual)
+      check_mesh(visual->geometry);
+
+    for (const auto& collision : link->collision)
+      check_mesh(collision->geometry);
+  }
+  EXPECT_GT(mesh_count, 0);
+
+  std::filesystem::remove(bundle_path);
+}
+
 TEST(TesseractEnvironmentUnit, EnvInitFailuresUnit)  // NOLINT
 {
   auto rl = std::make_shared<tesseract::common::GeneralResourceLocator>();
@@ -569,6 +662,135 @@ TEST(TesseractEnvironmentUnit, EnvCloneContactManagerUnit)  // NOLINT
   }
 }
 
+template <typename ManagerType>
+void checkLeasedContactManager(ManagerType& leased, ManagerType& expected)
+{
+  std::vector<std::string> leased_objects = leased.getCollisionObjects();
+  std::vector<std::string> expected_objects = expected.getCollisionObjects();
+  std::sort(leased_objects.begin(), leased_objects.end());
+  std::sort(expected_objects.begin(), expected_objects.end());
+  EXPECT_EQ(leased_objects, expected_objects);
+
+  for (const auto& name : expected_objects)
+    EXPECT_EQ(leased.isCollisionObjectEnabled(name), expected.isCollisionObjectEnabled(name));
+
+  EXPECT_EQ(leased.getActiveCollisionObjects(), expected.getActiveCollisionObjects());
+  EXPECT_TRUE(leased.getCollisionMarginData() == expected.getCollisionMarginData());
+
+  tesseract::collision::ContactResultMap leased_results;
+  tesseract::collision::ContactResultMap expected_results;
+  leased.contactTest(leased_results, tesseract::collision::ContactRequest(tesseract::collision::ContactTestType::ALL));
+  expected.contactTest(expected_results,
+                       tesseract::collision::ContactRequest(tesseract::collision::ContactTestType::ALL));
+  EXPECT_EQ(leased_results.count(), expected_results.count());
+  EXPECT_EQ(leased_results.size(), expected_results.size());
+}
+
+TEST(TesseractEnvironmentUnit, EnvLeaseContactManagerUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+  const std::vector<std::string>& joint_names = env->getActiveJointNames();
+  EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(0.1)));
+
+  std::set<tesseract::collision::DiscreteContactManager*> discrete_managers;
+  tesseract::collision::ContinuousContactManager* continuous_manager{ nullptr };
+  {  // Concurrent leases use different managers
+    DiscreteContactManagerLease discrete_lease1 = env->leaseDiscreteContactManager();
+    DiscreteContactManagerLease discrete_lease2 = env->leaseDiscreteContactManager();
+    ASSERT_TRUE(discrete_lease1);
+    ASSERT_TRUE(discrete_lease2);
+    EXPECT_NE(discrete_lease1.get(), discrete_lease2.get());
+    discrete_managers = { discrete_lease1.get(), discrete_lease2.get() };
+    checkLeasedContactManager(*discrete_lease1, *env->getDiscreteContactManager());
+
+    ContinuousContactManagerLease continuous_lease = env->leaseContinuousContactManager();
+    ASSERT_TRUE(continuous_lease);
+    continuous_manager = continuous_lease.get();
+    checkLeasedContactManager(*continuous_lease, *env->getContinuousContactManager());
+
+    // Move the active links, these are reset by the next lease
+    for (const auto& name : discrete_lease1->getActiveCollisionObjects())
+      discrete_lease1->setCollisionObjectsTransform(name, Eigen::Isometry3d::Identity());
+
+    for (const auto& name : continuous_lease->getActiveCollisionObjects())
+      continuous_lease->setCollisionObjectsTransform(name, Eigen::Isometry3d::Identity());
+
+    // Moving the lease releases only once
+    DiscreteContactManagerLease discrete_lease3 = std::move(discrete_lease2);
+    EXPECT_FALSE(discrete_lease2);  // NOLINT
+    discrete_lease3.release();
+    EXPECT_FALSE(discrete_lease3);
+  }
+
+  {  // Released managers are reused and synchronized with the state
+    env->setState(joint_names, Eigen::VectorXd::Constant(static_cast<Eigen::Index>(joint_names.size()), 0.5));
+    DiscreteContactManagerLease discrete_lease = env->leaseDiscreteContactManager();
+    ContinuousContactManagerLease continuous_lease = env->leaseContinuousContactManager();
+    EXPECT_EQ(discrete_managers.count(discrete_lease.get()), 1);
+    EXPECT_EQ(continuous_lease.get(), continuous_manager);
+    checkLeasedContactManager(*discrete_lease, *env->getDiscreteContactManager());
+    checkLeasedContactManager(*continuous_lease, *env->getContinuousContactManager());
+  }
+
+  {  // Released managers are synchronized with the changed collision objects
+    auto link = std::make_shared<Link>("link_n1");
+    auto collision = std::make_shared<Collision>();
+    collision->geometry = std::make_shared<tesseract::geometry::Box>(1, 1, 1);
+    link->collision.push_back(collision);
+    EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(*link)));
+    EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeLinkCollisionEnabledCommand>("link_1", false)));
+    EXPECT_TRUE(env->applyCommand(std::make_shared<ChangeCollisionMarginsCommand>(0.2)));
+    env->setState(joint_names, Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size())));
+
+    DiscreteContactManagerLease discrete_lease = env->leaseDiscreteContactManager();
+    ContinuousContactManagerLease continuous_lease = env->leaseContinuousContactManager();
+    EXPECT_EQ(discrete_managers.count(discrete_lease.get()), 1);
+    EXPECT_EQ(continuous_lease.get(), continuous_manager);
+    EXPECT_TRUE(discrete_lease->hasCollisionObject("link_n1"));
+    EXPECT_FALSE(discrete_lease->isCollisionObjectEnabled("link_1"));
+    checkLeasedContactManager(*discrete_lease, *env->getDiscreteContactManager());
+    checkLeasedContactManager(*continuous_lease, *env->getContinuousContactManager());
+
+    EXPECT_TRUE(env->applyCommand(std::make_shared<RemoveLinkCommand>("link_n1")));
+    DiscreteContactManagerLease discrete_lease2 = env->leaseDiscreteContactManager();
+    EXPECT_FALSE(discrete_lease2->hasCollisionObject("link_n1"));
+    checkLeasedContactManager(*discrete_lease2, *env->getDiscreteContactManager());
+  }
+
+  {  // Changing the active contact manager replaces the pooled managers
+    EXPECT_TRUE(env->setActiveDiscreteContactManager("BulletDiscreteSimpleManager"));
+    DiscreteContactManagerLease discrete_lease = env->leaseDiscreteContactManager();
+    EXPECT_EQ(discrete_lease->getName(), "BulletDiscreteSimpleManager");
+    checkLeasedContactManager(*discrete_lease, *env->getDiscreteContactManager());
+  }
+
+  {  // Leases from multiple threads
+    tesseract::common::TaskPool pool(4);
+    auto expected = env->getDiscreteContactManager();
+    tesseract::collision::ContactResultMap expected_results;
+    expected->contactTest(expected_results,
+                          tesseract::collision::ContactRequest(tesseract::collision::ContactTestType::ALL));
+
+    std::atomic<long> failures{ 0 };
+    tesseract::common::parallelFor(pool, 32, [&env, &expected_results, &failures](std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        DiscreteContactManagerLease lease = env->leaseDiscreteContactManager();
+        tesseract::collision::ContactResultMap results;
+        lease->contactTest(results, tesseract::collision::ContactRequest(tesseract::collision::ContactTestType::ALL));
+        if (results.count() != expected_results.count())
+          ++failures;
+      }
+    });
+    EXPECT_EQ(failures, 0);
+  }
+
+  // A lease may outlive the environment
+  DiscreteContactManagerLease discrete_lease = env->leaseDiscreteContactManager();
+  env = nullptr;
+  EXPECT_TRUE(discrete_lease->hasCollisionObject("link_1"));
+}
+
 TEST(TesseractEnvironmentUnit, EnvAddAndRemoveAllowedCollisionCommandUnit)  // NOLINT
 {
   // Get the environment
@@ -858,6 +1080,21 @@ void runEnvAddandRemoveTrajectoryLink(AddTrajectoryLinkCommand::Method method)
   EXPECT_TRUE(env->getDiscreteContactManager()->hasCollisionObject(link_name));
   EXPECT_TRUE(env->getContinuousContactManager()->hasCollisionObject(link_name));
 
+  auto traj_link = env->getSceneGraph()->getLink(link_name);
+  EXPECT_TRUE(traj_link != nullptr);
+  EXPECT_FALSE(traj_link->visual.empty());
+  if (method == AddTrajectoryLinkCommand::Method::PER_STATE_CONVEX_HULL)
+    EXPECT_EQ(traj_link->collision.size(), trajectory.size());
+  else if (method == AddTrajectoryLinkCommand::Method::GLOBAL_CONVEX_HULL)
+    EXPECT_EQ(traj_link->collision.size(), 1);
+  else if (method == AddTrajectoryLinkCommand::Method::SWEPT_VOLUME_OCTREE)
+  {
+    EXPECT_EQ(traj_link->collision.size(), 1);
+    EXPECT_EQ(traj_link->collision.front()->geometry->getType(), tesseract::geometry::GeometryType::OCTREE);
+  }
+  else
+    EXPECT_GT(traj_link->collision.size(), 1);
+
   std::vector<std::string> link_names = env->getLinkNames();
   std::vector<std::string> joint_names = env->getJointNames();
   tesseract::scene_graph::SceneState state = env->getState();
@@ -927,6 +1164,91 @@ TEST(TesseractEnvironmentUnit, EnvAddandRemoveTrajectoryLink)  // NOLINT
   runEnvAddandRemoveTrajectoryLink(AddTrajectoryLinkCommand::Method::PER_STATE_CONVEX_HULL);
   runEnvAddandRemoveTrajectoryLink(AddTrajectoryLinkCommand::Method::GLOBAL_PER_LINK_CONVEX_HULL);
   runEnvAddandRemoveTrajectoryLink(AddTrajectoryLinkCommand::Method::GLOBAL_CONVEX_HULL);
+  runEnvAddandRemoveTrajectoryLink(AddTrajectoryLinkCommand::Method::SWEPT_VOLUME_OCTREE);
+
+  {  // Invalid resolution
+    auto env = getEnvironment();
+    tesseract::common::JointTrajectory trajectory;
+    trajectory.push_back(tesseract::common::JointState({ "joint_a1", "joint_a2" }, Eigen::VectorXd::Zero(2)));
+    auto cmd = std::make_shared<AddTrajectoryLinkCommand>(
+        "traj_link", "base_link", trajectory, false, AddTrajectoryLinkCommand::Method::SWEPT_VOLUME_OCTREE, 0);
+    EXPECT_DOUBLE_EQ(cmd->getResolution(), 0);
+    EXPECT_FALSE(env->applyCommand(cmd));
+  }
+
+  {  // Swept volume exceeds the octree bounds
+    auto env = getEnvironment();
+    tesseract::common::JointTrajectory trajectory;
+    trajectory.push_back(tesseract::common::JointState({ "joint_a1", "joint_a2" }, Eigen::VectorXd::Zero(2)));
+    auto cmd = std::make_shared<AddTrajectoryLinkCommand>(
+        "traj_link", "base_link", trajectory, false, AddTrajectoryLinkCommand::Method::SWEPT_VOLUME_OCTREE, 1e-5);
+    EXPECT_FALSE(env->applyCommand(cmd));
+    EXPECT_TRUE(env->getLink("traj_link") == nullptr);
+  }
+
+  {  // Swept volume has too many voxels
+    auto env = getEnvironment();
+    tesseract::common::JointTrajectory trajectory;
+    trajectory.push_back(tesseract::common::JointState({ "joint_a1", "joint_a2" }, Eigen::VectorXd::Zero(2)));
+    auto cmd = std::make_shared<AddTrajectoryLinkCommand>(
+        "traj_link", "base_link", trajectory, false, AddTrajectoryLinkCommand::Method::SWEPT_VOLUME_OCTREE, 1e-4);
+    EXPECT_FALSE(env->applyCommand(cmd));
+    EXPECT_TRUE(env->getLink("traj_link") == nullptr);
+  }
+
+  {  // Swept volume includes a thin obstacle between two states
+    auto env = getEnvironment();
+
+    Link link_box("swept_box");
+    auto box_collision = std::make_shared<Collision>();
+    box_collision->geometry = std::make_shared<tesseract::geometry::Box>(0.1, 0.1, 0.1);
+    link_box.collision.push_back(box_collision);
+
+    Joint joint_box("joint_swept_box");
+    joint_box.parent_link_name = "base_link";
+    joint_box.child_link_name = link_box.getName();
+    joint_box.type = JointType::PRISMATIC;
+    joint_box.axis = Eigen::Vector3d::UnitX();
+    joint_box.limits = std::make_shared<JointLimits>(-2, 2, 0, 1, 1, 1);
+    joint_box.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0, 2, 0);
+    EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link_box, joint_box)));
+
+    Link link_obstacle("thin_obstacle");
+    auto obstacle_collision = std::make_shared<Collision>();
+    obstacle_collision->origin.translation() = Eigen::Vector3d(0.5, 2, 0);
+    obstacle_collision->geometry = std::make_shared<tesseract::geometry::Box>(0.01, 0.5, 0.5);
+    link_obstacle.collision.push_back(obstacle_collision);
+
+    Joint joint_obstacle("joint_thin_obstacle");
+    joint_obstacle.parent_link_name = "base_link";
+    joint_obstacle.child_link_name = link_obstacle.getName();
+    joint_obstacle.type = JointType::FIXED;
+    EXPECT_TRUE(env->applyCommand(std::make_shared<AddLinkCommand>(link_obstacle, joint_obstacle)));
+
+    // The box is clear of the obstacle at both states
+    tesseract::common::JointTrajectory trajectory;
+    trajectory.push_back(tesseract::common::JointState({ "joint_swept_box" }, Eigen::VectorXd::Zero(1)));
+    trajectory.push_back(tesseract::common::JointState({ "joint_swept_box" }, Eigen::VectorXd::Ones(1)));
+    auto cmd = std::make_shared<AddTrajectoryLinkCommand>(
+        "traj_link", "base_link", trajectory, false, AddTrajectoryLinkCommand::Method::SWEPT_VOLUME_OCTREE, 0.02);
+    EXPECT_TRUE(env->applyCommand(cmd));
+
+    auto traj_link = env->getLink("traj_link");
+    ASSERT_TRUE(traj_link != nullptr);
+    ASSERT_EQ(traj_link->collision.size(), 1);
+    auto octree =
+        std::dynamic_pointer_cast<const tesseract::geometry::Octree>(traj_link->collision.front()->geometry);
+    ASSERT_TRUE(octree != nullptr);
+    const octomap::OcTreeNode* node = octree->getOctree()->search(0.5, 2, 0);
+    ASSERT_TRUE(node != nullptr);
+    EXPECT_TRUE(octree->getOctree()->isNodeOccupied(node));
+
+    auto manager = env->getDiscreteContactManager();
+    manager->setActiveCollisionObjects({ "traj_link" });
+    ContactResultMap contacts;
+    manager->contactTest(contacts, ContactRequest(ContactTestType::ALL));
+    EXPECT_TRUE(contacts.find(tesseract::common::makeOrderedLinkPair("traj_link", "thin_obstacle")) != contacts.end());
+  }
 }
 
 TEST(TesseractEnvironmentUnit, EnvAddKinematicsInformationCommandUnit)  // NOLINT
@@ -6009,6 +6331,464 @@ TEST(TesseractEnvironmentUnit, checkTrajectoryUnit)  // NOLINT
   }
 }
 
+TEST(TesseractEnvironmentUnit, checkTrajectoryAdaptiveUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  // Add sphere to environment
+  Link link_sphere("sphere_attached");
+
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin = Eigen::Isometry3d::Identity();
+  collision->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  collision->geometry = std::make_shared<tesseract::geometry::Sphere>(0.15);
+  link_sphere.collision.push_back(collision);
+
+  Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = JointType::FIXED;
+
+  EXPECT_TRUE(env->applyCommand(std::make_shared<tesseract::environment::AddLinkCommand>(link_sphere, joint_sphere)));
+
+  std::vector<std::string> joint_names = { "joint_a1", "joint_a2", "joint_a3", "joint_a4",
+                                           "joint_a5", "joint_a6", "joint_a7" };
+
+  // Check the link motion bounds
+  tesseract::environment::LinkMotionBounds link_motion_bounds =
+      tesseract::environment::calcLinkMotionBounds(*env->getSceneGraph(), joint_names);
+  EXPECT_EQ(link_motion_bounds.count("base_link"), 0);
+  EXPECT_EQ(link_motion_bounds.count("sphere_attached"), 0);
+  ASSERT_EQ(link_motion_bounds.count("link_1"), 1);
+  ASSERT_EQ(link_motion_bounds.count("link_7"), 1);
+  EXPECT_GT(link_motion_bounds.at("link_1")(0), 0);
+  EXPECT_NEAR(link_motion_bounds.at("link_1").tail(6).norm(), 0, 1e-8);
+  for (Eigen::Index i = 0; i < 7; ++i)
+  {
+    EXPECT_GT(link_motion_bounds.at("link_7")(i), 0);
+    EXPECT_GE(link_motion_bounds.at("link_7")(i), link_motion_bounds.at("link_1")(i));
+  }
+
+  // NOLINTNEXTLINE
+  EXPECT_ANY_THROW(tesseract::environment::calcLinkMotionBounds(*env->getSceneGraph(), { "does_not_exist" }));
+
+  Eigen::VectorXd joint_start_pos(7);
+  joint_start_pos << -1.5, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_end_pos(7);
+  joint_end_pos << 1.5, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_free_pos(7);
+  joint_free_pos << -1.5, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_free_end_pos(7);
+  joint_free_end_pos << -0.9, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  // The middle of the trajectory is in collision
+  tesseract::common::TrajArray traj(3, joint_start_pos.size());
+  for (int i = 0; i < joint_start_pos.size(); ++i)
+    traj.col(i) = Eigen::VectorXd::LinSpaced(3, joint_start_pos(i), joint_end_pos(i));
+
+  // The trajectory is collision free
+  tesseract::common::TrajArray traj2(3, joint_start_pos.size());
+  for (int i = 0; i < joint_start_pos.size(); ++i)
+    traj2.col(i) = Eigen::VectorXd::LinSpaced(3, joint_free_pos(i), joint_free_end_pos(i));
+
+  auto discrete_manager = env->getDiscreteContactManager();
+  auto state_solver = env->getStateSolver();
+  auto joint_group = env->getJointGroup("manipulator");
+  const tesseract::collision::CollisionMarginData margin_data = discrete_manager->getCollisionMarginData();
+
+  using tesseract::environment::checkTrajectory;
+
+  for (const auto& exit_condition :
+       { CollisionCheckExitType::ALL, CollisionCheckExitType::ONE_PER_STEP, CollisionCheckExitType::FIRST })
+  {
+    for (const auto& t : { traj, traj2 })
+    {
+      // The adaptive check must find the same contacts as checking every substep
+      tesseract::collision::CollisionCheckConfig config;
+      config.type = CollisionEvaluatorType::LVS_DISCRETE;
+      config.longest_valid_segment_length = 0.01;
+      config.exit_condition = exit_condition;
+      std::vector<tesseract::collision::ContactResultMap> lvs_contacts;
+      tesseract::collision::ContactTrajectoryResults lvs_results =
+          checkTrajectory(lvs_contacts, *discrete_manager, *state_solver, joint_names, t, config);
+
+      config.type = CollisionEvaluatorType::ADAPTIVE_LVS_DISCRETE;
+      std::vector<tesseract::collision::ContactResultMap> contacts;
+      tesseract::collision::ContactTrajectoryResults results =
+          checkTrajectory(contacts, *discrete_manager, *state_solver, joint_names, t, config, link_motion_bounds);
+      EXPECT_EQ(static_cast<bool>(results), static_cast<bool>(lvs_results));
+      EXPECT_EQ(results.numContacts(), lvs_results.numContacts());
+      EXPECT_EQ(getContactCount(contacts), getContactCount(lvs_contacts));
+      ASSERT_EQ(contacts.size(), lvs_contacts.size());
+      for (std::size_t i = 0; i < contacts.size(); ++i)
+        EXPECT_EQ(contacts[i].size(), lvs_contacts[i].size());
+
+      // The collision margins of the manager must not be changed
+      EXPECT_EQ(discrete_manager->getCollisionMarginData(), margin_data);
+
+      // The lookahead is checked on a pooled clone, together they evaluate fewer states than checking every substep
+      tesseract::environment::DiscreteContactManagerPool manager_pool;
+      config.type = CollisionEvaluatorType::LVS_DISCRETE;
+      discrete_manager->resetStatistics();
+      lvs_contacts.clear();
+      checkTrajectory(lvs_contacts, *discrete_manager, *state_solver, joint_names, t, config);
+      const std::size_t lvs_contact_tests = discrete_manager->getStatistics().contact_tests;
+
+      config.type = CollisionEvaluatorType::ADAPTIVE_LVS_DISCRETE;
+      discrete_manager->resetStatistics();
+      contacts.clear();
+      results = checkTrajectory(
+          contacts, *discrete_manager, *state_solver, joint_names, t, config, link_motion_bounds, &manager_pool);
+      EXPECT_EQ(results.numContacts(), lvs_results.numContacts());
+      EXPECT_EQ(getContactCount(contacts), getContactCount(lvs_contacts));
+      EXPECT_EQ(discrete_manager->getCollisionMarginData(), margin_data);
+      ASSERT_EQ(manager_pool.size(), 1);
+      std::unique_ptr<tesseract::collision::DiscreteContactManager> lookahead_manager =
+          manager_pool.acquire(*discrete_manager);
+      EXPECT_EQ(lookahead_manager->getCollisionMarginData(), margin_data);
+      if (tesseract::collision::ContactManagerStatistics::isEnabled() && !lvs_results)
+      {
+        const std::size_t contact_tests =
+            discrete_manager->getStatistics().contact_tests + lookahead_manager->getStatistics().contact_tests;
+        EXPECT_GT(contact_tests, 0);
+        EXPECT_LT(contact_tests, lvs_contact_tests);
+      }
+
+      contacts.clear();
+      results = checkTrajectory(contacts, *discrete_manager, *joint_group, t, config, link_motion_bounds);
+      EXPECT_EQ(results.numContacts(), lvs_results.numContacts());
+      EXPECT_EQ(getContactCount(contacts), getContactCount(lvs_contacts));
+      EXPECT_EQ(discrete_manager->getCollisionMarginData(), margin_data);
+
+      // Without link motion bounds every substep is checked
+      contacts.clear();
+      results = checkTrajectory(contacts, *discrete_manager, *state_solver, joint_names, t, config);
+      EXPECT_EQ(results.numContacts(), lvs_results.numContacts());
+      EXPECT_EQ(getContactCount(contacts), getContactCount(lvs_contacts));
+    }
+  }
+}
+
+TEST(TesseractEnvironmentUnit, checkTrajectoryParallelUnit)  // NOLINT
+{
+  // Get the environment
+  auto env = getEnvironment();
+
+  // Add sphere to environment
+  Link link_sphere("sphere_attached");
+
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin = Eigen::Isometry3d::Identity();
+  collision->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  collision->geometry = std::make_shared<tesseract::geometry::Sphere>(0.15);
+  link_sphere.collision.push_back(collision);
+
+  Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = JointType::FIXED;
+
+  EXPECT_TRUE(env->applyCommand(std::make_shared<tesseract::environment::AddLinkCommand>(link_sphere, joint_sphere)));
+
+  std::vector<std::string> joint_names = { "joint_a1", "joint_a2", "joint_a3", "joint_a4",
+                                           "joint_a5", "joint_a6", "joint_a7" };
+
+  Eigen::VectorXd joint_start_pos(7);
+  joint_start_pos << -1.5, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_end_pos(7);
+  joint_end_pos << 1.5, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_free_end_pos(7);
+  joint_free_end_pos << -0.9, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  // The middle of the trajectory is in collision
+  tesseract::common::TrajArray traj(7, joint_start_pos.size());
+  for (int i = 0; i < joint_start_pos.size(); ++i)
+    traj.col(i) = Eigen::VectorXd::LinSpaced(7, joint_start_pos(i), joint_end_pos(i));
+
+  // The trajectory is collision free
+  tesseract::common::TrajArray traj2(5, joint_start_pos.size());
+  for (int i = 0; i < joint_start_pos.size(); ++i)
+    traj2.col(i) = Eigen::VectorXd::LinSpaced(5, joint_start_pos(i), joint_free_end_pos(i));
+
+  auto discrete_manager = env->getDiscreteContactManager();
+  auto state_solver = env->getStateSolver();
+  auto joint_group = env->getJointGroup("manipulator");
+  const tesseract::collision::CollisionMarginData margin_data = discrete_manager->getCollisionMarginData();
+  tesseract::environment::LinkMotionBounds link_motion_bounds =
+      tesseract::environment::calcLinkMotionBounds(*env->getSceneGraph(), joint_names);
+
+  tesseract::common::TaskPool task_pool(4);
+  tesseract::common::SerialTaskExecutor serial_executor;
+  tesseract::environment::DiscreteContactManagerPool manager_pool;
+
+  using tesseract::environment::checkTrajectory;
+  for (const auto& type : { CollisionEvaluatorType::DISCRETE,
+                            CollisionEvaluatorType::LVS_DISCRETE,
+                            CollisionEvaluatorType::ADAPTIVE_LVS_DISCRETE })
+  {
+    for (const auto& mode : { CollisionCheckProgramType::ALL,
+                              CollisionCheckProgramType::ALL_EXCEPT_START,
+                              CollisionCheckProgramType::ALL_EXCEPT_END,
+                              CollisionCheckProgramType::INTERMEDIATE_ONLY,
+                              CollisionCheckProgramType::START_ONLY,
+                              CollisionCheckProgramType::END_ONLY })
+    {
+      for (const auto& exit_condition :
+           { CollisionCheckExitType::ALL, CollisionCheckExitType::ONE_PER_STEP, CollisionCheckExitType::FIRST })
+      {
+        for (const auto& t : { traj, traj2 })
+        {
+          // The parallel check must find the same contacts as the serial check
+          tesseract::collision::CollisionCheckConfig config;
+          config.type = type;
+          config.check_program_mode = mode;
+          config.exit_condition = exit_condition;
+          config.longest_valid_segment_length = 0.05;
+          std::vector<tesseract::collision::ContactResultMap> serial_contacts;
+          tesseract::collision::ContactTrajectoryResults serial_results = checkTrajectory(
+              serial_contacts, *discrete_manager, *state_solver, joint_names, t, config, link_motion_bounds);
+
+          for (tesseract::common::TaskExecutor* executor :
+               std::vector<tesseract::common::TaskExecutor*>{ &task_pool, &serial_executor })
+          {
+            std::vector<tesseract::collision::ContactResultMap> contacts;
+            tesseract::collision::ContactTrajectoryResults results = checkTrajectory(
+                contacts, *discrete_manager, *state_solver, joint_names, t, config, *executor, link_motion_bounds);
+            EXPECT_EQ(static_cast<bool>(results), static_cast<bool>(serial_results));
+            EXPECT_EQ(results.numContacts(), serial_results.numContacts());
+            EXPECT_EQ(getContactCount(contacts), getContactCount(serial_contacts));
+            ASSERT_EQ(contacts.size(), serial_contacts.size());
+            for (std::size_t i = 0; i < contacts.size(); ++i)
+              EXPECT_EQ(contacts[i].size(), serial_contacts[i].size());
+
+            contacts.clear();
+            results =
+                checkTrajectory(contacts, *discrete_manager, *joint_group, t, config, *executor, link_motion_bounds);
+            EXPECT_EQ(results.numContacts(), serial_results.numContacts());
+            EXPECT_EQ(getContactCount(contacts), getContactCount(serial_contacts));
+          }
+
+          // The clones kept by the pool between calls find the same contacts
+          std::vector<tesseract::collision::ContactResultMap> pool_contacts;
+          tesseract::collision::ContactTrajectoryResults pool_results = checkTrajectory(
+              pool_contacts, *discrete_manager, *joint_group, t, config, task_pool, link_motion_bounds, &manager_pool);
+          EXPECT_EQ(pool_results.numContacts(), serial_results.numContacts());
+          EXPECT_EQ(getContactCount(pool_contacts), getContactCount(serial_contacts));
+
+          // The contact manager is not modified
+          EXPECT_EQ(discrete_manager->getCollisionMarginData(), margin_data);
+        }
+      }
+    }
+  }
+
+  // At most one clone is created per thread of the task pool and the calling thread, for all of the calls
+  EXPECT_GT(manager_pool.size(), 0U);
+  EXPECT_LE(manager_pool.size(), 5U);
+  manager_pool.clear();
+  EXPECT_EQ(manager_pool.size(), 0U);
+}
+
+TEST(TesseractEnvironmentUnit, EnvReachabilityMapUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+  auto kin_group = env->getKinematicGroup("manipulator");
+
+  {  // Orientations
+    auto orientations = generateReachabilityOrientations(8, 3);
+    EXPECT_EQ(orientations.size(), 24);
+    for (const auto& orientation : orientations)
+      EXPECT_NEAR(orientation.norm(), 1.0, 1e-8);
+
+    EXPECT_TRUE(generateReachabilityOrientations(1, 1).front().isApprox(Eigen::Quaterniond::Identity(), 1e-8));
+  }
+
+  ReachabilityMapConfig config;
+  config.group_name = "manipulator";
+  config.min_position = Eigen::Vector3d(0.3, -0.3, 0.5);
+  config.max_position = Eigen::Vector3d(0.7, 0.3, 0.9);
+  config.resolution = 0.2;
+  config.orientations = generateReachabilityOrientations(4, 2);
+
+  tesseract::common::SerialTaskExecutor serial_executor;
+  tesseract::common::TaskPool pool(4);
+  ReachabilityMap map = createReachabilityMap(*env, config, serial_executor);
+  EXPECT_EQ(map.getWorkingFrame(), kin_group->getBaseLinkName());
+  EXPECT_EQ(map.getTipLinkName(), kin_group->getInverseKinematics().getTipLinkNames().front());
+  EXPECT_EQ(map.getDimensions()[0], 3);
+  EXPECT_EQ(map.getDimensions()[1], 4);
+  EXPECT_EQ(map.getDimensions()[2], 3);
+  EXPECT_EQ(map.getVoxelCount(), 36);
+  EXPECT_EQ(map.getOrientationCount(), 8);
+
+  // The parallel map matches the serial map
+  EXPECT_TRUE(createReachabilityMap(*env, config, pool) == map);
+
+  // Compare with solving inverse kinematics directly
+  const Eigen::VectorXd seed = env->getCurrentJointValues(kin_group->getJointNames());
+  double reachability{ 0 };
+  for (std::size_t voxel = 0; voxel < map.getVoxelCount(); ++voxel)
+  {
+    const Eigen::Vector3d center = map.getVoxelCenter(voxel);
+    EXPECT_EQ(map.findVoxel(center).value(), voxel);
+    reachability += map.getReachability(voxel);
+
+    for (std::size_t o = 0; o < map.getOrientationCount(); ++o)
+    {
+      Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+      pose.translation() = center;
+      pose.linear() = map.getOrientations()[o].toRotationMatrix();
+      EXPECT_EQ(map.findOrientation(map.getOrientations()[o]), o);
+
+      tesseract::kinematics::KinGroupIKInput input(pose, map.getWorkingFrame(), map.getTipLinkName());
+      tesseract::kinematics::IKSolutions solutions = kin_group->calcInvKin(input, seed);
+      EXPECT_EQ(map.getSolutionCount(voxel, o), solutions.size());
+      EXPECT_EQ(map.isReachable(pose), !solutions.empty());
+      EXPECT_EQ(map.getManipulability(voxel, o) > 0, !solutions.empty());
+    }
+  }
+  EXPECT_GT(reachability, 0);
+  EXPECT_FALSE(map.findVoxel(Eigen::Vector3d(0, 0, 0)).has_value());
+  EXPECT_FALSE(map.isReachable(Eigen::Isometry3d::Identity()));
+
+  {  // Collision checking only removes solutions
+    ReachabilityMapConfig collision_config = config;
+    collision_config.check_collision = true;
+    ReachabilityMap collision_map = createReachabilityMap(*env, collision_config, pool);
+    for (std::size_t voxel = 0; voxel < map.getVoxelCount(); ++voxel)
+    {
+      for (std::size_t o = 0; o < map.getOrientationCount(); ++o)
+        EXPECT_LE(collision_map.getSolutionCount(voxel, o), map.getSolutionCount(voxel, o));
+    }
+  }
+
+  {  // File
+    const std::string file_path = tesseract::common::getTempPath() + "reachability_map.bin";
+    EXPECT_TRUE(map.saveFile(file_path));
+    EXPECT_TRUE(ReachabilityMap::loadFile(file_path) == map);
+    EXPECT_ANY_THROW(ReachabilityMap::loadFile(tesseract::common::getTempPath() + "does_not_exist.bin"));  // NOLINT
+  }
+
+  {  // Invalid configurations
+    ReachabilityMapConfig invalid_config = config;
+    invalid_config.resolution = 0;
+    EXPECT_ANY_THROW(createReachabilityMap(*env, invalid_config, pool));  // NOLINT
+
+    invalid_config = config;
+    invalid_config.orientations.clear();
+    EXPECT_ANY_THROW(createReachabilityMap(*env, invalid_config, pool));  // NOLINT
+
+    invalid_config = config;
+    invalid_config.max_position.x() = 0;
+    EXPECT_ANY_THROW(createReachabilityMap(*env, invalid_config, pool));  // NOLINT
+
+    invalid_config = config;
+    invalid_config.group_name = "does_not_exist";
+    EXPECT_ANY_THROW(createReachabilityMap(*env, invalid_config, pool));  // NOLINT
+  }
+}
+
+TEST(TesseractEnvironmentUnit, EnvGenerateAllowedCollisionMatrixUnit)  // NOLINT
+{
+  auto env = getEnvironment();
+  SceneGraph::UPtr scene_graph = env->getSceneGraph()->clone();
+
+  auto add_box_link = [&scene_graph](const std::string& name, const std::string& parent_link_name, double size) {
+    auto collision = std::make_shared<Collision>();
+    collision->geometry = std::make_shared<tesseract::geometry::Box>(size, size, size);
+    Link link(name);
+    link.collision.push_back(collision);
+
+    Joint joint(name + "_joint");
+    joint.parent_link_name = parent_link_name;
+    joint.child_link_name = name;
+    joint.type = JointType::FIXED;
+    joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0, 0, size);
+    EXPECT_TRUE(scene_graph->addLink(link, joint));
+  };
+  // A box around joint a1 which is in collision with link 1 in every state
+  add_box_link("box", "base_link", 0.4);
+
+  // A box attached to tool0 which does not have collision geometry
+  add_box_link("tool_box", "tool0", 0.05);
+
+  std::vector<std::string> link_names;
+  for (const auto& link : scene_graph->getLinks())
+  {
+    if (!link->collision.empty())
+      link_names.push_back(link->getName());
+  }
+
+  auto manager = env->getDiscreteContactManager();
+  tesseract::common::TaskPool pool(4);
+  AllowedCollisionMatrixGeneratorConfig config;
+  config.sample_count = 200;
+
+  {  // Adjacent and default
+    AllowedCollisionMatrixGeneratorConfig default_config = config;
+    default_config.disable_always = false;
+    default_config.disable_never = false;
+    tesseract::common::SerialTaskExecutor serial_executor;
+    auto acm = generateAllowedCollisionMatrix(*scene_graph, *manager, default_config, serial_executor);
+    const auto& entries = acm.getAllAllowedCollisions();
+    for (int i = 1; i < 7; ++i)
+    {
+      const auto key = tesseract::common::makeOrderedLinkPair("link_" + std::to_string(i),
+                                                              "link_" + std::to_string(i + 1));
+      EXPECT_EQ(entries.at(key), "Adjacent");
+    }
+    EXPECT_EQ(entries.at(tesseract::common::makeOrderedLinkPair("base_link", "link_1")), "Adjacent");
+    EXPECT_EQ(entries.at(tesseract::common::makeOrderedLinkPair("base_link", "box")), "Adjacent");
+    EXPECT_EQ(entries.at(tesseract::common::makeOrderedLinkPair("link_7", "tool_box")), "Adjacent");
+    EXPECT_EQ(entries.at(tesseract::common::makeOrderedLinkPair("box", "link_1")), "Default");
+    for (const auto& entry : entries)
+      EXPECT_TRUE(entry.second == "Adjacent" || entry.second == "Default");
+  }
+
+  {  // Never and always
+    auto acm = generateAllowedCollisionMatrix(*scene_graph, *manager, config, pool);
+    const auto& entries = acm.getAllAllowedCollisions();
+    EXPECT_EQ(entries.at(tesseract::common::makeOrderedLinkPair("box", "link_1")), "Default");
+    EXPECT_EQ(entries.at(tesseract::common::makeOrderedLinkPair("base_link", "link_2")), "Never");
+    for (const auto& entry : entries)
+    {
+      EXPECT_TRUE(entry.second == "Adjacent" || entry.second == "Default" || entry.second == "Always" ||
+                  entry.second == "Never");
+    }
+
+    // The result can be saved to and loaded from an SRDF
+    SRDFModel srdf;
+    srdf.name = "acm_generator";
+    srdf.acm = acm;
+    const std::string file_path = tesseract::common::getTempPath() + "acm_generator.srdf";
+    EXPECT_TRUE(srdf.saveToFile(file_path));
+
+    SRDFModel loaded_srdf;
+    tesseract::common::GeneralResourceLocator locator;
+    loaded_srdf.initFile(*scene_graph, file_path, locator);
+    EXPECT_TRUE(loaded_srdf.acm == acm);
+  }
+
+  {  // A pair in collision in a single sample is always in collision, so every pair is disabled
+    AllowedCollisionMatrixGeneratorConfig always_config = config;
+    always_config.always_in_collision_fraction = 1e-6;
+    auto acm = generateAllowedCollisionMatrix(*scene_graph, *manager, always_config, pool);
+    EXPECT_EQ(acm.getAllAllowedCollisions().size(), link_names.size() * (link_names.size() - 1) / 2);
+  }
+
+  {  // Invalid configuration
+    AllowedCollisionMatrixGeneratorConfig invalid_config = config;
+    invalid_config.always_in_collision_fraction = 0;
+    EXPECT_ANY_THROW(generateAllowedCollisionMatrix(*scene_graph, *manager, invalid_config, pool));  // NOLINT
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
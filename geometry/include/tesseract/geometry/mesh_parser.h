@@ -443,7 +443,8 @@ std::vector<std::shared_ptr<T>> createMeshFromResource(tesseract::common::Resour
     }
   }
 
-  std::vector<uint8_t> data = resource->getResourceContents();
+  // Files are memory mapped so the data is not copied before assimp parses it
+  const tesseract::common::ResourceBuffer data = resource->getResourceBuffer();
   if (data.empty())
   {
     if (resource->isFile())
@@ -24,6 +24,15 @@
 #ifndef TESSERACT_KINEMATICS_JOINT_GROUP_H
 #define TESSERACT_KINEMATICS_JOINT_GROUP_H
 
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract/scene_graph/fwd.h>
 #include <tesseract/state_solver/fwd.h>
 #include <tesseract/common/eigen_types.h>
@@ -131,6 +140,21 @@ public:
                                const std::string& link_name,
                                const Eigen::Vector3d& link_point) const;
 
+  /**
+   * @brief Calculate the jacobians of several points on the links of the joint group
+   * @details All jacobians are calculated from a single forward kinematics pass and written to the provided matrix, so
+   * no memory is allocated per point or joint. This is intended for calculating the jacobians of every contact point
+   * returned by a contact test. The jacobians of links moved by a mimic joint of a joint in the group are calculated
+   * with calcJacobian instead.
+   * @param jacobians The stacked jacobians which must be of size (6 * link_points.size()) x numJoints(). Rows 6 * i to
+   * 6 * i + 5 are the jacobian of link_points[i] relative to the joint group base link.
+   * @param joint_angles Input vector of joint angles
+   * @param link_points The link names and the points on the links, relative to the link frame
+   */
+  void calcJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                     const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                     const std::vector<std::pair<std::string, Eigen::Vector3d>>& link_points) const;
+
   /**
    * @brief Get list of joint names for kinematic object
    * @return A vector of joint names
@@ -221,6 +245,11 @@ protected:
   tesseract::common::KinematicLimits limits_;
   std::vector<Eigen::Index> redundancy_indices_;
   std::vector<Eigen::Index> jacobian_map_;
+  std::vector<tesseract::scene_graph::JointType> joint_types_;
+  tesseract::common::VectorVector3d joint_axes_;
+  std::vector<std::string> joint_child_link_names_;
+  std::unordered_map<std::string, std::vector<Eigen::Index>> link_joint_indices_;
+  std::unordered_set<std::string> mimic_link_names_;
 };
 
 }  // namespace tesseract::kinematics
@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/kinematics/joint_group.h>
 #include <tesseract/kinematics/types.h>
+#include <tesseract/common/fwd.h>
 
 namespace tesseract::kinematics
 {
@@ -147,6 +148,18 @@ public:
                   const KinGroupIKInput& tip_link_pose,
                   const Eigen::Ref<const Eigen::VectorXd>& seed) const;
 
+  /**
+   * @brief Calculates joint solutions for a batch of poses in parallel
+   * @details Each task solves a contiguous block of the inputs using its own clone of the inverse kinematics solver
+   * @param tip_link_poses The inputs, each entry is solved like calcInvKin(const KinGroupIKInputs&, seed)
+   * @param seed Vector of seed joint angles (size must match number of joints in robot chain)
+   * @param executor The executor used to run the tasks
+   * @return The solutions for each entry of the inputs, an entry is empty if it failed to find a solution
+   */
+  std::vector<IKSolutions> calcInvKin(const std::vector<KinGroupIKInputs>& tip_link_poses,
+                                      const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                      tesseract::common::TaskExecutor& executor) const;
+
   /** @brief Returns all possible working frames in which goal poses can be defined
    * @details The inverse kinematics solver requires that all poses be defined relative to a single working frame.
    * However if this working frame is static, a pose can be defined in another static frame in the environment and
@@ -181,6 +194,11 @@ private:
   Eigen::Isometry3d inv_to_fwd_base_{ Eigen::Isometry3d::Identity() };
   std::vector<std::string> working_frames_;
   std::unordered_map<std::string, std::string> inv_tip_links_map_;
+
+  void calcInvKinHelper(IKSolutions& solutions,
+                        const KinGroupIKInputs& tip_link_poses,
+                        const Eigen::Ref<const Eigen::VectorXd>& seed,
+                        const InverseKinematics& inv_kin) const;
 };
 
 }  // namespace tesseract::kinematics
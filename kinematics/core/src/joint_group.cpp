@@ -96,6 +96,34 @@ JointGroup::JointGroup(std::string name,
       default:
         break;
     }
+
+    // Store the joint axis, the child link frame is the joint frame
+    joint_types_.push_back(joint->type);
+    joint_axes_.push_back(joint->axis);
+    joint_child_link_names_.push_back(joint->child_link_name);
+  }
+
+  // Store the joints which move each link
+  for (const auto& link : scene_graph.getLinks())
+  {
+    std::vector<Eigen::Index> joint_indices;
+    std::vector<std::shared_ptr<const tesseract::scene_graph::Joint>> inbound_joints =
+        scene_graph.getInboundJoints(link->getName());
+    while (!inbound_joints.empty())
+    {
+      const auto& joint = inbound_joints.front();
+      auto it = std::find(joint_names_.begin(), joint_names_.end(), joint->getName());
+      if (it != joint_names_.end())
+        joint_indices.push_back(std::distance(joint_names_.begin(), it));
+      else if (joint->mimic != nullptr &&
+               std::find(joint_names_.begin(), joint_names_.end(), joint->mimic->joint_name) != joint_names_.end())
+        mimic_link_names_.insert(link->getName());
+
+      inbound_joints = scene_graph.getInboundJoints(joint->parent_link_name);
+    }
+
+    if (!joint_indices.empty())
+      link_joint_indices_[link->getName()] = joint_indices;
   }
 
   if (static_link_names_.size() + active_link_names.size() != scene_graph.getLinks().size())
@@ -115,6 +143,11 @@ JointGroup::JointGroup(const JointGroup& other)
   , limits_(other.limits_)
   , redundancy_indices_(other.redundancy_indices_)
   , jacobian_map_(other.jacobian_map_)
+  , joint_types_(other.joint_types_)
+  , joint_axes_(other.joint_axes_)
+  , joint_child_link_names_(other.joint_child_link_names_)
+  , link_joint_indices_(other.link_joint_indices_)
+  , mimic_link_names_(other.mimic_link_names_)
 {
 }
 
@@ -133,6 +166,11 @@ JointGroup& JointGroup::operator=(const JointGroup& other)
   limits_ = other.limits_;
   redundancy_indices_ = other.redundancy_indices_;
   jacobian_map_ = other.jacobian_map_;
+  joint_types_ = other.joint_types_;
+  joint_axes_ = other.joint_axes_;
+  joint_child_link_names_ = other.joint_child_link_names_;
+  link_joint_indices_ = other.link_joint_indices_;
+  mimic_link_names_ = other.mimic_link_names_;
   return *this;
 }
 
@@ -258,6 +296,66 @@ Eigen::MatrixXd JointGroup::calcJacobian(const Eigen::Ref<const Eigen::VectorXd>
   return kin_jac;
 }
 
+void JointGroup::calcJacobians(Eigen::Ref<Eigen::MatrixXd> jacobians,
+                               const Eigen::Ref<const Eigen::VectorXd>& joint_angles,
+                               const std::vector<std::pair<std::string, Eigen::Vector3d>>& link_points) const
+{
+  if (jacobians.rows() != 6 * static_cast<Eigen::Index>(link_points.size()) || jacobians.cols() != numJoints())
+    throw std::runtime_error("JointGroup, calcJacobians was provided a jacobians matrix with the wrong size!");
+
+  tesseract::common::TransformMap link_transforms;
+  state_solver_->getLinkTransforms(link_transforms, joint_names_, joint_angles);
+
+  // The joint axes and origins in the base link frame
+  tesseract::common::VectorVector3d axes(joint_names_.size());
+  tesseract::common::VectorVector3d origins(joint_names_.size());
+  for (std::size_t i = 0; i < joint_names_.size(); ++i)
+  {
+    const Eigen::Isometry3d& joint_tf = link_transforms.at(joint_child_link_names_[i]);
+    axes[i] = joint_tf.linear() * joint_axes_[i];
+    origins[i] = joint_tf.translation();
+  }
+
+  jacobians.setZero();
+  for (std::size_t i = 0; i < link_points.size(); ++i)
+  {
+    // The columns of the mimic joints are not cached, so use the state solver jacobian
+    if (!mimic_link_names_.empty() && mimic_link_names_.count(link_points[i].first) > 0)
+    {
+      jacobians.middleRows<6>(6 * static_cast<Eigen::Index>(i)) =
+          calcJacobian(joint_angles, link_points[i].first, link_points[i].second);
+      continue;
+    }
+
+    auto it = link_joint_indices_.find(link_points[i].first);
+    if (it == link_joint_indices_.end())
+    {
+      // Static links are not moved by the joints
+      if (!hasLinkName(link_points[i].first))
+        throw std::runtime_error("JointGroup, calcJacobians link name '" + link_points[i].first + "' does not exist!");
+
+      continue;
+    }
+
+    const Eigen::Vector3d point = link_transforms.at(link_points[i].first) * link_points[i].second;
+    auto jacobian = jacobians.middleRows<6>(6 * static_cast<Eigen::Index>(i));
+    for (const Eigen::Index j : it->second)
+    {
+      const auto idx = static_cast<std::size_t>(j);
+      if (joint_types_[idx] == tesseract::scene_graph::JointType::PRISMATIC)
+      {
+        jacobian.col(j).head<3>() = axes[idx];
+      }
+      else if (joint_types_[idx] == tesseract::scene_graph::JointType::REVOLUTE ||
+               joint_types_[idx] == tesseract::scene_graph::JointType::CONTINUOUS)
+      {
+        jacobian.col(j).head<3>() = axes[idx].cross(point - origins[idx]);
+        jacobian.col(j).tail<3>() = axes[idx];
+      }
+    }
+  }
+}
+
 bool JointGroup::checkJoints(const Eigen::Ref<const Eigen::VectorXd>& vec) const
 {
   if (vec.size() != static_cast<Eigen::Index>(joint_names_.size()))
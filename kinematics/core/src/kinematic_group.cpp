@@ -30,6 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract/kinematics/inverse_kinematics.h>
 #include <tesseract/kinematics/utils.h>
 #include <tesseract/common/utils.h>
+#include <tesseract/common/task_pool.h>
 
 #include <tesseract/scene_graph/graph.h>
 #include <tesseract/scene_graph/joint.h>
@@ -235,6 +236,32 @@ IKSolutions KinematicGroup::calcInvKin(const KinGroupIKInput& tip_link_pose,
 void KinematicGroup::calcInvKin(IKSolutions& solutions,
                                 const KinGroupIKInputs& tip_link_poses,
                                 const Eigen::Ref<const Eigen::VectorXd>& seed) const
+{
+  calcInvKinHelper(solutions, tip_link_poses, seed, *inv_kin_);
+}
+
+std::vector<IKSolutions> KinematicGroup::calcInvKin(const std::vector<KinGroupIKInputs>& tip_link_poses,
+                                                    const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                                    tesseract::common::TaskExecutor& executor) const
+{
+  std::vector<IKSolutions> solutions(tip_link_poses.size());
+
+  // The solvers lock internally so every block uses its own clone when running in parallel
+  const bool clone = (executor.getThreadCount() > 0);
+  tesseract::common::parallelFor(executor, tip_link_poses.size(), [&](std::size_t begin, std::size_t end) {
+    std::unique_ptr<InverseKinematics> local_inv_kin = (clone) ? inv_kin_->clone() : nullptr;
+    const InverseKinematics& inv_kin = (clone) ? *local_inv_kin : *inv_kin_;
+    for (std::size_t i = begin; i < end; ++i)
+      calcInvKinHelper(solutions[i], tip_link_poses[i], seed, inv_kin);
+  });
+
+  return solutions;
+}
+
+void KinematicGroup::calcInvKinHelper(IKSolutions& solutions,
+                                      const KinGroupIKInputs& tip_link_poses,
+                                      const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                      const InverseKinematics& inv_kin) const
 {
   // Convert to IK Inputs
   tesseract::common::TransformMap ik_inputs;
@@ -268,7 +295,7 @@ void KinematicGroup::calcInvKin(IKSolutions& solutions,
 
     // The IK Solvers tip link and working frame
     std::string ik_solver_tip_link = inv_tip_links_map_.at(tip_link_pose.tip_link_name);
-    std::string working_frame = inv_kin_->getWorkingFrame();
+    std::string working_frame = inv_kin.getWorkingFrame();
 
     // Get transform from working frame to user working frame (reference frame for the target IK pose)
     const Eigen::Isometry3d& world_to_user_wf = state_.link_transforms.at(tip_link_pose.working_frame);
@@ -293,13 +320,13 @@ void KinematicGroup::calcInvKin(IKSolutions& solutions,
   if (reorder_required_)
   {
     Eigen::VectorXd ordered = seed;
-    for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
+    for (Eigen::Index i = 0; i < inv_kin.numJoints(); ++i)
       ordered(inv_kin_joint_map_[static_cast<std::size_t>(i)]) = seed(i);
 
-    inv_kin_->calcInvKin(solutions, ik_inputs, ordered);
+    inv_kin.calcInvKin(solutions, ik_inputs, ordered);
 
     auto ne = std::remove_if(solutions.begin() + num_sol, solutions.end(), [&](Eigen::VectorXd& solution) {
-      for (Eigen::Index i = 0; i < inv_kin_->numJoints(); ++i)
+      for (Eigen::Index i = 0; i < inv_kin.numJoints(); ++i)
         ordered(i) = solution(inv_kin_joint_map_[static_cast<std::size_t>(i)]);
 
       tesseract::kinematics::harmonizeTowardMedian<double>(solution, redundancy_indices_, limits_.joint_limits);
@@ -309,7 +336,7 @@ void KinematicGroup::calcInvKin(IKSolutions& solutions,
     return;
   }
 
-  inv_kin_->calcInvKin(solutions, ik_inputs, seed);
+  inv_kin.calcInvKin(solutions, ik_inputs, seed);
   auto ne = std::remove_if(solutions.begin() + num_sol, solutions.end(), [&](Eigen::VectorXd& solution) {
     tesseract::kinematics::harmonizeTowardMedian<double>(solution, redundancy_indices_, limits_.joint_limits);
     return (!tesseract::common::satisfiesLimits<double>(solution, limits_.joint_limits));
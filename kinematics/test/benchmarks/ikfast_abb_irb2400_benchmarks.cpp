@@ -0,0 +1,34 @@
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include "kinematics_benchmark_utils.hpp"
+#include <tesseract/kinematics/ikfast/impl/ikfast_inv_kin.hpp>
+#include <tesseract/kinematics/kdl/kdl_fwd_kin_chain.h>
+
+using namespace tesseract::kinematics;
+using namespace tesseract::kinematics::test_suite;
+
+int main(int argc, char** argv)
+{
+  tesseract::common::GeneralResourceLocator locator;
+  tesseract::scene_graph::SceneGraph::Ptr scene_graph = getSceneGraphABB(locator);
+
+  const std::size_t num_targets = (std::string(BENCHMARK_ARGS) != "CI_ONLY") ? 50 : 10;
+
+  // Keep the wrist away from its singularity so every target has a well defined set of solutions
+  const std::vector<std::string> joint_names = getJointNamesABB();
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(6);
+  seed << 0, 0.2, 0.2, 0, 0.8, 0;
+
+  KDLFwdKinChain fwd_kin(*scene_graph, "base_link", "tool0");
+  const std::vector<tesseract::common::TransformMap> targets =
+      getTargets(fwd_kin, getJointStates(seed, getJointLimits(*scene_graph, joint_names), num_targets));
+
+  auto inv_kin = std::make_shared<IKFastInvKin>("base_link", "tool0", joint_names);
+  registerInvKinBenchmarks("IKFAST_ABB_IRB2400", inv_kin, targets, seed);
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
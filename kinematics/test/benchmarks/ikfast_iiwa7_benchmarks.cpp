@@ -0,0 +1,36 @@
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include "kinematics_benchmark_utils.hpp"
+#include <tesseract/kinematics/ikfast/impl/ikfast_inv_kin.hpp>
+#include <tesseract/kinematics/kdl/kdl_fwd_kin_chain.h>
+
+using namespace tesseract::kinematics;
+using namespace tesseract::kinematics::test_suite;
+
+int main(int argc, char** argv)
+{
+  tesseract::common::GeneralResourceLocator locator;
+  tesseract::scene_graph::SceneGraph::Ptr scene_graph = getSceneGraphIIWA7(locator);
+
+  const std::size_t num_targets = (std::string(BENCHMARK_ARGS) != "CI_ONLY") ? 50 : 10;
+
+  const std::vector<std::string> joint_names = getJointNamesIIWA7();
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(7);
+  seed << 0, 0.5, 0, -1.2, 0, 0.8, 0;
+
+  KDLFwdKinChain fwd_kin(*scene_graph, "link_0", "ikfast_tcp_link");
+  const std::vector<tesseract::common::TransformMap> targets =
+      getTargets(fwd_kin, getJointStates(seed, getJointLimits(*scene_graph, joint_names), num_targets));
+
+  // The redundant joint is sampled, so the solutions per second scale with the number of free joint states
+  std::vector<std::vector<double>> free_joint_states = { { -2.0 }, { -1.0 }, { 0.0 }, { 1.0 }, { 2.0 } };
+  auto inv_kin = std::make_shared<IKFastInvKin>(
+      "link_0", "ikfast_tcp_link", joint_names, IKFAST_INV_KIN_CHAIN_SOLVER_NAME, free_joint_states);
+  registerInvKinBenchmarks("IKFAST_IIWA7", inv_kin, targets, seed);
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,276 @@
+/**
+ * @file kinematics_benchmark_utils.hpp
+ * @brief Tesseract kinematics benchmark utilities
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_KINEMATICS_KINEMATICS_BENCHMARK_UTILS_HPP
+#define TESSERACT_KINEMATICS_KINEMATICS_BENCHMARK_UTILS_HPP
+
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <thread>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/kinematics/forward_kinematics.h>
+#include <tesseract/kinematics/inverse_kinematics.h>
+#include <tesseract/kinematics/joint_group.h>
+#include <tesseract/kinematics/types.h>
+#include <tesseract/scene_graph/graph.h>
+#include <tesseract/scene_graph/joint.h>
+#include <tesseract/state_solver/state_solver.h>
+#include <tesseract/urdf/urdf_parser.h>
+#include <tesseract/common/resource_locator.h>
+
+namespace tesseract::kinematics::test_suite
+{
+inline tesseract::scene_graph::SceneGraph::UPtr getSceneGraph(const tesseract::common::ResourceLocator& locator,
+                                                              const std::string& url)
+{
+  return tesseract::urdf::parseURDFFile(locator.locateResource(url)->getFilePath(), locator);
+}
+
+inline tesseract::scene_graph::SceneGraph::UPtr getSceneGraphABB(const tesseract::common::ResourceLocator& locator)
+{
+  return getSceneGraph(locator, "package://tesseract/support/urdf/abb_irb2400.urdf");
+}
+
+inline tesseract::scene_graph::SceneGraph::UPtr getSceneGraphIIWA7(const tesseract::common::ResourceLocator& locator)
+{
+  return getSceneGraph(locator, "package://tesseract/support/urdf/iiwa7.urdf");
+}
+
+/** @brief The ABB IRB2400 joint names */
+inline std::vector<std::string> getJointNamesABB()
+{
+  return { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+}
+
+/** @brief The IIWA7 joint names */
+inline std::vector<std::string> getJointNamesIIWA7()
+{
+  return { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6", "joint_7" };
+}
+
+/**
+ * @brief Generate reproducible joint states around a nominal state
+ * @param nominal The nominal joint state, this is also used as the seed for the inverse kinematics
+ * @param limits The joint position limits
+ * @param count The number of joint states
+ * @param range The maximum deviation from the nominal state
+ * @return The joint states
+ */
+inline std::vector<Eigen::VectorXd> getJointStates(const Eigen::VectorXd& nominal,
+                                                   const Eigen::MatrixX2d& limits,
+                                                   std::size_t count,
+                                                   double range = 0.5)
+{
+  std::mt19937 gen(42);  // NOLINT
+  std::uniform_real_distribution<double> dist(-range, range);
+
+  std::vector<Eigen::VectorXd> states;
+  states.reserve(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    Eigen::VectorXd state = nominal;
+    for (Eigen::Index j = 0; j < state.size(); ++j)
+      state(j) = std::clamp(nominal(j) + dist(gen), limits(j, 0), limits(j, 1));
+
+    states.push_back(state);
+  }
+
+  return states;
+}
+
+/**
+ * @brief Get the joint position limits of a set of joints from the scene graph
+ * @param scene_graph The scene graph
+ * @param joint_names The joint names
+ * @return The joint position limits
+ */
+inline Eigen::MatrixX2d getJointLimits(const tesseract::scene_graph::SceneGraph& scene_graph,
+                                       const std::vector<std::string>& joint_names)
+{
+  Eigen::MatrixX2d limits(static_cast<Eigen::Index>(joint_names.size()), 2);
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    auto joint = scene_graph.getJoint(joint_names[i]);
+    limits(static_cast<Eigen::Index>(i), 0) = joint->limits->lower;
+    limits(static_cast<Eigen::Index>(i), 1) = joint->limits->upper;
+  }
+  return limits;
+}
+
+/**
+ * @brief Compute the inverse kinematics targets from joint states so every target is reachable
+ * @param fwd_kin The forward kinematics matching the inverse kinematics
+ * @param states The joint states
+ * @return The inverse kinematics targets
+ */
+inline std::vector<tesseract::common::TransformMap> getTargets(const ForwardKinematics& fwd_kin,
+                                                               const std::vector<Eigen::VectorXd>& states)
+{
+  const std::string tip_link = fwd_kin.getTipLinkNames().front();
+  std::vector<tesseract::common::TransformMap> targets;
+  targets.reserve(states.size());
+  for (const auto& state : states)
+  {
+    tesseract::common::TransformMap poses = fwd_kin.calcFwdKin(state);
+    targets.push_back({ { tip_link, poses.at(tip_link) } });
+  }
+  return targets;
+}
+
+/** @brief The thread counts used for the multi-threaded throughput benchmarks */
+inline std::vector<int> getThreadCounts()
+{
+  const int max_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  std::vector<int> threads;
+  for (int i = 1; i < max_threads; i *= 2)
+    threads.push_back(i);
+
+  threads.push_back(max_threads);
+  return threads;
+}
+
+/**
+ * @brief Benchmark inverse kinematics
+ * @details Items per second is the number of inverse kinematics requests and the solutions counter is the number of
+ * solutions per second. When run with multiple threads and clone is false every thread shares the same solver, which
+ * shows the cost of any internal locking. If clone is true each thread uses its own copy of the solver.
+ * @param state The benchmark state
+ * @param inv_kin The inverse kinematics solver
+ * @param targets The inverse kinematics targets
+ * @param seed The seed passed to the solver
+ * @param clone Indicate if each thread should clone the solver
+ */
+inline void BM_CALC_INV_KIN(benchmark::State& state,
+                            const InverseKinematics::ConstPtr& inv_kin,
+                            const std::vector<tesseract::common::TransformMap>& targets,
+                            const Eigen::VectorXd& seed,
+                            bool clone)
+{
+  InverseKinematics::ConstPtr solver = (clone) ? InverseKinematics::ConstPtr(inv_kin->clone()) : inv_kin;
+  std::size_t num_solutions{ 0 };
+  IKSolutions solutions;
+  for (auto _ : state)  // NOLINT
+  {
+    for (const auto& target : targets)
+    {
+      solutions.clear();
+      solver->calcInvKin(solutions, target, seed);
+      num_solutions += solutions.size();
+      benchmark::DoNotOptimize(solutions);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(targets.size()));
+  state.counters["solutions"] = benchmark::Counter(static_cast<double>(num_solutions), benchmark::Counter::kIsRate);
+}
+
+/**
+ * @brief Benchmark the jacobian of a joint group
+ * @param state The benchmark state
+ * @param joint_group The joint group
+ * @param states The joint states
+ * @param link_name The link name to calculate the jacobian for
+ */
+inline void BM_CALC_JACOBIAN_JOINT_GROUP(benchmark::State& state,
+                                         const JointGroup::ConstPtr& joint_group,
+                                         const std::vector<Eigen::VectorXd>& states,
+                                         const std::string& link_name)
+{
+  Eigen::MatrixXd jacobian;
+  for (auto _ : state)  // NOLINT
+  {
+    for (const auto& s : states)
+      benchmark::DoNotOptimize(jacobian = joint_group->calcJacobian(s, link_name));
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(states.size()));
+}
+
+/**
+ * @brief Benchmark the jacobian of a state solver
+ * @details The state solver is not thread safe so each thread clones its own
+ * @param state The benchmark state
+ * @param state_solver The state solver
+ * @param joint_names The joint names
+ * @param states The joint states
+ * @param link_name The link name to calculate the jacobian for
+ */
+inline void BM_GET_JACOBIAN_STATE_SOLVER(benchmark::State& state,
+                                         const tesseract::scene_graph::StateSolver::ConstPtr& state_solver,
+                                         const std::vector<std::string>& joint_names,
+                                         const std::vector<Eigen::VectorXd>& states,
+                                         const std::string& link_name)
+{
+  tesseract::scene_graph::StateSolver::UPtr local_state_solver = state_solver->clone();
+  Eigen::MatrixXd jacobian;
+  for (auto _ : state)  // NOLINT
+  {
+    for (const auto& s : states)
+      benchmark::DoNotOptimize(jacobian = local_state_solver->getJacobian(joint_names, s, link_name));
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(states.size()));
+}
+
+/**
+ * @brief Register the single thread latency and multi-threaded throughput inverse kinematics benchmarks
+ * @param name The benchmark name
+ * @param inv_kin The inverse kinematics solver
+ * @param targets The inverse kinematics targets
+ * @param seed The seed passed to the solver
+ */
+inline void registerInvKinBenchmarks(const std::string& name,
+                                     const InverseKinematics::ConstPtr& inv_kin,
+                                     const std::vector<tesseract::common::TransformMap>& targets,
+                                     const Eigen::VectorXd& seed)
+{
+  std::function<void(benchmark::State&,
+                     InverseKinematics::ConstPtr,
+                     std::vector<tesseract::common::TransformMap>,
+                     Eigen::VectorXd,
+                     bool)>
+      BM_CIK_FUNC = BM_CALC_INV_KIN;
+
+  // NOLINTNEXTLINE
+  benchmark::RegisterBenchmark(("BM_CALC_INV_KIN_" + name).c_str(), BM_CIK_FUNC, inv_kin, targets, seed, false)
+      ->UseRealTime()
+      ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+  for (const auto& clone : { false, true })
+  {
+    std::string mt_name = "BM_CALC_INV_KIN_MT_" + std::string((clone) ? "CLONED_" : "SHARED_") + name;
+    // NOLINTNEXTLINE
+    auto* bm = benchmark::RegisterBenchmark(mt_name.c_str(), BM_CIK_FUNC, inv_kin, targets, seed, clone);
+    for (int threads : getThreadCounts())
+      bm->Threads(threads);
+
+    bm->UseRealTime()->Unit(benchmark::TimeUnit::kMicrosecond);
+  }
+}
+
+}  // namespace tesseract::kinematics::test_suite
+
+#endif  // TESSERACT_KINEMATICS_KINEMATICS_BENCHMARK_UTILS_HPP
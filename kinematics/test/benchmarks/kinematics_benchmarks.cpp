@@ -0,0 +1,252 @@
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <benchmark/benchmark.h>
+#include <map>
+#include <opw_kinematics/opw_parameters.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include "kinematics_benchmark_utils.hpp"
+#include <tesseract/kinematics/kdl/kdl_fwd_kin_chain.h>
+#include <tesseract/kinematics/kdl/kdl_inv_kin_chain_lma.h>
+#include <tesseract/kinematics/kdl/kdl_inv_kin_chain_nr.h>
+#include <tesseract/kinematics/kdl/kdl_inv_kin_chain_nr_jl.h>
+#include <tesseract/kinematics/opw/opw_inv_kin.h>
+#include <tesseract/kinematics/ur/ur_inv_kin.h>
+#include <tesseract/kinematics/rep_inv_kin.h>
+#include <tesseract/kinematics/rop_inv_kin.h>
+#include <tesseract/state_solver/kdl/kdl_state_solver.h>
+#include <tesseract/state_solver/ofkt/ofkt_state_solver.h>
+
+using namespace tesseract::kinematics;
+using namespace tesseract::kinematics::test_suite;
+
+opw_kinematics::Parameters<double> getOPWKinematicsParamABB()
+{
+  opw_kinematics::Parameters<double> opw_params;
+  opw_params.a1 = (0.100);
+  opw_params.a2 = (-0.135);
+  opw_params.b = (0.000);
+  opw_params.c1 = (0.615);
+  opw_params.c2 = (0.705);
+  opw_params.c3 = (0.755);
+  opw_params.c4 = (0.085);
+
+  opw_params.offsets[2] = -M_PI / 2.0;
+
+  return opw_params;
+}
+
+Eigen::VectorXd getNominalState(const std::vector<std::string>& joint_names,
+                                const std::map<std::string, double>& values)
+{
+  Eigen::VectorXd state = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(joint_names.size()));
+  for (std::size_t i = 0; i < joint_names.size(); ++i)
+  {
+    auto it = values.find(joint_names[i]);
+    if (it != values.end())
+      state(static_cast<Eigen::Index>(i)) = it->second;
+  }
+  return state;
+}
+
+// Keep the ABB wrist away from its singularity so every target has a well defined set of solutions
+const std::map<std::string, double> ABB_NOMINAL_STATE{ { "joint_2", 0.2 }, { "joint_3", 0.2 }, { "joint_5", 0.8 } };
+const std::map<std::string, double> IIWA7_NOMINAL_STATE{ { "joint_2", 0.5 }, { "joint_4", -1.2 }, { "joint_6", 0.8 } };
+
+int main(int argc, char** argv)
+{
+  tesseract::common::GeneralResourceLocator locator;
+  tesseract::scene_graph::SceneGraph::Ptr abb_scene_graph = getSceneGraphABB(locator);
+  tesseract::scene_graph::SceneGraph::Ptr iiwa7_scene_graph = getSceneGraphIIWA7(locator);
+
+  const std::size_t num_targets = (std::string(BENCHMARK_ARGS) != "CI_ONLY") ? 50 : 10;
+
+  // ABB IRB2400
+  const std::vector<std::string> abb_joint_names = getJointNamesABB();
+  const Eigen::VectorXd abb_seed = getNominalState(abb_joint_names, ABB_NOMINAL_STATE);
+  const std::vector<Eigen::VectorXd> abb_states =
+      getJointStates(abb_seed, getJointLimits(*abb_scene_graph, abb_joint_names), num_targets);
+  KDLFwdKinChain abb_fwd_kin(*abb_scene_graph, "base_link", "tool0");
+  const std::vector<tesseract::common::TransformMap> abb_targets = getTargets(abb_fwd_kin, abb_states);
+
+  // IIWA7
+  const std::vector<std::string> iiwa7_joint_names = getJointNamesIIWA7();
+  const Eigen::VectorXd iiwa7_seed = getNominalState(iiwa7_joint_names, IIWA7_NOMINAL_STATE);
+  const std::vector<Eigen::VectorXd> iiwa7_states =
+      getJointStates(iiwa7_seed, getJointLimits(*iiwa7_scene_graph, iiwa7_joint_names), num_targets);
+  KDLFwdKinChain iiwa7_fwd_kin(*iiwa7_scene_graph, "link_0", "ikfast_tcp_link");
+  const std::vector<tesseract::common::TransformMap> iiwa7_targets = getTargets(iiwa7_fwd_kin, iiwa7_states);
+
+  //////////////////////////////////////
+  // KDL Inverse Kinematics
+  //////////////////////////////////////
+  {
+    auto inv_kin =
+        std::make_shared<KDLInvKinChainLMA>(*abb_scene_graph, "base_link", "tool0", KDLInvKinChainLMA::Config());
+    registerInvKinBenchmarks("KDL_LMA_ABB_IRB2400", inv_kin, abb_targets, abb_seed);
+  }
+  {
+    auto inv_kin = std::make_shared<KDLInvKinChainLMA>(
+        *iiwa7_scene_graph, "link_0", "ikfast_tcp_link", KDLInvKinChainLMA::Config());
+    registerInvKinBenchmarks("KDL_LMA_IIWA7", inv_kin, iiwa7_targets, iiwa7_seed);
+  }
+  {
+    auto inv_kin =
+        std::make_shared<KDLInvKinChainNR>(*abb_scene_graph, "base_link", "tool0", KDLInvKinChainNR::Config());
+    registerInvKinBenchmarks("KDL_NR_ABB_IRB2400", inv_kin, abb_targets, abb_seed);
+  }
+  {
+    auto inv_kin = std::make_shared<KDLInvKinChainNR>(
+        *iiwa7_scene_graph, "link_0", "ikfast_tcp_link", KDLInvKinChainNR::Config());
+    registerInvKinBenchmarks("KDL_NR_IIWA7", inv_kin, iiwa7_targets, iiwa7_seed);
+  }
+  {
+    auto inv_kin =
+        std::make_shared<KDLInvKinChainNR_JL>(*abb_scene_graph, "base_link", "tool0", KDLInvKinChainNR_JL::Config());
+    registerInvKinBenchmarks("KDL_NR_JL_ABB_IRB2400", inv_kin, abb_targets, abb_seed);
+  }
+  {
+    auto inv_kin = std::make_shared<KDLInvKinChainNR_JL>(
+        *iiwa7_scene_graph, "link_0", "ikfast_tcp_link", KDLInvKinChainNR_JL::Config());
+    registerInvKinBenchmarks("KDL_NR_JL_IIWA7", inv_kin, iiwa7_targets, iiwa7_seed);
+  }
+
+  //////////////////////////////////////
+  // OPW Inverse Kinematics
+  //////////////////////////////////////
+  {
+    auto inv_kin = std::make_shared<OPWInvKin>(getOPWKinematicsParamABB(), "base_link", "tool0", abb_joint_names);
+    registerInvKinBenchmarks("OPW_ABB_IRB2400", inv_kin, abb_targets, abb_seed);
+  }
+
+  //////////////////////////////////////
+  // UR Inverse Kinematics
+  //////////////////////////////////////
+  {
+    std::vector<std::string> joint_names{ "shoulder_pan_joint", "shoulder_lift_joint", "elbow_joint",
+                                          "wrist_1_joint",      "wrist_2_joint",       "wrist_3_joint" };
+    auto inv_kin = std::make_shared<URInvKin>(UR10Parameters, "base_link", "tool0", joint_names);
+
+    // The UR kinematics are analytic so a grid of poses within the reach of the UR10 is used
+    std::vector<tesseract::common::TransformMap> targets;
+    for (double x : { 0.6, 0.75, 0.9 })
+    {
+      for (double y : { -0.2, 0.0, 0.2 })
+      {
+        Eigen::Isometry3d pose = Eigen::Isometry3d::Identity();
+        pose.translation() = Eigen::Vector3d(x, y, 0.75);
+        targets.push_back({ { "tool0", pose } });
+      }
+    }
+
+    registerInvKinBenchmarks("UR_UR10", inv_kin, targets, Eigen::VectorXd::Zero(6));
+  }
+
+  //////////////////////////////////////
+  // REP and ROP Inverse Kinematics
+  //////////////////////////////////////
+  {
+    tesseract::scene_graph::SceneGraph::Ptr scene_graph =
+        getSceneGraph(locator, "package://tesseract/support/urdf/abb_irb2400_external_positioner.urdf");
+    tesseract::scene_graph::KDLStateSolver state_solver(*scene_graph);
+    tesseract::scene_graph::SceneState scene_state = state_solver.getState();
+
+    KDLFwdKinChain fwd_kin(*scene_graph, "positioner_tool0", "tool0");
+    auto opw_kin = std::make_unique<OPWInvKin>(getOPWKinematicsParamABB(), "base_link", "tool0", abb_joint_names);
+    auto positioner_kin = std::make_unique<KDLFwdKinChain>(*scene_graph, "positioner_base_link", "positioner_tool0");
+    Eigen::VectorXd positioner_resolution = Eigen::VectorXd::Constant(2, 0.1);
+    auto inv_kin = std::make_shared<REPInvKin>(
+        *scene_graph, scene_state, std::move(opw_kin), 2.5, std::move(positioner_kin), positioner_resolution);
+
+    // The positioner is sampled for every request so fewer targets are used
+    const std::vector<std::string> joint_names = fwd_kin.getJointNames();
+    const std::vector<Eigen::VectorXd> states = getJointStates(getNominalState(joint_names, ABB_NOMINAL_STATE),
+                                                               getJointLimits(*scene_graph, joint_names),
+                                                               std::max<std::size_t>(num_targets / 10, 1));
+    registerInvKinBenchmarks(
+        "REP_ABB_IRB2400", inv_kin, getTargets(fwd_kin, states), Eigen::VectorXd::Zero(inv_kin->numJoints()));
+  }
+  {
+    tesseract::scene_graph::SceneGraph::Ptr scene_graph =
+        getSceneGraph(locator, "package://tesseract/support/urdf/abb_irb2400_on_positioner.urdf");
+    tesseract::scene_graph::KDLStateSolver state_solver(*scene_graph);
+    tesseract::scene_graph::SceneState scene_state = state_solver.getState();
+
+    KDLFwdKinChain fwd_kin(*scene_graph, "positioner_base_link", "tool0");
+    auto opw_kin = std::make_unique<OPWInvKin>(getOPWKinematicsParamABB(), "base_link", "tool0", abb_joint_names);
+    auto positioner_kin = std::make_unique<KDLFwdKinChain>(*scene_graph, "positioner_base_link", "positioner_tool0");
+    Eigen::VectorXd positioner_resolution = Eigen::VectorXd::Constant(1, 0.1);
+    auto inv_kin = std::make_shared<ROPInvKin>(
+        *scene_graph, scene_state, std::move(opw_kin), 2.5, std::move(positioner_kin), positioner_resolution);
+
+    const std::vector<std::string> joint_names = fwd_kin.getJointNames();
+    const std::vector<Eigen::VectorXd> states = getJointStates(getNominalState(joint_names, ABB_NOMINAL_STATE),
+                                                               getJointLimits(*scene_graph, joint_names),
+                                                               std::max<std::size_t>(num_targets / 10, 1));
+    registerInvKinBenchmarks(
+        "ROP_ABB_IRB2400", inv_kin, getTargets(fwd_kin, states), Eigen::VectorXd::Zero(inv_kin->numJoints()));
+  }
+
+  //////////////////////////////////////
+  // Jacobian
+  //////////////////////////////////////
+  std::function<void(benchmark::State&, JointGroup::ConstPtr, std::vector<Eigen::VectorXd>, std::string)>
+      BM_CJ_JG_FUNC = BM_CALC_JACOBIAN_JOINT_GROUP;
+  std::function<void(benchmark::State&,
+                     tesseract::scene_graph::StateSolver::ConstPtr,
+                     std::vector<std::string>,
+                     std::vector<Eigen::VectorXd>,
+                     std::string)>
+      BM_GJ_SS_FUNC = BM_GET_JACOBIAN_STATE_SOLVER;
+
+  struct JacobianInfo
+  {
+    std::string name;
+    tesseract::scene_graph::SceneGraph::ConstPtr scene_graph;
+    std::vector<std::string> joint_names;
+    std::vector<Eigen::VectorXd> states;
+    std::string tip_link;
+  };
+
+  std::vector<JacobianInfo> jacobian_infos{
+    { "ABB_IRB2400", abb_scene_graph, abb_joint_names, abb_states, "tool0" },
+    { "IIWA7", iiwa7_scene_graph, iiwa7_joint_names, iiwa7_states, "ikfast_tcp_link" },
+  };
+
+  for (const auto& info : jacobian_infos)
+  {
+    auto kdl_state_solver = std::make_shared<tesseract::scene_graph::KDLStateSolver>(*info.scene_graph);
+    auto ofkt_state_solver = std::make_shared<tesseract::scene_graph::OFKTStateSolver>(*info.scene_graph);
+    auto joint_group = std::make_shared<JointGroup>(
+        "manipulator", info.joint_names, *info.scene_graph, kdl_state_solver->getState());
+
+    {
+      std::string name = "BM_CALC_JACOBIAN_JOINT_GROUP_" + info.name;
+      // NOLINTNEXTLINE
+      auto* bm = benchmark::RegisterBenchmark(name.c_str(), BM_CJ_JG_FUNC, joint_group, info.states, info.tip_link);
+      for (int threads : getThreadCounts())
+        bm->Threads(threads);
+
+      bm->UseRealTime()->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+    {
+      std::string name = "BM_GET_JACOBIAN_KDL_STATE_SOLVER_" + info.name;
+      // NOLINTNEXTLINE
+      benchmark::RegisterBenchmark(
+          name.c_str(), BM_GJ_SS_FUNC, kdl_state_solver, info.joint_names, info.states, info.tip_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+    {
+      std::string name = "BM_GET_JACOBIAN_OFKT_STATE_SOLVER_" + info.name;
+      // NOLINTNEXTLINE
+      benchmark::RegisterBenchmark(
+          name.c_str(), BM_GJ_SS_FUNC, ofkt_state_solver, info.joint_names, info.states, info.tip_link)
+          ->UseRealTime()
+          ->Unit(benchmark::TimeUnit::kMicrosecond);
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
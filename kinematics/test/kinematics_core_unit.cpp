@@ -5,6 +5,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract/kinematics/kdl/kdl_fwd_kin_chain.h>
 #include <tesseract/kinematics/utils.h>
+#include <tesseract/kinematics/joint_group.h>
+#include <tesseract/state_solver/kdl/kdl_state_solver.h>
 #include "kinematics_test_utils.h"
 
 #include <Eigen/Core>
@@ -494,6 +496,55 @@ TEST(TesseractKinematicsUnit, dampedPInv_EmptyMatrix)
   EXPECT_FALSE(success);
 }
 
+TEST(TesseractKinematicsUnit, JointGroupCalcJacobiansMimicUnit)  // NOLINT
+{
+  using namespace tesseract::scene_graph;
+
+  SceneGraph scene_graph("mimic");
+  for (const std::string& link_name : { "base_link", "link_1", "link_2", "link_3", "link_4" })
+    EXPECT_TRUE(scene_graph.addLink(Link(link_name)));
+
+  // joint_2 mimics joint_1 and joint_4 is not part of the group
+  auto addJoint = [&scene_graph](const std::string& name,
+                                 const std::string& parent,
+                                 const std::string& child,
+                                 const Eigen::Vector3d& axis,
+                                 std::shared_ptr<JointMimic> mimic) {
+    Joint joint(name);
+    joint.parent_link_name = parent;
+    joint.child_link_name = child;
+    joint.type = JointType::REVOLUTE;
+    joint.axis = axis;
+    joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0, 0, 0.5);
+    joint.limits = std::make_shared<JointLimits>(-3, 3, 0, 2, 3, 4);
+    joint.mimic = std::move(mimic);
+    EXPECT_TRUE(scene_graph.addJoint(joint));
+  };
+  addJoint("joint_1", "base_link", "link_1", Eigen::Vector3d::UnitZ(), nullptr);
+  auto mimic = std::make_shared<JointMimic>(0.1, 2.0, "joint_1");
+  addJoint("joint_2", "link_1", "link_2", Eigen::Vector3d::UnitY(), mimic);
+  addJoint("joint_3", "link_2", "link_3", Eigen::Vector3d::UnitY(), nullptr);
+  addJoint("joint_4", "link_3", "link_4", Eigen::Vector3d::UnitX(), nullptr);
+
+  const SceneState scene_state = KDLStateSolver(scene_graph).getState();
+  tesseract::kinematics::JointGroup joint_group("manipulator", { "joint_1", "joint_3" }, scene_graph, scene_state);
+
+  const Eigen::Vector3d link_point(0.1, 0.2, 0.3);
+  std::vector<std::pair<std::string, Eigen::Vector3d>> link_points;
+  for (const std::string& link_name : { "base_link", "link_1", "link_2", "link_3", "link_4" })
+    link_points.emplace_back(link_name, link_point);
+
+  const Eigen::Vector2d joint_values(0.3, -0.4);
+  Eigen::MatrixXd jacobians(6 * static_cast<Eigen::Index>(link_points.size()), joint_group.numJoints());
+  joint_group.calcJacobians(jacobians, joint_values, link_points);
+  for (std::size_t i = 0; i < link_points.size(); ++i)
+  {
+    const Eigen::MatrixXd jacobian = joint_group.calcJacobian(joint_values, link_points[i].first, link_points[i].second);
+    EXPECT_TRUE(jacobians.middleRows<6>(6 * static_cast<Eigen::Index>(i)).isApprox(jacobian, 1e-8) ||
+                (jacobian.isZero(1e-8) && jacobians.middleRows<6>(6 * static_cast<Eigen::Index>(i)).isZero(1e-8)));
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -47,6 +47,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract/urdf/urdf_parser.h>
 #include <tesseract/common/utils.h>
 #include <tesseract/common/resource_locator.h>
+#include <tesseract/common/task_pool.h>
 
 namespace tesseract::kinematics::test_suite
 {
@@ -320,6 +321,28 @@ inline void runJacobianTest(tesseract::kinematics::KinematicGroup& kin_group,
         EXPECT_NEAR(numerical_jacobian(i, j), jacobian(i, j), 1e-3);
   }
 
+  {  // Test batched jacobians
+    std::vector<std::pair<std::string, Eigen::Vector3d>> link_points;
+    link_points.emplace_back(link_name, link_point);
+    link_points.emplace_back(link_name, Eigen::Vector3d::Zero());
+    for (const auto& active_link_name : kin_group.getActiveLinkNames())
+      link_points.emplace_back(active_link_name, link_point);
+    for (const auto& static_link_name : kin_group.getStaticLinkNames())
+      link_points.emplace_back(static_link_name, link_point);
+
+    Eigen::MatrixXd jacobians(6 * static_cast<Eigen::Index>(link_points.size()), kin_group.numJoints());
+    kin_group.calcJacobians(jacobians, jvals, link_points);
+    for (std::size_t k = 0; k < link_points.size(); ++k)
+    {
+      jacobian = kin_group.calcJacobian(jvals, link_points[k].first, link_points[k].second);
+      EXPECT_TRUE(jacobians.middleRows<6>(6 * static_cast<Eigen::Index>(k)).isApprox(jacobian, 1e-8) ||
+                  (jacobian.isZero(1e-8) && jacobians.middleRows<6>(6 * static_cast<Eigen::Index>(k)).isZero(1e-8)));
+    }
+
+    Eigen::MatrixXd wrong_size(6, kin_group.numJoints());
+    EXPECT_ANY_THROW(kin_group.calcJacobians(wrong_size, jvals, link_points));  // NOLINT
+  }
+
   std::vector<std::string> static_link_names = kin_group.getStaticLinkNames();
   tesseract::common::TransformMap poses = kin_group.calcFwdKin(jvals);
   for (const auto& static_link_name : static_link_names)
@@ -550,10 +573,34 @@ inline void runInvKinTest(const tesseract::kinematics::KinematicGroup& kin_group
 
   EXPECT_TRUE(checkKinematics(kin_group));
 
+  // Test batch inverse kinematics
+  tesseract::common::TaskPool task_pool(2);
+  tesseract::common::SerialTaskExecutor serial_executor;
+  std::vector<KinGroupIKInputs> batch_inputs(8, KinGroupIKInputs{ input });
+  for (tesseract::common::TaskExecutor* executor :
+       std::vector<tesseract::common::TaskExecutor*>{ &task_pool, &serial_executor })
+  {
+    std::vector<IKSolutions> batch_solutions = kin_group.calcInvKin(batch_inputs, seed, *executor);
+    ASSERT_EQ(batch_solutions.size(), batch_inputs.size());
+    for (const auto& batch_solution : batch_solutions)
+    {
+      EXPECT_EQ(batch_solution.size(), solutions.size());
+      for (const auto& sol : batch_solution)
+      {
+        tesseract::common::TransformMap result_poses = kin_group.calcFwdKin(sol);
+        Eigen::Isometry3d result = result_poses.at(working_frame).inverse() * result_poses[tip_link_name];
+        EXPECT_TRUE(target_pose.translation().isApprox(result.translation(), 1e-4));
+      }
+    }
+  }
+
   // Test failures
   {
     KinGroupIKInput input(target_pose, "does_not_exist", tip_link_name);
     EXPECT_ANY_THROW(kin_group.calcInvKin(input, seed));  // NOLINT
+
+    std::vector<KinGroupIKInputs> batch_inputs(8, KinGroupIKInputs{ input });
+    EXPECT_ANY_THROW(kin_group.calcInvKin(batch_inputs, seed, task_pool));  // NOLINT
   }
 
   {
@@ -28,8 +28,11 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/graph/adjacency_list.hpp>  // for customizable graphs
 #include <boost/graph/properties.hpp>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <Eigen/Geometry>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -487,7 +490,6 @@ public:
 
   /**
    * @brief Get all children link names for the given joint names
-   * @todo Need to create custom visitor so already process joint_names do not get processed again.
    * @param names Name of joints
    * @return A vector of child link names
    */
@@ -576,18 +578,83 @@ private:
   std::unordered_map<std::string, std::pair<std::shared_ptr<Joint>, Edge>> joint_map_;
   std::shared_ptr<tesseract::common::AllowedCollisionMatrix> acm_;
 
+  /**
+   * @brief A compact index based copy of the graph structure used by the topology queries
+   * @details Links are indexed in topological order when the graph is acyclic and in depth first pre-order from the
+   * root when the graph is a tree, so the descendants of a link are the contiguous range [index, subtree_ends[index]).
+   * It only stores names and indices so it is shared with clones of the graph.
+   */
+  struct Topology
+  {
+    /** @brief The structural revision of the graph the topology was built from */
+    std::size_t revision{ 0 };
+
+    /** @brief Indicate if the graph is acyclic */
+    bool acyclic{ true };
+
+    /** @brief Indicate if the graph is a tree */
+    bool tree{ true };
+
+    /** @brief The link names by index */
+    std::vector<std::string> link_names;
+
+    /** @brief The link indices by name */
+    std::unordered_map<std::string, std::size_t> link_indices;
+
+    /** @brief The offsets of the children of each link in child_links, it has one more entry than there are links */
+    std::vector<std::size_t> child_offsets;
+
+    /** @brief The child link indices of every link in the order of the outbound joints */
+    std::vector<std::size_t> child_links;
+
+    /** @brief The parent link index of each link, the link count if it does not have exactly one parent */
+    std::vector<std::size_t> parent_links;
+
+    /** @brief The name of the inbound joint of each link, empty if it does not have exactly one parent */
+    std::vector<std::string> parent_joints;
+
+    /** @brief The depth of each link from the root, only populated if the graph is a tree */
+    std::vector<std::size_t> depths;
+
+    /** @brief The end of the subtree range of each link, only populated if the graph is a tree */
+    std::vector<std::size_t> subtree_ends;
+  };
+
+  /** @brief The revision of the graph structure, incremented when links or joints are added or removed */
+  std::size_t topology_revision_{ 0 };
+
+  /** @brief The cached topology, rebuilt on the next query if its revision does not match */
+  mutable std::shared_ptr<const Topology> topology_;
+  mutable std::mutex topology_mutex_;
+
   /** @brief The rebuild the link and joint map by extraction information from the graph */
   void rebuildLinkAndJointMaps();
 
+  /** @brief Invalidate the cached topology, this must be called by everything that changes the graph structure */
+  void invalidateTopology();
+
+  /** @brief Get the cached topology, rebuilding it if the graph structure changed */
+  std::shared_ptr<const Topology> getTopology() const;
+
+  /** @brief Build the topology from the graph */
+  std::shared_ptr<const Topology> buildTopology() const;
+
+  /**
+   * @brief Get the index of a link in the topology
+   * @throws std::runtime_error if the link does not exist
+   */
+  static std::size_t getTopologyLinkIndex(const Topology& topology, const std::string& name);
+
   /**
-   * @brief Get the children of a vertex starting with start_vertex
+   * @brief Get the children of a link starting with the link
    *
-   * Note: This list will include the start vertex
+   * Note: This list will include the start link
    *
-   * @param start_vertex The vertex to find childeren for.
-   * @return A list of child link names including the start vertex
+   * @param topology The topology
+   * @param index The index of the link to find children for.
+   * @return A list of child link names including the start link
    */
-  std::vector<std::string> getLinkChildrenHelper(Vertex start_vertex) const;
+  static std::vector<std::string> getLinkChildrenHelper(const Topology& topology, std::size_t index);
 
   template <class Archive>
   friend void ::tesseract::scene_graph::serialize(Archive& ar, SceneGraph& obj);
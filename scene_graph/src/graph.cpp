@@ -25,13 +25,13 @@
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/graph/directed_graph.hpp>  // A subclass to provide reasonable arguments to adjacency_list for a typical directed graph
-#include <boost/graph/depth_first_search.hpp>
-#include <boost/graph/breadth_first_search.hpp>
 #include <boost/graph/adj_list_serialize.hpp>
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 #include <boost/graph/undirected_graph.hpp>
 #include <boost/graph/copy.hpp>
+#include <algorithm>
 #include <fstream>
+#include <numeric>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -43,118 +43,6 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract::scene_graph
 {
-struct cycle_detector : public boost::dfs_visitor<>
-{
-  cycle_detector(bool& ascyclic) : ascyclic_(ascyclic) {}
-
-  template <class e, class g>
-  void back_edge(e, g&)
-  {
-    ascyclic_ = false;
-  }
-
-protected:
-  bool& ascyclic_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
-};
-
-struct tree_detector : public boost::dfs_visitor<>
-{
-  tree_detector(bool& tree) : tree_(tree) {}
-
-  template <class u, class g>
-  void discover_vertex(u vertex, const g& graph)
-  {
-    auto num_in_edges = static_cast<int>(boost::in_degree(vertex, graph));
-
-    if (num_in_edges > 1)
-    {
-      tree_ = false;
-      return;
-    }
-
-    // Check if more that one root exist
-    if (num_in_edges == 0 && found_root_)
-    {
-      tree_ = false;
-      return;
-    }
-
-    if (num_in_edges == 0)
-      found_root_ = true;
-
-    // Check if not vertex is unused.
-    if (num_in_edges == 0 && boost::out_degree(vertex, graph) == 0)
-    {
-      tree_ = false;
-      return;
-    }
-  }
-
-  template <class e, class g>
-  void back_edge(e, const g&)
-  {
-    tree_ = false;
-  }
-
-protected:
-  bool& tree_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
-  bool found_root_{ false };
-};
-
-struct children_detector : public boost::default_bfs_visitor
-{
-  children_detector(std::vector<std::string>& children) : children_(children) {}
-
-  template <class u, class g>
-  void discover_vertex(u vertex, const g& graph)
-  {
-    children_.push_back(boost::get(boost::vertex_link, graph)[vertex]->getName());
-  }
-
-protected:
-  std::vector<std::string>& children_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
-};
-
-struct adjacency_detector : public boost::default_bfs_visitor
-{
-  adjacency_detector(std::unordered_map<std::string, std::string>& adjacency_map,
-                     std::map<SceneGraph::Vertex, boost::default_color_type>& color_map,
-                     const std::string& base_link_name,
-                     const std::vector<std::string>& terminate_on_links)
-    : adjacency_map_(adjacency_map)
-    , color_map_(color_map)
-    , base_link_name_(base_link_name)
-    , terminate_on_links_(terminate_on_links)
-  {
-  }
-
-  template <class u, class g>
-  void examine_vertex(u vertex, const g& graph)
-  {
-    for (auto vd : boost::make_iterator_range(adjacent_vertices(vertex, graph)))
-    {
-      std::string adj_link = boost::get(boost::vertex_link, graph)[vd]->getName();
-      if (std::find(terminate_on_links_.begin(), terminate_on_links_.end(), adj_link) != terminate_on_links_.end())
-        color_map_[vd] = boost::default_color_type::black_color;
-    }
-  }
-
-  template <class u, class g>
-  void discover_vertex(u vertex, const g& graph)
-  {
-    std::string adj_link = boost::get(boost::vertex_link, graph)[vertex]->getName();
-    adjacency_map_[adj_link] = base_link_name_;
-  }
-
-protected:
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
-  std::unordered_map<std::string, std::string>& adjacency_map_;
-  // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
-  std::map<SceneGraph::Vertex, boost::default_color_type>& color_map_;
-  const std::string& base_link_name_;                   // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
-  const std::vector<std::string>& terminate_on_links_;  // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
-};
-
 using UGraph =
     boost::adjacency_list<boost::listS, boost::listS, boost::undirectedS, VertexProperty, EdgeProperty, GraphProperty>;
 
@@ -184,6 +72,8 @@ SceneGraph::SceneGraph(SceneGraph&& other) noexcept
   , link_map_(std::move(other.link_map_))
   , joint_map_(std::move(other.joint_map_))
   , acm_(std::move(other.acm_))
+  , topology_revision_(other.topology_revision_)
+  , topology_(std::move(other.topology_))
 {
   rebuildLinkAndJointMaps();
 }
@@ -195,6 +85,8 @@ SceneGraph& SceneGraph::operator=(SceneGraph&& other) noexcept
   link_map_ = std::move(other.link_map_);
   joint_map_ = std::move(other.joint_map_);
   acm_ = std::move(other.acm_);
+  topology_revision_ = other.topology_revision_;
+  topology_ = std::move(other.topology_);
 
   rebuildLinkAndJointMaps();
 
@@ -220,6 +112,15 @@ SceneGraph::UPtr SceneGraph::clone() const
   cloned_graph->setName(getName());
   cloned_graph->setRoot(getRoot());
 
+  {  // The structure is identical so a valid topology is shared instead of rebuilt on the first query
+    std::unique_lock<std::mutex> lock(topology_mutex_);
+    if (topology_ != nullptr && topology_->revision == topology_revision_)
+    {
+      cloned_graph->topology_revision_ = topology_revision_;
+      cloned_graph->topology_ = topology_;
+    }
+  }
+
   return cloned_graph;
 }
 
@@ -229,6 +130,7 @@ void SceneGraph::clear()
   link_map_.clear();
   joint_map_.clear();
   acm_->clearAllowedCollisions();
+  invalidateTopology();
 }
 
 void SceneGraph::setName(const std::string& name)
@@ -305,6 +207,7 @@ bool SceneGraph::addLinkHelper(const std::shared_ptr<Link>& link_ptr, bool repla
     VertexProperty info(link_ptr);
     Vertex v = boost::add_vertex(info, static_cast<Graph&>(*this));
     link_map_[link_ptr->getName()] = std::make_pair(link_ptr, v);
+    invalidateTopology();
 
     // First link added set as root
     if (link_map_.size() == 1)
@@ -374,6 +277,7 @@ bool SceneGraph::removeLink(const std::string& name, bool recursive)
   // Now remove vertex
   boost::remove_vertex(found->second.second, static_cast<Graph&>(*this));
   link_map_.erase(name);
+  invalidateTopology();
 
   // Need to remove any reference to link in allowed collision matrix
   removeAllowedCollision(name);
@@ -492,6 +396,7 @@ bool SceneGraph::addJointHelper(const std::shared_ptr<Joint>& joint_ptr)
       boost::add_edge(parent->second.second, child->second.second, info, static_cast<Graph&>(*this));
   assert(e.second == true);
   joint_map_[joint_ptr->getName()] = std::make_pair(joint_ptr, e.first);
+  invalidateTopology();
 
   return true;
 }
@@ -515,6 +420,7 @@ bool SceneGraph::removeJoint(const std::string& name, bool recursive)
   {
     boost::remove_edge(found->second.second, static_cast<Graph&>(*this));
     joint_map_.erase(name);
+    invalidateTopology();
   }
   else
   {
@@ -832,41 +738,9 @@ std::vector<std::shared_ptr<const Joint>> SceneGraph::getOutboundJoints(const st
 
 bool SceneGraph::isEmpty() const { return link_map_.empty(); }
 
-bool SceneGraph::isAcyclic() const
-{
-  const auto& graph = static_cast<const Graph&>(*this);
-  bool acyclic = true;
-
-  std::map<Vertex, size_t> index_map;
-  boost::associative_property_map<std::map<Vertex, size_t>> prop_index_map(index_map);
-
-  int c = 0;
-  Graph::vertex_iterator i, iend;
-  for (boost::tie(i, iend) = boost::vertices(graph); i != iend; ++i, ++c)
-    boost::put(prop_index_map, *i, c);
-
-  cycle_detector vis(acyclic);
-  boost::depth_first_search(static_cast<const Graph&>(*this), boost::visitor(vis).vertex_index_map(prop_index_map));
-  return acyclic;
-}
+bool SceneGraph::isAcyclic() const { return getTopology()->acyclic; }
 
-bool SceneGraph::isTree() const
-{
-  const auto& graph = static_cast<const Graph&>(*this);
-  bool tree = true;
-
-  std::map<Vertex, size_t> index_map;
-  boost::associative_property_map<std::map<Vertex, size_t>> prop_index_map(index_map);
-
-  int c = 0;
-  Graph::vertex_iterator i, iend;
-  for (boost::tie(i, iend) = boost::vertices(graph); i != iend; ++i, ++c)
-    boost::put(prop_index_map, *i, c);
-
-  tree_detector vis(tree);
-  boost::depth_first_search(static_cast<const Graph&>(*this), boost::visitor(vis).vertex_index_map(prop_index_map));
-  return tree;
-}
+bool SceneGraph::isTree() const { return getTopology()->tree; }
 
 std::vector<std::string> SceneGraph::getAdjacentLinkNames(const std::string& name) const
 {
@@ -890,59 +764,127 @@ std::vector<std::string> SceneGraph::getInvAdjacentLinkNames(const std::string&
 
 std::vector<std::string> SceneGraph::getLinkChildrenNames(const std::string& name) const
 {
-  Vertex v = getVertex(name);
-  std::vector<std::string> child_link_names = getLinkChildrenHelper(v);
+  const std::shared_ptr<const Topology> topology = getTopology();
+  std::vector<std::string> child_link_names = getLinkChildrenHelper(*topology, getTopologyLinkIndex(*topology, name));
 
-  // This always includes the start vertex, so must remove
+  // This always includes the start link, so must remove
   child_link_names.erase(child_link_names.begin());
   return child_link_names;
 }
 
 std::vector<std::string> SceneGraph::getJointChildrenNames(const std::string& name) const
 {
-  const auto& graph = static_cast<const Graph&>(*this);
-  Edge e = getEdge(name);
-  Vertex v = boost::target(e, graph);
-  return getLinkChildrenHelper(v);  // NOLINT
+  const std::shared_ptr<const Topology> topology = getTopology();
+  const std::string& child_link_name = boost::get(boost::edge_joint, *this)[getEdge(name)]->child_link_name;
+  return getLinkChildrenHelper(*topology, getTopologyLinkIndex(*topology, child_link_name));
 }
 
 std::vector<std::string> SceneGraph::getJointChildrenNames(const std::vector<std::string>& names) const
 {
-  std::set<std::string> link_names;
+  const std::shared_ptr<const Topology> topology = getTopology();
+  const std::size_t link_count = topology->link_names.size();
+
+  // Mark the children of every joint once, links already marked are not processed again
+  std::vector<char> visited(link_count, 0);
+  std::vector<std::size_t> queue;
   for (const auto& name : names)
   {
-    std::vector<std::string> joint_children = getJointChildrenNames(name);
-    link_names.insert(joint_children.begin(), joint_children.end());
+    const std::string& child_link_name = boost::get(boost::edge_joint, *this)[getEdge(name)]->child_link_name;
+    const std::size_t index = getTopologyLinkIndex(*topology, child_link_name);
+    if (visited[index] != 0)
+      continue;
+
+    if (topology->tree)
+    {
+      std::fill(visited.begin() + static_cast<long>(index),
+                visited.begin() + static_cast<long>(topology->subtree_ends[index]),
+                1);
+      continue;
+    }
+
+    visited[index] = 1;
+    queue.assign(1, index);
+    for (std::size_t i = 0; i < queue.size(); ++i)
+    {
+      for (std::size_t j = topology->child_offsets[queue[i]]; j < topology->child_offsets[queue[i] + 1]; ++j)
+      {
+        const std::size_t child = topology->child_links[j];
+        if (visited[child] == 0)
+        {
+          visited[child] = 1;
+          queue.push_back(child);
+        }
+      }
+    }
+  }
+
+  std::vector<std::string> link_names;
+  for (std::size_t i = 0; i < link_count; ++i)
+  {
+    if (visited[i] != 0)
+      link_names.push_back(topology->link_names[i]);
   }
 
-  return std::vector<std::string>{ link_names.begin(), link_names.end() };
+  std::sort(link_names.begin(), link_names.end());
+  return link_names;
 }
 
 std::unordered_map<std::string, std::string>
 SceneGraph::getAdjacencyMap(const std::vector<std::string>& link_names) const
 {
-  std::map<Vertex, size_t> index_map;
-  boost::associative_property_map<std::map<Vertex, size_t>> prop_index_map(index_map);
-
-  std::map<Vertex, boost::default_color_type> color_map;
-  boost::associative_property_map<std::map<Vertex, boost::default_color_type>> prop_color_map(color_map);
+  const std::shared_ptr<const Topology> topology = getTopology();
+  const std::size_t link_count = topology->link_names.size();
+  const std::size_t npos = link_count;
 
-  int c = 0;
-  Graph::vertex_iterator i, iend;
-  for (boost::tie(i, iend) = boost::vertices(*this); i != iend; ++i, ++c)
-    boost::put(prop_index_map, *i, c);
+  std::vector<std::size_t> indices;
+  indices.reserve(link_names.size());
+  std::vector<char> terminate(link_count, 0);
+  for (const auto& link_name : link_names)
+  {
+    indices.push_back(getTopologyLinkIndex(*topology, link_name));
+    terminate[indices.back()] = 1;
+  }
 
   std::unordered_map<std::string, std::string> adjacency_map;
-  for (const auto& link_name : link_names)
+  if (topology->tree)
   {
-    Vertex start_vertex = getVertex(link_name);
-    adjacency_detector vis(adjacency_map, color_map, link_name, link_names);
+    // Parents come before their children so every link inherits the closest provided link above it in a single pass
+    std::vector<std::size_t> owners(link_count, npos);
+    for (std::size_t i = 0; i < link_count; ++i)
+    {
+      if (terminate[i] != 0)
+        owners[i] = i;
+      else if (topology->parent_links[i] != npos)
+        owners[i] = owners[topology->parent_links[i]];
+
+      if (owners[i] != npos)
+        adjacency_map[topology->link_names[i]] = topology->link_names[owners[i]];
+    }
 
-    // NOLINTNEXTLINE
-    boost::breadth_first_search(
-        *this,
-        start_vertex,
-        boost::visitor(vis).root_vertex(start_vertex).vertex_index_map(prop_index_map).color_map(prop_color_map));
+    return adjacency_map;
+  }
+
+  // Search from each provided link without passing through the other provided links
+  std::vector<char> visited(link_count);
+  std::vector<std::size_t> queue;
+  for (std::size_t index : indices)
+  {
+    const std::string& link_name = topology->link_names[index];
+    std::fill(visited.begin(), visited.end(), 0);
+    visited[index] = 1;
+    queue.assign(1, index);
+    for (std::size_t i = 0; i < queue.size(); ++i)
+    {
+      adjacency_map[topology->link_names[queue[i]]] = link_name;
+      for (std::size_t j = topology->child_offsets[queue[i]]; j < topology->child_offsets[queue[i] + 1]; ++j)
+      {
+        const std::size_t child = topology->child_links[j];
+        if (visited[child] == 0 && terminate[child] == 0)
+          queue.push_back(child);
+
+        visited[child] = 1;
+      }
+    }
   }
 
   return adjacency_map;
@@ -981,6 +923,56 @@ void SceneGraph::saveDOT(const std::string& path) const
 
 ShortestPath SceneGraph::getShortestPath(const std::string& root, const std::string& tip) const
 {
+  const std::shared_ptr<const Topology> topology = getTopology();
+  if (topology->tree)
+  {
+    // The path is unique in a tree, so walk up from both links to their common ancestor
+    std::size_t root_index = getTopologyLinkIndex(*topology, root);
+    std::size_t tip_index = getTopologyLinkIndex(*topology, tip);
+
+    std::vector<std::size_t> root_side;
+    std::vector<std::size_t> tip_side;
+    while (root_index != tip_index)
+    {
+      if (topology->depths[root_index] >= topology->depths[tip_index])
+      {
+        root_side.push_back(root_index);
+        root_index = topology->parent_links[root_index];
+      }
+      else
+      {
+        tip_side.push_back(tip_index);
+        tip_index = topology->parent_links[tip_index];
+      }
+    }
+
+    auto add_joint = [this](ShortestPath& path, const std::string& joint_name) {
+      path.joints.push_back(joint_name);
+      const JointType type = joint_map_.at(joint_name).first->type;
+      if (type != JointType::FIXED && type != JointType::FLOATING)
+        path.active_joints.push_back(joint_name);
+    };
+
+    ShortestPath path;
+    path.links.reserve(root_side.size() + tip_side.size() + 1);
+    path.joints.reserve(root_side.size() + tip_side.size());
+    path.active_joints.reserve(root_side.size() + tip_side.size());
+    for (std::size_t index : root_side)
+    {
+      path.links.push_back(topology->link_names[index]);
+      add_joint(path, topology->parent_joints[index]);
+    }
+
+    path.links.push_back(topology->link_names[root_index]);
+    for (auto it = tip_side.rbegin(); it != tip_side.rend(); ++it)
+    {
+      path.links.push_back(topology->link_names[*it]);
+      add_joint(path, topology->parent_joints[*it]);
+    }
+
+    return path;
+  }
+
   // Must copy to undirected graph because order does not matter for creating kinematics chains.
 
   // Copy Graph
@@ -1244,28 +1236,187 @@ void SceneGraph::rebuildLinkAndJointMaps()
   }
 }
 
-std::vector<std::string> SceneGraph::getLinkChildrenHelper(Vertex start_vertex) const
+void SceneGraph::invalidateTopology() { ++topology_revision_; }
+
+std::shared_ptr<const SceneGraph::Topology> SceneGraph::getTopology() const
+{
+  std::unique_lock<std::mutex> lock(topology_mutex_);
+  if (topology_ == nullptr || topology_->revision != topology_revision_)
+    topology_ = buildTopology();
+
+  return topology_;
+}
+
+std::shared_ptr<const SceneGraph::Topology> SceneGraph::buildTopology() const
 {
   const auto& graph = static_cast<const Graph&>(*this);
-  std::vector<std::string> child_link_names;
+  auto topology = std::make_shared<Topology>();
+  topology->revision = topology_revision_;
+
+  // Index the vertices in the order of the graph
+  std::vector<Vertex> vertices;
+  std::unordered_map<Vertex, std::size_t> vertex_indices;
+  {
+    Graph::vertex_iterator i, iend;
+    for (boost::tie(i, iend) = boost::vertices(graph); i != iend; ++i)
+    {
+      vertex_indices[*i] = vertices.size();
+      vertices.push_back(*i);
+    }
+  }
+
+  const std::size_t link_count = vertices.size();
+  const std::size_t npos = link_count;
+  std::vector<std::size_t> in_degrees(link_count);
+  std::size_t root_count{ 0 };
+  bool single_parents{ true };
+  bool unused_links{ false };
+  for (std::size_t i = 0; i < link_count; ++i)
+  {
+    in_degrees[i] = boost::in_degree(vertices[i], graph);
+    root_count += (in_degrees[i] == 0) ? 1 : 0;
+    single_parents &= (in_degrees[i] <= 1);
+    unused_links |= (in_degrees[i] == 0 && boost::out_degree(vertices[i], graph) == 0);
+  }
+
+  // Topological sort, the graph contains a cycle if not every link is reached
+  std::vector<std::size_t> order;
+  order.reserve(link_count);
+  {
+    std::vector<std::size_t> remaining = in_degrees;
+    for (std::size_t i = 0; i < link_count; ++i)
+    {
+      if (remaining[i] == 0)
+        order.push_back(i);
+    }
 
-  std::map<Vertex, size_t> index_map;
-  boost::associative_property_map<std::map<Vertex, size_t>> prop_index_map(index_map);
+    for (std::size_t i = 0; i < order.size(); ++i)
+    {
+      for (const auto& e : boost::make_iterator_range(boost::out_edges(vertices[order[i]], graph)))
+      {
+        const std::size_t child = vertex_indices[boost::target(e, graph)];
+        if (--remaining[child] == 0)
+          order.push_back(child);
+      }
+    }
+  }
 
-  std::map<Vertex, boost::default_color_type> color_map;
-  boost::associative_property_map<std::map<Vertex, boost::default_color_type>> prop_color_map(color_map);
+  topology->acyclic = (order.size() == link_count);
+  topology->tree = topology->acyclic && single_parents && root_count <= 1 && !unused_links;
+
+  if (topology->tree && link_count > 0)
+  {
+    // Depth first pre-order from the root so every subtree is a contiguous range
+    const std::size_t root = order.front();
+    order.clear();
+    std::vector<Vertex> stack{ vertices[root] };
+    std::vector<Vertex> children;
+    while (!stack.empty())
+    {
+      Vertex v = stack.back();
+      stack.pop_back();
+      order.push_back(vertex_indices[v]);
 
-  int c = 0;
-  Graph::vertex_iterator i, iend;
-  for (boost::tie(i, iend) = boost::vertices(graph); i != iend; ++i, ++c)
-    boost::put(prop_index_map, *i, c);
+      children.clear();
+      for (auto* child : boost::make_iterator_range(boost::adjacent_vertices(v, graph)))
+        children.push_back(child);
+
+      stack.insert(stack.end(), children.rbegin(), children.rend());
+    }
+  }
+  else if (!topology->acyclic)
+  {
+    order.resize(link_count);
+    std::iota(order.begin(), order.end(), 0);
+  }
 
-  children_detector vis(child_link_names);
-  // NOLINTNEXTLINE
-  boost::breadth_first_search(
-      graph,
-      start_vertex,
-      boost::visitor(vis).root_vertex(start_vertex).vertex_index_map(prop_index_map).color_map(prop_color_map));
+  std::vector<std::size_t> indices(link_count);
+  for (std::size_t i = 0; i < link_count; ++i)
+    indices[order[i]] = i;
+
+  topology->link_names.reserve(link_count);
+  topology->link_indices.reserve(link_count);
+  topology->child_offsets.reserve(link_count + 1);
+  topology->child_links.reserve(boost::num_edges(graph));
+  topology->parent_links.resize(link_count, npos);
+  topology->parent_joints.resize(link_count);
+  for (std::size_t i = 0; i < link_count; ++i)
+  {
+    Vertex v = vertices[order[i]];
+    topology->link_names.push_back(boost::get(boost::vertex_link, graph)[v]->getName());
+    topology->link_indices[topology->link_names.back()] = i;
+
+    topology->child_offsets.push_back(topology->child_links.size());
+    for (const auto& e : boost::make_iterator_range(boost::out_edges(v, graph)))
+      topology->child_links.push_back(indices[vertex_indices[boost::target(e, graph)]]);
+
+    if (in_degrees[order[i]] == 1)
+    {
+      const Edge e = *boost::in_edges(v, graph).first;
+      topology->parent_links[i] = indices[vertex_indices[boost::source(e, graph)]];
+      topology->parent_joints[i] = boost::get(boost::edge_joint, graph)[e]->getName();
+    }
+  }
+  topology->child_offsets.push_back(topology->child_links.size());
+
+  if (topology->tree)
+  {
+    // Parents come before their children and children before their siblings subtrees
+    topology->depths.resize(link_count, 0);
+    for (std::size_t i = 1; i < link_count; ++i)
+      topology->depths[i] = topology->depths[topology->parent_links[i]] + 1;
+
+    topology->subtree_ends.resize(link_count);
+    for (std::size_t i = link_count; i-- > 0;)
+    {
+      const std::size_t last_child = topology->child_offsets[i + 1];
+      topology->subtree_ends[i] = (last_child == topology->child_offsets[i]) ?
+                                      i + 1 :
+                                      topology->subtree_ends[topology->child_links[last_child - 1]];
+    }
+  }
+
+  return topology;
+}
+
+std::size_t SceneGraph::getTopologyLinkIndex(const Topology& topology, const std::string& name)
+{
+  auto found = topology.link_indices.find(name);
+  if (found == topology.link_indices.end())
+    throw std::runtime_error("SceneGraph, vertex with name '" + name + "' does not exist!");
+
+  return found->second;
+}
+
+std::vector<std::string> SceneGraph::getLinkChildrenHelper(const Topology& topology, std::size_t index)
+{
+  if (topology.tree)
+  {
+    return { topology.link_names.begin() + static_cast<long>(index),
+             topology.link_names.begin() + static_cast<long>(topology.subtree_ends[index]) };
+  }
+
+  // Breadth first search over the children
+  std::vector<char> visited(topology.link_names.size(), 0);
+  std::vector<std::size_t> queue{ index };
+  visited[index] = 1;
+  for (std::size_t i = 0; i < queue.size(); ++i)
+  {
+    for (std::size_t j = topology.child_offsets[queue[i]]; j < topology.child_offsets[queue[i] + 1]; ++j)
+    {
+      const std::size_t child = topology.child_links[j];
+      if (visited[child] == 0)
+      {
+        visited[child] = 1;
+        queue.push_back(child);
+      }
+    }
+  }
+
+  std::vector<std::string> child_link_names;
+  child_link_names.reserve(queue.size());
+  for (std::size_t i : queue)
+    child_link_names.push_back(topology.link_names[i]);
 
   return child_link_names;
 }
@@ -291,6 +291,78 @@ TEST(TesseractSceneGraphUnit, TesseractSceneGraphUnit)  // NOLINT
   }
 }
 
+TEST(TesseractSceneGraphUnit, TesseractSceneGraphTopologyUnit)  // NOLINT
+{
+  using namespace tesseract::scene_graph;
+  SceneGraph g = createTestSceneGraph();
+
+  // Queries on a tree
+  EXPECT_TRUE(g.isTree());
+  std::vector<std::string> child_link_names = g.getLinkChildrenNames("link_1");
+  std::sort(child_link_names.begin(), child_link_names.end());
+  EXPECT_EQ(child_link_names, std::vector<std::string>({ "link_2", "link_3", "link_4", "link_5" }));
+  child_link_names = g.getJointChildrenNames(std::vector<std::string>({ "joint_4", "joint_2", "joint_3" }));
+  EXPECT_EQ(child_link_names, std::vector<std::string>({ "link_3", "link_4", "link_5" }));
+  EXPECT_ANY_THROW(g.getLinkChildrenNames("link_does_not_exist"));  // NOLINT
+
+  // The path between two branches goes through their common parent
+  ShortestPath path = g.getShortestPath("link_4", "link_5");
+  EXPECT_EQ(path.links, std::vector<std::string>({ "link_4", "link_3", "link_2", "link_5" }));
+  EXPECT_EQ(path.joints, std::vector<std::string>({ "joint_3", "joint_2", "joint_4" }));
+  EXPECT_EQ(path.active_joints, std::vector<std::string>({ "joint_2", "joint_4" }));
+  path = g.getShortestPath("link_3", "link_3");
+  EXPECT_EQ(path.links, std::vector<std::string>({ "link_3" }));
+  EXPECT_TRUE(path.joints.empty());
+
+  // The clone shares the topology and is invalidated independently
+  SceneGraph::UPtr clone = g.clone();
+  EXPECT_TRUE(clone->isTree());
+  EXPECT_TRUE(clone->removeJoint("joint_4"));
+  EXPECT_FALSE(clone->isTree());
+  EXPECT_TRUE(g.isTree());
+  EXPECT_EQ(g.getLinkChildrenNames("link_2").size(), 3);
+  EXPECT_EQ(clone->getLinkChildrenNames("link_2").size(), 2);
+
+  // Changing a joint origin does not change the structure
+  EXPECT_TRUE(g.changeJointOrigin("joint_3", Eigen::Isometry3d::Identity()));
+  EXPECT_EQ(g.getShortestPath("link_1", "link_4").links.size(), 4);
+
+  // Moving a joint changes the structure
+  EXPECT_TRUE(g.moveJoint("joint_3", "link_5"));
+  child_link_names = g.getLinkChildrenNames("link_5");
+  EXPECT_EQ(child_link_names, std::vector<std::string>({ "link_4" }));
+  EXPECT_TRUE(g.getLinkChildrenNames("link_3").empty());
+  std::unordered_map<std::string, std::string> adj_map = g.getAdjacencyMap({ "link_3", "link_5" });
+  EXPECT_EQ(adj_map.size(), 3);
+  EXPECT_EQ(adj_map.at("link_4"), "link_5");
+
+  // Queries on a graph with a link that has two parents
+  Joint joint_5("joint_5");
+  joint_5.parent_link_name = "link_3";
+  joint_5.child_link_name = "link_4";
+  joint_5.type = JointType::FIXED;
+  EXPECT_TRUE(g.addJoint(joint_5));
+  EXPECT_FALSE(g.isTree());
+  EXPECT_TRUE(g.isAcyclic());
+  child_link_names = g.getLinkChildrenNames("link_2");
+  std::sort(child_link_names.begin(), child_link_names.end());
+  EXPECT_EQ(child_link_names, std::vector<std::string>({ "link_3", "link_4", "link_5" }));
+  child_link_names = g.getJointChildrenNames(std::vector<std::string>({ "joint_2", "joint_4" }));
+  EXPECT_EQ(child_link_names, std::vector<std::string>({ "link_3", "link_4", "link_5" }));
+  adj_map = g.getAdjacencyMap({ "link_2", "link_3" });
+  EXPECT_EQ(adj_map.size(), 4);
+  EXPECT_EQ(adj_map.at("link_5"), "link_2");
+  EXPECT_EQ(adj_map.at("link_4"), "link_3");
+
+  // Removing the joint restores the tree
+  EXPECT_TRUE(g.removeJoint("joint_5"));
+  EXPECT_TRUE(g.isTree());
+
+  g.clear();
+  EXPECT_TRUE(g.isTree());
+  EXPECT_TRUE(g.isAcyclic());
+}
+
 TEST(TesseractSceneGraphUnit, TesseractSceneGraphClearUnit)  // NOLINT
 {
   using namespace tesseract::scene_graph;
@@ -56,19 +56,15 @@ void SRDFModel::initFile(const tesseract::scene_graph::SceneGraph& scene_graph,
                          const std::string& filename,
                          const tesseract::common::ResourceLocator& locator)
 {
-  // get the entire file
+  // get the entire file, it is memory mapped and copied once into the string
   tesseract::common::Resource::Ptr resource = locator.locateResource(filename);
-  std::string xml_string;
-  std::fstream xml_file(filename.c_str(), std::fstream::in);
-  if (xml_file.is_open() && resource)
+  tesseract::common::ResourceBuffer buffer;
+  if (resource)
+    buffer = resource->getResourceBuffer();
+
+  if (!buffer.empty())
   {
-    while (xml_file.good())
-    {
-      std::string line;
-      std::getline(xml_file, line);
-      xml_string += (line + "\n");
-    }
-    xml_file.close();
+    const std::string xml_string(buffer.view());
     try
     {
       initString(scene_graph, xml_string, *resource);
@@ -185,6 +185,9 @@ private:
   std::unique_ptr<OFKTNode> root_;                                   /**< The root node of the tree */
   int revision_{ 0 };                                                /**< The revision number */
 
+  /** @brief The active joint name map to its index in active_joint_names_ */
+  std::unordered_map<std::string, Eigen::Index> active_joint_indices_;
+
   /** @brief The state solver can be accessed from multiple threads, need use mutex throughout */
   mutable std::shared_mutex mutex_;
 
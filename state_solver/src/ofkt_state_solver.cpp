@@ -173,6 +173,7 @@ OFKTStateSolver& OFKTStateSolver::operator=(const OFKTStateSolver& other)
   current_state_ = other.current_state_;
   joint_names_ = other.joint_names_;
   active_joint_names_ = other.active_joint_names_;
+  active_joint_indices_ = other.active_joint_indices_;
   floating_joint_names_ = other.floating_joint_names_;
   link_names_ = other.link_names_;
   root_ = std::make_unique<OFKTRootNode>(other.root_->getLinkName());
@@ -208,6 +209,7 @@ void OFKTStateSolver::clear()
   current_state_ = SceneState();
   joint_names_.clear();
   active_joint_names_.clear();
+  active_joint_indices_.clear();
   floating_joint_names_.clear();
   link_names_.clear();
   nodes_.clear();
@@ -483,10 +485,8 @@ Eigen::MatrixXd OFKTStateSolver::calcJacobianHelper(const std::unordered_map<std
       Eigen::Isometry3d local_tf = node->computeLocalTransformation(joints.at(node->getJointName()));
       total_tf = local_tf * total_tf;
 
-      Eigen::Index idx =
-          std::distance(active_joint_names_.begin(),
-                        std::find(active_joint_names_.begin(), active_joint_names_.end(), node->getJointName()));
-      Eigen::VectorXd twist = node->getLocalTwist();
+      const Eigen::Index idx = active_joint_indices_.at(node->getJointName());
+      Eigen::Matrix<double, 6, 1> twist = node->getLocalTwist();
       tesseract::common::twistChangeRefPoint(twist, total_tf.translation() - local_tf.translation());
       tesseract::common::twistChangeBase(twist, total_tf.inverse());
       jacobian.col(idx) = twist;
@@ -1197,6 +1197,10 @@ void OFKTStateSolver::removeJointHelper(const std::vector<std::string>& removed_
                                              }),
                               active_joint_names_.end());
 
+    active_joint_indices_.clear();
+    for (std::size_t i = 0; i < active_joint_names_.size(); ++i)
+      active_joint_indices_[active_joint_names_[i]] = static_cast<Eigen::Index>(i);
+
     tesseract::common::KinematicLimits l1;
     l1.joint_limits.resize(static_cast<long int>(active_joint_names_.size()), 2);
     l1.velocity_limits.resize(static_cast<long int>(active_joint_names_.size()), 2);
@@ -1256,6 +1260,7 @@ void OFKTStateSolver::addNode(const tesseract::scene_graph::Joint& joint,
       current_state_.link_transforms[n->getLinkName()] = n->getWorldTransformation();
       current_state_.joint_transforms[n->getJointName()] = n->getWorldTransformation();
       joint_names_.push_back(joint_name);
+      active_joint_indices_[joint_name] = static_cast<Eigen::Index>(active_joint_names_.size());
       active_joint_names_.push_back(joint_name);
       link_names_.push_back(n->getLinkName());
       new_joint_limits.push_back(joint.limits);
@@ -1274,6 +1279,7 @@ void OFKTStateSolver::addNode(const tesseract::scene_graph::Joint& joint,
       current_state_.link_transforms[n->getLinkName()] = n->getWorldTransformation();
       current_state_.joint_transforms[n->getJointName()] = n->getWorldTransformation();
       joint_names_.push_back(joint_name);
+      active_joint_indices_[joint_name] = static_cast<Eigen::Index>(active_joint_names_.size());
       active_joint_names_.push_back(joint_name);
       link_names_.push_back(n->getLinkName());
       new_joint_limits.push_back(joint.limits);
@@ -1292,6 +1298,7 @@ void OFKTStateSolver::addNode(const tesseract::scene_graph::Joint& joint,
       current_state_.link_transforms[n->getLinkName()] = n->getWorldTransformation();
       current_state_.joint_transforms[n->getJointName()] = n->getWorldTransformation();
       joint_names_.push_back(joint_name);
+      active_joint_indices_[joint_name] = static_cast<Eigen::Index>(active_joint_names_.size());
       active_joint_names_.push_back(joint_name);
       link_names_.push_back(n->getLinkName());
       new_joint_limits.push_back(joint.limits);
@@ -46,6 +46,9 @@ static constexpr std::string_view MESH_ELEMENT_NAME = "mesh";
 
 /**
  * @brief Parse xml element mesh
+ * @details Meshes parsed from the same local file with the same scale and processing flags are only loaded once. Each
+ * call returns its own mesh objects, but they share the immutable vertex and face buffers and the UUID so the
+ * collision shape caches can share them. A file is loaded again once none of its meshes are referenced.
  * @param xml_element The xml element
  * @param locator The Tesseract resource locator
  * @param visual Indicate if visual
@@ -48,7 +48,8 @@ std::unique_ptr<tesseract::scene_graph::SceneGraph> parseURDFString(const std::s
 
 /**
  * @brief Parse a URDF file into a Tesseract Scene Graph
- * @param URDF file path
+ * @param URDF file path or url, it is located using the resource locator. Paths the locator does not handle are opened
+ * directly.
  * @param The resource locator function
  * @throws std::nested_exception Thrown if error occurs during parsing. Use printNestedException to print contents of
  * the nested exception.
@@ -0,0 +1,159 @@
+/**
+ * @file create_resource_bundle.cpp
+ * @brief Bundle a URDF, an SRDF and every resource they reference into a single file
+ *
+ * @date October 19, 2026
+ *
+ * @copyright Copyright (c) 2026, Tesseract contributors
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract/common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <boost/program_options.hpp>
+#include <filesystem>
+#include <iostream>
+#include <map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract/scene_graph/graph.h>
+#include <tesseract/urdf/urdf_parser.h>
+#include <tesseract/srdf/srdf_model.h>
+#include <tesseract/common/resource_locator.h>
+
+namespace
+{
+const size_t ERROR_IN_COMMAND_LINE = 1;
+const size_t SUCCESS = 0;
+const size_t ERROR_UNHANDLED_EXCEPTION = 2;
+
+using Resources = std::map<std::string, tesseract::common::Resource::ConstPtr>;
+
+/**
+ * @brief A resource locator which records every resource located while parsing
+ * @details The located resources use a copy of this locator as their parent, so resources located relative to them
+ * and the includes of YAML files are recorded too.
+ */
+class RecordingResourceLocator : public tesseract::common::ResourceLocator
+{
+public:
+  RecordingResourceLocator(tesseract::common::ResourceLocator::ConstPtr locator, std::shared_ptr<Resources> resources)
+    : locator_(std::move(locator)), resources_(std::move(resources))
+  {
+  }
+
+  tesseract::common::Resource::Ptr locateResource(const std::string& url) const override
+  {
+    tesseract::common::Resource::Ptr resource = locator_->locateResource(url);
+    if (resource == nullptr || !resource->isFile() || !std::filesystem::exists(resource->getFilePath()))
+      return resource;
+
+    resource = std::make_shared<tesseract::common::SimpleLocatedResource>(
+        url, resource->getFilePath(), std::make_shared<RecordingResourceLocator>(*this));
+    (*resources_)[url] = resource;
+    return resource;
+  }
+
+private:
+  tesseract::common::ResourceLocator::ConstPtr locator_;
+  std::shared_ptr<Resources> resources_;
+};
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  std::string urdf;
+  std::string srdf;
+  std::string output;
+
+  namespace po = boost::program_options;
+  po::options_description desc("Options");
+  desc.add_options()("help,h", "Print help messages")(
+      "urdf,u", po::value<std::string>(&urdf)->required(), "File path or package url of the URDF.")(
+      "srdf,s", po::value<std::string>(&srdf), "File path or package url of the SRDF.")(
+      "output,o", po::value<std::string>(&output)->required(), "File path to save the bundle.");
+
+  po::variables_map vm;
+  try
+  {
+    po::store(po::parse_command_line(argc, argv, desc), vm);  // can throw
+
+    /** --help option */
+    if (vm.count("help") != 0U)
+    {
+      std::cout << "Basic Command Line Parameter App\n" << desc << "\n";
+      return SUCCESS;
+    }
+
+    po::notify(vm);  // throws on error, so do after help in case
+                     // there are any problems
+  }
+  catch (po::error& e)
+  {
+    std::cerr << "ERROR: " << e.what() << "\n\n";
+    std::cerr << desc << "\n";
+    return ERROR_IN_COMMAND_LINE;
+  }
+
+  // The resource locator only handles urls and absolute paths
+  auto to_url = [](const std::string& path) {
+    return (path.find("://") == std::string::npos) ? std::filesystem::absolute(path).string() : path;
+  };
+
+  // Every resource located while parsing is part of the dependency closure
+  auto resources = std::make_shared<Resources>();
+  RecordingResourceLocator locator(std::make_shared<tesseract::common::GeneralResourceLocator>(), resources);
+  auto urdf_resource = locator.locateResource(to_url(urdf));
+  if (urdf_resource == nullptr)
+  {
+    CONSOLE_BRIDGE_logError("Failed to locate the URDF!");
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  try
+  {
+    const std::string urdf_xml(urdf_resource->getResourceBuffer().view());
+    auto scene_graph = tesseract::urdf::parseURDFString(urdf_xml, locator);
+
+    if (!srdf.empty())
+    {
+      auto srdf_resource = locator.locateResource(to_url(srdf));
+      if (srdf_resource == nullptr)
+      {
+        CONSOLE_BRIDGE_logError("Failed to locate the SRDF!");
+        return ERROR_UNHANDLED_EXCEPTION;
+      }
+
+      tesseract::srdf::SRDFModel srdf_model;
+      const std::string srdf_xml(srdf_resource->getResourceBuffer().view());
+      srdf_model.initString(*scene_graph, srdf_xml, *srdf_resource);
+    }
+
+    tesseract::common::writeResourceBundle(output, *resources);
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("Failed to create resource bundle: %s", e.what());
+    return ERROR_UNHANDLED_EXCEPTION;
+  }
+
+  std::cout << "Bundled " << resources->size() << " resources:\n";
+  for (const auto& resource : *resources)
+    std::cout << "  " << resource.first << "\n";
+
+  return SUCCESS;
+}
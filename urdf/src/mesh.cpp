@@ -24,7 +24,12 @@
 
 #include <tesseract/common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <mutex>
 #include <stdexcept>
+#include <tuple>
 
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -42,6 +47,93 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract::urdf
 {
+namespace
+{
+/**
+ * @brief The mesh cache key
+ * @details The file path, last write time and file size of the located resource, the scale and the processing flags
+ */
+using MeshCacheKey =
+    std::tuple<std::string, std::filesystem::file_time_type, std::uintmax_t, double, double, double, bool, bool>;
+
+/**
+ * @brief Cache of parsed meshes
+ * @details The cached meshes are never handed out. Callers get their own copies which share the immutable vertex and
+ * face buffers and the UUID of the cached mesh, so modifying a returned mesh does not affect other parsers of the file.
+ */
+struct MeshCache
+{
+  std::mutex mutex;
+  std::map<MeshCacheKey, std::vector<std::shared_ptr<const tesseract::geometry::PolygonMesh>>> meshes;
+};
+
+MeshCache& getMeshCache()
+{
+  static MeshCache cache;
+  return cache;
+}
+
+/** @brief Check if none of the buffers of the cached meshes are shared with a returned mesh anymore */
+bool isMeshCacheEntryExpired(const std::vector<std::shared_ptr<const tesseract::geometry::PolygonMesh>>& meshes)
+{
+  return std::all_of(
+      meshes.begin(), meshes.end(), [](const auto& mesh) { return mesh->getVertices().use_count() == 1; });
+}
+
+/** @brief Remove the entries whose meshes are no longer referenced, the cache mutex must be locked */
+void pruneMeshCache(MeshCache& cache)
+{
+  for (auto it = cache.meshes.begin(); it != cache.meshes.end();)
+    it = isMeshCacheEntryExpired(it->second) ? cache.meshes.erase(it) : std::next(it);
+}
+
+/** @brief Create a copy of a cached mesh which shares its buffers and UUID */
+tesseract::geometry::PolygonMesh::Ptr copyCachedMesh(const tesseract::geometry::PolygonMesh& cached_mesh)
+{
+  auto mesh = std::static_pointer_cast<tesseract::geometry::PolygonMesh>(cached_mesh.clone());
+  mesh->setUUID(cached_mesh.getUUID());
+  if (auto convex_mesh = std::dynamic_pointer_cast<tesseract::geometry::ConvexMesh>(mesh))
+    convex_mesh->setCreationMethod(
+        static_cast<const tesseract::geometry::ConvexMesh&>(cached_mesh).getCreationMethod());
+
+  return mesh;
+}
+
+/**
+ * @brief Create the cache key for a resource
+ * @return False if the resource can not be cached because it is not a local file
+ */
+bool getMeshCacheKey(MeshCacheKey& key,
+                     const tesseract::common::Resource& resource,
+                     const Eigen::Vector3d& scale,
+                     bool visual,
+                     bool make_convex)
+{
+  if (!resource.isFile())
+    return false;
+
+  std::error_code ec;
+  const std::filesystem::path file_path(resource.getFilePath());
+  const std::filesystem::file_time_type write_time = std::filesystem::last_write_time(file_path, ec);
+  if (ec)
+    return false;
+
+  const std::uintmax_t file_size = std::filesystem::file_size(file_path, ec);
+  if (ec)
+    return false;
+
+  key = MeshCacheKey(std::filesystem::absolute(file_path, ec).lexically_normal().string(),
+                     write_time,
+                     file_size,
+                     scale.x(),
+                     scale.y(),
+                     scale.z(),
+                     visual,
+                     make_convex);
+  return true;
+}
+}  // namespace
+
 std::vector<tesseract::geometry::PolygonMesh::Ptr> parseMesh(const tinyxml2::XMLElement* xml_element,
                                                              const tesseract::common::ResourceLocator& locator,
                                                              bool visual,
@@ -78,18 +170,6 @@ std::vector<tesseract::geometry::PolygonMesh::Ptr> parseMesh(const tinyxml2::XML
     scale = Eigen::Vector3d(sx, sy, sz);
   }
 
-  std::vector<tesseract::geometry::Mesh::Ptr> meshes;
-
-  if (visual)
-    meshes = tesseract::geometry::createMeshFromResource<tesseract::geometry::Mesh>(
-        locator.locateResource(filename), scale, true, true, true, true, true);
-  else
-    meshes = tesseract::geometry::createMeshFromResource<tesseract::geometry::Mesh>(
-        locator.locateResource(filename), scale, true, false);
-
-  if (meshes.empty())
-    std::throw_with_nested(std::runtime_error("Mesh: Error importing meshes from filename: '" + filename + "'!"));
-
   bool make_convex_override = false;
   auto make_convex_override_status = xml_element->QueryBoolAttribute("tesseract:make_convex", &make_convex_override);
   if (make_convex_override_status != tinyxml2::XML_NO_ATTRIBUTE)
@@ -103,25 +183,66 @@ std::vector<tesseract::geometry::PolygonMesh::Ptr> parseMesh(const tinyxml2::XML
     make_convex = make_convex_override;
   }
 
-  if (make_convex)
+  tesseract::common::Resource::Ptr resource = locator.locateResource(filename);
+
+  // Return copies of the meshes previously parsed from the same file with the same settings so they share the same
+  // buffers and UUID
+  MeshCacheKey key;
+  const bool cacheable = (resource != nullptr) && getMeshCacheKey(key, *resource, scale, visual, make_convex);
+  if (cacheable)
   {
-    std::vector<tesseract::geometry::PolygonMesh::Ptr> convex_meshes;
-    convex_meshes.reserve(meshes.size());
+    MeshCache& cache = getMeshCache();
+    std::scoped_lock lock(cache.mutex);
+    auto it = cache.meshes.find(key);
+    if (it != cache.meshes.end() && !isMeshCacheEntryExpired(it->second))
+    {
+      std::vector<tesseract::geometry::PolygonMesh::Ptr> output;
+      output.reserve(it->second.size());
+      for (const auto& cached_mesh : it->second)
+        output.push_back(copyCachedMesh(*cached_mesh));
 
+      return output;
+    }
+  }
+
+  std::vector<tesseract::geometry::Mesh::Ptr> meshes;
+
+  if (visual)
+    meshes = tesseract::geometry::createMeshFromResource<tesseract::geometry::Mesh>(
+        resource, scale, true, true, true, true, true);
+  else
+    meshes = tesseract::geometry::createMeshFromResource<tesseract::geometry::Mesh>(resource, scale, true, false);
+
+  if (meshes.empty())
+    std::throw_with_nested(std::runtime_error("Mesh: Error importing meshes from filename: '" + filename + "'!"));
+
+  std::vector<tesseract::geometry::PolygonMesh::Ptr> output;
+  output.reserve(meshes.size());
+  if (make_convex)
+  {
     for (const auto& mesh : meshes)
     {
       tesseract::geometry::ConvexMesh::Ptr convex_mesh = tesseract::collision::makeConvexMesh(*mesh);
       convex_mesh->setCreationMethod(tesseract::geometry::ConvexMesh::CONVERTED);
-      convex_meshes.push_back(convex_mesh);
+      output.push_back(convex_mesh);
     }
-
-    return convex_meshes;
+  }
+  else
+  {
+    // Convert to base class for output
+    std::copy(meshes.begin(), meshes.end(), std::back_inserter(output));
   }
 
-  // Convert to base class for output
-  std::vector<tesseract::geometry::PolygonMesh::Ptr> output;
-  output.reserve(meshes.size());
-  std::copy(meshes.begin(), meshes.end(), std::back_inserter(output));
+  if (cacheable)
+  {
+    MeshCache& cache = getMeshCache();
+    std::scoped_lock lock(cache.mutex);
+    pruneMeshCache(cache);
+    std::vector<std::shared_ptr<const tesseract::geometry::PolygonMesh>>& cached_meshes = cache.meshes[key];
+    cached_meshes.assign(output.begin(), output.end());
+    for (auto& mesh : output)
+      mesh = copyCachedMesh(*mesh);
+  }
 
   return output;
 }
@@ -50,10 +50,25 @@ tesseract::geometry::Octree::Ptr parseOctree(const tinyxml2::XMLElement* xml_ele
     std::throw_with_nested(std::runtime_error("Octree: Missing or failed parsing attribute 'filename'!"));
 
   tesseract::common::Resource::Ptr resource = locator.locateResource(filename);
-  if (!resource || !resource->isFile())
+  if (!resource)
     std::throw_with_nested(std::runtime_error("Octree: Missing resource '" + filename + "'!"));
 
-  auto ot = std::make_shared<octomap::OcTree>(resource->getFilePath());
+  std::shared_ptr<octomap::OcTree> ot;
+  if (resource->isFile())
+  {
+    ot = std::make_shared<octomap::OcTree>(resource->getFilePath());
+  }
+  else
+  {
+    // Resources which are not files, like the resources of a bundle, are read from a stream
+    std::shared_ptr<std::istream> stream = resource->getResourceContentStream();
+    if (stream == nullptr)
+      std::throw_with_nested(std::runtime_error("Octree: Missing resource '" + filename + "'!"));
+
+    // The resolution is read from the stream
+    ot = std::make_shared<octomap::OcTree>(0.1);
+    ot->readBinary(*stream);
+  }
 
   if (ot == nullptr || ot->size() == 0)
     std::throw_with_nested(std::runtime_error("Octree: Error importing from '" + filename + "'!"));
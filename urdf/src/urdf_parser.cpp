@@ -195,11 +195,21 @@ std::unique_ptr<tesseract::scene_graph::SceneGraph> parseURDFString(const std::s
 std::unique_ptr<tesseract::scene_graph::SceneGraph> parseURDFFile(const std::string& path,
                                                                   const tesseract::common::ResourceLocator& locator)
 {
-  std::ifstream ifs(path);
-  if (!ifs)
+  // The file is located like every other resource so it can be served by the locator, for example from a bundle. Paths
+  // the locator does not handle, like relative paths, are opened directly.
+  tesseract::common::Resource::Ptr resource = locator.locateResource(path);
+  if (resource == nullptr && std::ifstream(path))
+    resource = std::make_shared<tesseract::common::SimpleLocatedResource>(path, path);
+
+  if (resource == nullptr)
+    std::throw_with_nested(std::runtime_error("URDF: Error opening file '" + path + "'!"));
+
+  // The file is memory mapped and copied once into the string
+  const tesseract::common::ResourceBuffer buffer = resource->getResourceBuffer();
+  if (buffer.empty() && resource->isFile() && !std::ifstream(resource->getFilePath()))
     std::throw_with_nested(std::runtime_error("URDF: Error opening file '" + path + "'!"));
 
-  std::string urdf_xml_string((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+  const std::string urdf_xml_string(buffer.view());
   tesseract::scene_graph::SceneGraph::UPtr sg;
   try
   {
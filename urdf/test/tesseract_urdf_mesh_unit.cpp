@@ -154,6 +154,64 @@ TEST(TesseractURDFUnit, parse_mesh)  // NOLINT
   }
 }
 
+TEST(TesseractURDFUnit, parse_mesh_cache)  // NOLINT
+{
+  tesseract::common::GeneralResourceLocator resource_locator;
+  const auto parse_mesh_fn =
+      [&](const tinyxml2::XMLElement* xml_element, const tesseract::common::ResourceLocator& locator, bool visual) {
+        return tesseract::urdf::parseMesh(xml_element, locator, visual, false);
+      };
+
+  const auto parse_fn = [&](const std::string& str, bool visual) {
+    std::vector<tesseract::geometry::PolygonMesh::Ptr> geom;
+    EXPECT_TRUE(runTest<std::vector<tesseract::geometry::PolygonMesh::Ptr>>(
+        geom, parse_mesh_fn, str, tesseract::urdf::MESH_ELEMENT_NAME.data(), resource_locator, visual));
+    EXPECT_EQ(geom.size(), 1);
+    return geom;
+  };
+
+  const std::string str = R"(<mesh filename="package://tesseract/support/meshes/sphere_p25m.stl"/>)";
+  const std::string scaled_str =
+      R"(<mesh filename="package://tesseract/support/meshes/sphere_p25m.stl" scale="1 2 1"/>)";
+  const std::string convex_str =
+      R"(<mesh filename="package://tesseract/support/meshes/sphere_p25m.stl" tesseract:make_convex="true"/>)";
+
+  std::vector<tesseract::geometry::PolygonMesh::Ptr> geom1 = parse_fn(str, false);
+  std::vector<tesseract::geometry::PolygonMesh::Ptr> geom2 = parse_fn(str, false);
+  EXPECT_NE(geom1[0], geom2[0]);
+  EXPECT_EQ(geom1[0]->getUUID(), geom2[0]->getUUID());
+  EXPECT_EQ(geom1[0]->getVertices(), geom2[0]->getVertices());
+  EXPECT_EQ(geom1[0]->getFaces(), geom2[0]->getFaces());
+
+  // Modifying a returned mesh does not affect the other parsers of the file
+  geom1[0]->setUUID(boost::uuids::uuid{});
+  std::vector<tesseract::geometry::PolygonMesh::Ptr> geom3 = parse_fn(str, false);
+  EXPECT_EQ(geom2[0]->getUUID(), geom3[0]->getUUID());
+  EXPECT_NE(geom1[0]->getUUID(), geom3[0]->getUUID());
+
+  // Different scale and processing flags are not shared
+  std::vector<tesseract::geometry::PolygonMesh::Ptr> scaled_geom = parse_fn(scaled_str, false);
+  std::vector<tesseract::geometry::PolygonMesh::Ptr> visual_geom = parse_fn(str, true);
+  std::vector<tesseract::geometry::PolygonMesh::Ptr> convex_geom = parse_fn(convex_str, false);
+  EXPECT_NE(geom2[0]->getUUID(), scaled_geom[0]->getUUID());
+  EXPECT_NE(geom2[0]->getUUID(), visual_geom[0]->getUUID());
+  EXPECT_NE(geom2[0]->getUUID(), convex_geom[0]->getUUID());
+  EXPECT_NEAR(scaled_geom[0]->getScale()[1], 2, 1e-5);
+  EXPECT_EQ(convex_geom[0]->getType(), tesseract::geometry::GeometryType::CONVEX_MESH);
+
+  std::vector<tesseract::geometry::PolygonMesh::Ptr> convex_geom2 = parse_fn(convex_str, false);
+  EXPECT_EQ(convex_geom[0]->getUUID(), convex_geom2[0]->getUUID());
+  EXPECT_EQ(std::static_pointer_cast<tesseract::geometry::ConvexMesh>(convex_geom2[0])->getCreationMethod(),
+            tesseract::geometry::ConvexMesh::CONVERTED);
+
+  // A file is loaded again once none of its meshes are referenced
+  const boost::uuids::uuid scaled_uuid = scaled_geom[0]->getUUID();
+  scaled_geom.clear();
+  std::vector<tesseract::geometry::PolygonMesh::Ptr> scaled_geom2 = parse_fn(scaled_str, false);
+  EXPECT_NE(scaled_uuid, scaled_geom2[0]->getUUID());
+  EXPECT_EQ(geom1[0]->getFaceCount(), scaled_geom2[0]->getFaceCount());
+}
+
 TEST(TesseractURDFUnit, write_mesh)  // NOLINT
 {
   {